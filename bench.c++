@@ -0,0 +1,258 @@
+/*
+ * Times toogl on a corpus, mkcorpus's as make bench has it:
+ *
+ *	bench [-n runs] toogl corpus.c
+ *
+ * First toogl itself, the best of runs each: how long it takes to start
+ * on an empty input, and its lines and bytes a second translating the
+ * corpus without and with the line cache (-M), with the peak RSS of each.
+ * Then, in this process, the pieces of a translation over the corpus's
+ * lines: Search (a Search per name length, as toogl first had it),
+ * MultiSearch and WideSearch finding names, the last with every kernel
+ * the CPU can run, checked against each other, then the Regexps of the
+ * rules nominated, and split_args() and replace_args() on what matches.
+ *
+ * toogl.c++ is included whole, its main() renamed, to get at its statics.
+ */
+
+#define main toogl_main
+#include "toogl.c++"
+#undef main
+
+#include <sys/wait.h>
+
+static int runs = 5;
+
+// a rule nominated on a line, and what it's found to match
+struct Use {
+    const char *line;
+    const Rule *r;
+    int paren;		// offset of the '(' of a function call, -1 if no match
+    RangeList s;	// as match_func() leaves it
+};
+
+// run toogl with args on input, its output thrown away, giving the
+// wall time taken and its peak RSS in Kbytes
+static long long
+run(const char *toogl, const char *arg, const char *input, long *maxrss)
+{
+    long long start = now_ns();
+    struct rusage ru;
+    int status;
+    pid_t pid = fork();
+
+    if(pid < 0) {
+	perror("bench: fork");
+	exit(1);
+    }
+    if(pid == 0) {
+	int in = open(input, O_RDONLY), out = open("/dev/null", O_WRONLY);
+	if(in < 0 || out < 0) {
+	    perror(input);
+	    _exit(1);
+	}
+	dup2(in, 0);
+	dup2(out, 1);
+	dup2(out, 2);
+	execl(toogl, toogl, arg, (char *)0);
+	_exit(127);
+    }
+    if(wait4(pid, &status, 0, &ru) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) == 127) {
+	std::cerr << "bench: can't run " << toogl << "\n";
+	exit(1);
+    }
+    *maxrss = ru.ru_maxrss;
+    return now_ns() - start;
+}
+
+// the best of runs of toogl
+static void
+time_toogl(const char *label, const char *toogl, const char *arg, const char *input,
+    long lines, long bytes)
+{
+    long long best = 0, ns;
+    long rss, maxrss = 0;
+
+    for(int i = 0; i < runs; i++) {
+	ns = run(toogl, arg, input, &rss);
+	if(i == 0 || ns < best)
+	    best = ns;
+	if(rss > maxrss)
+	    maxrss = rss;
+    }
+    printf("%-14s %10.2f", label, best / 1e6);
+    if(lines)
+	printf(" %12.0f %10.2f", lines / (best / 1e9), bytes / (best / 1e9) / 1e6);
+    else
+	printf(" %12s %10s", "", "");
+    printf(" %10ld\n", maxrss);
+}
+
+static void
+piece(const char *label, long long ns, long n, const char *per)
+{
+    printf("%-26s %10.2f %10.1f ns/%s (%ld)\n", label, ns / 1e6, n ? (double)ns / n : 0.0, per, n);
+}
+
+static void
+count_hit(int id, int offset, void *arg)
+{
+    (*(long *)arg)++;
+}
+
+int
+main(int argc, char **argv)
+{
+    int c, i, j, nlines = 0;
+    struct stat st;
+    char *text, **lines;
+    long long start;
+    long hits;
+
+    while((c = getopt(argc, argv, "n:")) != -1) {
+	if(c != 'n') {
+	    std::cerr << "Usage: bench [-n runs] toogl corpus.c\n";
+	    exit(1);
+	}
+	runs = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    }
+    if(argc - optind != 2) {
+	std::cerr << "Usage: bench [-n runs] toogl corpus.c\n";
+	exit(1);
+    }
+    const char *toogl = argv[optind], *corpus = argv[optind + 1];
+
+    // the corpus, split into lines
+    int fd = open(corpus, O_RDONLY);
+    if(fd < 0 || fstat(fd, &st) < 0) {
+	perror(corpus);
+	exit(1);
+    }
+    text = new char[st.st_size + 1];
+    if(read(fd, text, st.st_size) != st.st_size) {
+	perror(corpus);
+	exit(1);
+    }
+    close(fd);
+    text[st.st_size] = '\0';
+    for(char *p = text; (p = strchr(p, '\n')) != 0; p++)
+	nlines++;
+    lines = new char *[nlines + 1];
+    nlines = 0;
+    for(char *p = text; *p; ) {
+	lines[nlines++] = p;
+	if((p = strchr(p, '\n')) == 0)
+	    break;
+	*p++ = '\0';
+    }
+
+    printf("toogl on %s: %d lines, %ld bytes, best of %d\n\n", corpus, nlines, (long)st.st_size, runs);
+    printf("%-14s %10s %12s %10s %10s\n", "", "ms", "lines/s", "MB/s", "peak KB");
+    time_toogl("startup", toogl, 0, "/dev/null", 0, 0);
+    time_toogl("toogl", toogl, 0, corpus, nlines, st.st_size);
+    time_toogl("toogl -M", toogl, "-M", corpus, nlines, st.st_size);
+
+    index_names();
+
+    std::ostream quiet(0);	// split_args()' complaints go nowhere
+    Translation t;
+    t.err = &quiet;
+
+    printf("\nPieces, in this process\n");
+
+    Search search[MAXPATTERN];
+    for(i = 0; i < names.patterns(); i++)
+	search[rules[by_name[i]].bucket].add(rules[by_name[i]].name);
+    hits = 0;
+    start = now_ns();
+    for(i = 0; i < nlines; i++) {
+	for(j = 0; j < MAXPATTERN; j++)
+	    hits += search[j].check(lines[i]);
+    }
+    piece("Search", now_ns() - start, nlines, "line");
+
+    hits = 0;
+    start = now_ns();
+    for(i = 0; i < nlines; i++)
+	names.scan(lines[i], count_hit, &hits);
+    piece("MultiSearch", now_ns() - start, nlines, "line");
+
+    // each WideSearch kernel the CPU has, which must all agree with the
+    // plain 64 bit one
+    for(int k = 0; k < WideSearch::kernels(); k++) {
+	PerlString kernel("WideSearch (");
+	kernel += WideSearch::kernel(k);
+	kernel += ")";
+	hits = 0;
+	start = now_ns();
+	for(i = 0; i < nlines; i++)
+	    hits += wide.check(lines[i], strlen(lines[i]), k) != 0;
+	piece(kernel, now_ns() - start, nlines, "line");
+	for(i = 0; i < nlines; i++) {
+	    int n = strlen(lines[i]);
+	    if(wide.check(lines[i], n, k) != wide.check(lines[i], n, 0)) {
+		std::cerr << "bench: WideSearch " << WideSearch::kernel(k)
+		    << " doesn't agree with " << WideSearch::kernel(0) << " on line "
+		    << i + 1 << "\n";
+		exit(1);
+	    }
+	}
+    }
+
+    // every rule nominated on each line, its regexp compiled out of the
+    // way first
+    PerlList<Use> uses(1024);
+    for(i = 0; i < nlines; i++) {
+	nominate_rules(t, lines[i], strlen(lines[i]), 0);
+	for(j = next_nominee(t, 0); j >= 0; j = next_nominee(t, j + 1)) {
+	    Use u;
+	    u.line = lines[i];
+	    u.r = &rules[j];
+	    u.paren = -1;
+	    rules[j].re.get();
+	    uses.push(u);
+	}
+    }
+
+    RegexpMatch rm;
+    start = now_ns();
+    for(i = 0; i < uses.scalar(); i++) {
+	if(uses[i].r->re.match(uses[i].line, rm) && uses[i].r->kind != Rule::define)
+	    uses[i].paren = rm.getgroup(3).start();
+    }
+    piece("Regexp", now_ns() - start, uses.scalar(), "try");
+
+    RangeList s;
+    long split = 0;
+    start = now_ns();
+    for(i = 0; i < uses.scalar(); i++) {
+	if(uses[i].paren >= 0) {
+	    s.reset();
+	    split_args(t, uses[i].line, uses[i].paren, s);
+	    split++;
+	}
+    }
+    piece("split_args", now_ns() - start, split, "call");
+
+    // the args rules' matches broken up as match_func() does it
+    long replaced = 0;
+    for(i = 0; i < uses.scalar(); i++) {
+	if(uses[i].paren >= 0 && uses[i].r->kind == Rule::args) {
+	    PerlString f(uses[i].line);
+	    if(!match_func(t, *uses[i].r, f, uses[i].s, f.length()))
+		uses[i].paren = -1;
+	}
+    }
+    PerlString out;
+    start = now_ns();
+    for(i = 0; i < uses.scalar(); i++) {
+	if(uses[i].paren >= 0 && uses[i].r->kind == Rule::args && uses[i].s.scalar()) {
+	    out = "";
+	    replace_args(t, out, *uses[i].r, uses[i].line, uses[i].s);
+	    replaced++;
+	}
+    }
+    piece("replace_args", now_ns() - start, replaced, "call");
+
+    return 0;
+}
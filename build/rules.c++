@@ -0,0 +1,3787 @@
+// Made by mkrules from rules.def.  Don't edit.
+
+#include <string.h>
+#include "rules.h"
+
+static const char rep0[] = "glBegin(GL_QUAD_STRIP)";
+static const char rep1[] = "glEnd()";
+static const char rep2[] = "glBegin(GL_TRIANGLE_STRIP)";
+static const char rep3[] = "glEnd()";
+static const char rep4[] = "glBegin(GL_LINE_STRIP)";
+static const char rep5[] = "glEnd()";
+static const char rep6[] = "glBegin(GL_LINE_LOOP)";
+static const char rep7[] = "glEnd()";
+static const char rep8[] = "glBegin(GL_POINTS)";
+static const char rep9[] = "glEnd()";
+static const char rep10[] = "glBegin(GL_POLYGON)";
+static const char rep11[] = "glEnd()";
+static const char rep12[] = "glPushMatrix()";
+static const char rep13[] = "glPopMatrix()";
+static const char rep14[] = "glClearIndex(index);glClearColor(r, g, b, a); glClear(GL_COLOR_BUFFER_BIT)";
+static const char rep15[] = "glClearDepth(1.); glClear(GL_DEPTH_BUFFER_BIT)";
+static const char rep16[] = "(glGetIntegerv(GL_CURRENT_INDEX, &gctmp),  gctmp)";
+static const char rep17[] = "(glGetIntegerv(GL_CURRENT_INDEX, &gstmp), gstmp)";
+static const char rep18[] = "gluBeginCurve( obj )";
+static const char rep19[] = "gluBeginSurface( obj )";
+static const char rep20[] = "gluBeginTrim( obj )";
+static const char rep21[] = "glEndList()";
+static const char rep22[] = "gluEndCurve( obj )";
+static const char rep23[] = "glRenderMode(GL_RENDER)";
+static const char rep24[] = "glRenderMode(GL_RENDER)";
+static const char rep25[] = "gluEndSurface( obj )";
+static const char rep26[] = "gluEndTrim( obj )";
+static const char rep27[] = "glFinish()";
+static const char rep28[] = "glGenLists(1)";
+static const char rep29[] = "glIsEnabled(GL_FOG)";
+static const char rep30[] = "glInitNames()";
+static const char rep31[] = "glEnd()";
+static const char rep32[] = "glPopAttrib()";
+static const char rep33[] = "glPopName()";
+static const char rep34[] = "glPopAttrib()";
+static const char rep35[] = "glPushAttrib(GL_ALL_ATTRIB_BITS)";
+static const char rep36[] = "glPushAttrib(GL_VIEWPORT_BIT)";
+static const char rep37[] = "";
+static const char rep38[] = "";
+static const char rep39[] = "";
+static const char rep40[] = "";
+static const char rep41[] = "";
+static const char rep42[] = "";
+static const char rep43[] = "";
+static const char rep44[] = "";
+static const char rep45[] = "";
+static const char rep46[] = "";
+static const char rep47[] = "";
+static const char rep48[] = "";
+static const char rep49[] = "";
+static const char rep50[] = "";
+static const char rep51[] = "";
+static const char rep52[] = "";
+static const char rep53[] = "";
+static const char rep54[] = "";
+static const char rep55[] = "";
+static const char rep56[] = "";
+static const char rep57[] = "";
+static const char rep58[] = "";
+static const char rep59[] = "";
+static const char rep60[] = "";
+static const char rep61[] = "";
+static const char rep62[] = "";
+static const char rep63[] = "";
+static const char rep64[] = "";
+static const char rep65[] = "";
+static const char rep66[] = "";
+static const char rep67[] = "";
+static const char rep68[] = "";
+static const char rep69[] = "";
+static const char rep70[] = "";
+static const char rep71[] = "";
+static const char rep72[] = "";
+static const char rep73[] = "";
+static const char rep74[] = "";
+static const char rep75[] = "";
+static const char rep76[] = "";
+static const char rep77[] = "";
+static const char rep78[] = "";
+static const char rep79[] = "";
+static const char rep80[] = "";
+static const char rep81[] = "";
+static const char rep82[] = "";
+static const char rep83[] = "";
+static const char rep84[] = "";
+static const char rep85[] = "";
+static const char rep86[] = "";
+static const char rep87[] = "";
+static const char rep88[] = "";
+static const char rep89[] = "";
+static const char rep90[] = "";
+static const char rep91[] = "";
+static const char rep92[] = "";
+static const char rep93[] = "";
+static const char rep94[] = "";
+static const char rep95[] = "";
+static const char rep96[] = "";
+static const char rep97[] = "";
+static const char rep98[] = "";
+static const char rep99[] = "";
+static const char rep100[] = "";
+static const char rep101[] = "";
+static const char rep102[] = "";
+static const char rep103[] = "";
+static const char rep104[] = "";
+static const char rep105[] = "";
+static const char rep106[] = "";
+static const char rep107[] = "";
+static const char rep108[] = "";
+static const char rep109[] = "";
+static const char rep110[] = "";
+static const char rep111[] = "";
+static const char rep112[] = "";
+static const char rep113[] = "";
+static const char rep114[] = "";
+static const char rep115[] = "";
+static const char rep116[] = "";
+static const char rep117[] = "";
+static const char rep118[] = "";
+static const char rep119[] = "glColor3fv($1)";
+static const char rep120[] = "glColor3sv($1)";
+static const char rep121[] = "glColor3iv($1)";
+static const char rep122[] = "glColor4fv($1)";
+static const char rep123[] = "glColor4sv($1)";
+static const char rep124[] = "glColor4iv($1)";
+static const char rep125[] = "glVertex2fv($1)";
+static const char rep126[] = "glVertex2sv($1)";
+static const char rep127[] = "glVertex2iv($1)";
+static const char rep128[] = "glVertex2dv($1)";
+static const char rep129[] = "glVertex3fv($1)";
+static const char rep130[] = "glVertex3sv($1)";
+static const char rep131[] = "glVertex3iv($1)";
+static const char rep132[] = "glVertex3dv($1)";
+static const char rep133[] = "glVertex4fv($1)";
+static const char rep134[] = "glVertex4sv($1)";
+static const char rep135[] = "glVertex4iv($1)";
+static const char rep136[] = "glVertex4dv($1)";
+static const char rep137[] = "glNormal3fv($1)";
+static const char rep138[] = "glTexCoord2fv($1)";
+static const char rep139[] = "glTexCoord3fv($1)";
+static const char rep140[] = "glTexCoord2sv($1)";
+static const char rep141[] = "glTexCoord2iv($1)";
+static const char rep142[] = "glTexCoord2dv($1)";
+static const char rep143[] = "glTranslatef($1, $2, $3)";
+static const char rep144[] = "glLoadMatrixf($1)";
+static const char rep145[] = "glMultMatrixf($1)";
+static const char rep146[] = "glColor3ub($1, $2, $3)";
+static const char rep147[] = "glNormal3fv($1)";
+static const char rep148[] = "glBlendFunc($1, $2); if(($1) == GL_ONE && ($2) == GL_ZERO) glDisable(GL_BLEND) else glEnable(GL_BLEND)";
+static const char rep149[] = "glCallList($1)";
+static const char rep150[] = "glCallLists(strlen($1), GL_UNSIGNED_BYTE, $1)";
+static const char rep151[] = "glRasterPos3f($1, $2, $3)";
+static const char rep152[] = "glRasterPos2f($1, $2)";
+static const char rep153[] = "glRasterPos2i($1, $2)";
+static const char rep154[] = "glRasterPos2s($1, $2)";
+static const char rep155[] = "glRasterPos3i($1, $2, $3)";
+static const char rep156[] = "glRasterPos3s($1, $2, $3)";
+static const char rep157[] = "glIndexi($1)";
+static const char rep158[] = "glIndexf($1)";
+static const char rep159[] = "glIndexi($1)";
+static const char rep160[] = "glListBase(int n)";
+static const char rep161[] = "glAlphaFunc($2, ($1)/255.); if(($2)==GL_ALWAYS) glDisable(GL_ALPHA_TEST) else glEnable(GL_ALPHA_TEST)";
+static const char rep162[] = "glAccum($1, $2)";
+static const char rep163[] = "{GLint get_depth_tmp[2];glGetIntegerv(GL_DEPTH_RANGE, get_depth_tmp);*($1)=get_depth_tmp[0];*($2)=get_depth_tmp[1];}";
+static const char rep164[] = "if($1) glEnable(GL_LINE_SMOOTH); else glDisable(GL_LINE_SMOOTH)";
+static const char rep165[] = "if($1) glEnable(GL_LINE_SMOOTH); else glDisable(GL_LINE_SMOOTH)";
+static const char rep166[] = "if($1) glEnable(GL_POLYGON_SMOOTH); else glDisable(GL_POLYGON_SMOOTH)";
+static const char rep167[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2,  0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep168[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep169[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep170[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep171[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep172[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep173[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep174[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep175[] = "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep176[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep177[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep178[] = "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }";
+static const char rep179[] = "glCallList($1)";
+static const char rep180[] = "glClipPlane( GL_CLIP_PLANE0+($1), *equation); if($2) glEnable(GL_CLIP_PLANE+($1)); else glDisable(GL_CLIP_PLANE0+($1))";
+static const char rep181[] = "glColor4ubv(&($1))";
+static const char rep182[] = "glEvalCoord1f( u )";
+static const char rep183[] = "glEvalMesh1f(GL_LINE, 0, n-1 )";
+static const char rep184[] = "glMap1();glMap2();glMapGrid()";
+static const char rep185[] = "glMap1();glMap2();glMapGrid()";
+static const char rep186[] = "glClearDepth($2);glClearColor(((float)(($1)&0xff))/255., (float)(($1)>>8&0xff)/255., (float)(($1)>>16&0xff)/255., (float)(($1)>>24&0xff)/255. );glClear(GL_DEPTH_BUFFER_BIT|GL_COLOR_BUFFER_BIT)";
+static const char rep187[] = "glNewList($1, GL_COMPILE);glLineStipple(factor, $2); glEndList()";
+static const char rep188[] = "if($1) {glCallList($1); glEnable(GL_LINE_STIPPLE);} else glDisable(GL_LINE_STIPPLE)";
+static const char rep189[] = "glNewList($1, GL_COMPILE); glPolygonStipple(MASK($3)); glEndList()";
+static const char rep190[] = "glXUseXFont( font, first, count, listBase)";
+static const char rep191[] = "glDeleteLists( $1, 1)";
+static const char rep192[] = "if($1) glEnable(GL_DITHER); else glDisable(GL_DITHER)";
+static const char rep193[] = "glxChooseVisual(*display, screen, *attriblist)";
+static const char rep194[] = "glxChooseVisual(*display, screen, *attriblist)";
+static const char rep195[] = "glRenderMode(GL_RENDER); glMatrixMode(GL_PROJECTION); glLoadIdentity(); gluPerspective( fovy, aspect, znear, zfar ); glMatrixMode(GL_MODELVIEW);";
+static const char rep196[] = "glFeedbackBuffer($2, GL_3D_COLOR, $1); glRenderMode(GL_FEEDBACK);";
+static const char rep197[] = "glFogfv($1, $2); if($1) glEnable(GL_FOG); else glDisable(GL_FOG)";
+static const char rep198[] = "glDrawBuffer(($1) ? GL_FRONT : GL_BACK)";
+static const char rep199[] = "glDrawBuffer(($1) ? GL_BACK : GL_FRONT)";
+static const char rep200[] = "glCullFace(($1) ? GL_FRONT : GL_BACK); ($1) ? glEnable(GL_CULL_FACE):glDisable(GL_CULL_FACE)";
+static const char rep201[] = "glCullFace(!($1) ? GL_FRONT : GL_BACK); ($1) ? glEnable(GL_CULL_FACE):glDisable(GL_CULL_FACE)";
+static const char rep202[] = "glVertex3f($1, $2, $3)";
+static const char rep203[] = "glVertex2f($1, $2)";
+static const char rep204[] = "glVertex2i($1, $2)";
+static const char rep205[] = "glVertex2s($1, $2)";
+static const char rep206[] = "glVertex3i($1, $2, $3)";
+static const char rep207[] = "glVertex3s($1, $2, $3)";
+static const char rep208[] = "glBegin(GL_LINE_STRIP); glVertex3f($1, $2, $3)";
+static const char rep209[] = "glBegin(GL_LINE_STRIP); glVertex2f($1, $2)";
+static const char rep210[] = "glBegin(GL_LINE_STRIP); glVertex2i($1, $2)";
+static const char rep211[] = "glBegin(GL_LINE_STRIP); glVertex2s($1, $2)";
+static const char rep212[] = "glBegin(GL_LINE_STRIP); glVertex3i($1, $2, $3)";
+static const char rep213[] = "glBegin(GL_LINE_STRIP); glVertex3s($1, $2, $3)";
+static const char rep214[] = "(glGetIntegerv(GL_INDEX_MODE, &dmtmp), dmtmp)";
+static const char rep215[] = "glxGetCurrentContext()";
+static const char rep216[] = "(glGetIntegerv($1, &gctmp), gctmp)";
+static const char rep217[] = "(glGetIntegerv($1, &gdtmp), gdtmp)";
+static const char rep218[] = "glGetFloatv(GL_MODELVIEW_MATRIX, $1)";
+static const char rep219[] = "(glGetIntegerv(GL_MATRIX_MODE, &gmtmp), gmtmp)";
+static const char rep220[] = "gluGetNurbsProperty(GL_MATRIX_MODE, &tmp)";
+static const char rep221[] = "(glGetIntegerv(GL_LIST_INDEX, &tmp),  tmp)";
+static const char rep222[] = "glGetPolygonStipple(mask)";
+static const char rep223[] = "(glGetIntegerv(GL_INDEX_BITS, &tmp),  tmp)";
+static const char rep224[] = "{ GLint tmp[4]; glGetIntegerv(GL_SCISSOR_BOX, &tmp);*($1)=tmp[0];*($2)=tmp[0]+tmp[2]-1;*($3)=tmp[1];*($4)=tmp[1]+tmp[3]-1;}";
+static const char rep225[] = "(glGetIntegerv(GL_SHADE_MODEL, &tmp), tmp)";
+static const char rep226[] = "{GLint tmp[4];glGetIntegerv(GL_VIEWPORT, &tmp);*($1)=tmp[0];*($2)=tmp[0]+tmp[2]-1;*($3)=tmp[1];*($4)=tmp[1]+tmp[3]-1;}";
+static const char rep227[] = "(glGetIntegerv( (glGetIntegerv(GL_INDEX_MODE, &tmp), tmp) ? GL_INDEX_WRITEMASK : GL_COLOR_MASK, &tmp), tmp)";
+static const char rep228[] = "glIsEnabled(GL_DEPTH_TEST)";
+static const char rep229[] = "glFlush()";
+static const char rep230[] = "{int tmp[4]; glGetIntegerv(GL_CURRENT_COLOR, tmp);*($1)=tmp[0];*($2)=tmp[1];*($3)=tmp[2];}";
+static const char rep231[] = "{GLboolean tmp[4]; glGetBooleanv(GL_COLOR_WRITEMASK, tmp);*($1)=tmp[0];*($2)=tmp[1];*($3)=tmp[2];}";
+static const char rep232[] = "glSelectBuffer($2, $1); glRenderMode(GL_SELECT)";
+static const char rep233[] = "glIsList($1)";
+static const char rep234[] = "glCallLists(lstrlen($2), $1, $2)";
+static const char rep235[] = "glLineWidth($1)";
+static const char rep236[] = "glLineWidth((GLfloat)($1))";
+static const char rep237[] = "(glGetIntegerv(GL_LINE_WIDTH, &tmp), tmp)";
+static const char rep238[] = "glColorMaterial(GL_FRONT_AND_BACK, $1);glEnable(GL_COLOR_MATERIAL)";
+static const char rep239[] = "glLoadMatrix($1)";
+static const char rep240[] = "glLoadName($1)";
+static const char rep241[] = "glLogicOp($1); if($1 == GL_COPY) glDisable(GL_LOGIC_OP); else glEnable(GL_LOGIC_OP)";
+static const char rep242[] = "gluLookat($1, $2, $3, $4, $5, $6, UPX($7), UPY($7), UPZ($7))";
+static const char rep243[] = "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)";
+static const char rep244[] = "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_COLOR_INDEX, GL_SHORT, $5)";
+static const char rep245[] = "glRasterPos2i($1, $2);glDrawPixels(($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)";
+static const char rep246[] = "glRasterPos2i($1, $2);glDrawPixels(($3)-($1)+1, ($4)-($2)+1, GL_COLOR_INDEX, GL_SHORT, $5)";
+static const char rep247[] = "glDepthRange($1, $2)";
+static const char rep248[] = "glDepthRange($1, $2)";
+static const char rep249[] = "glLineStipple($1, pattern)";
+static const char rep250[] = "glGetIntegerv(GL_LINE_STIPPLE_REPEAT, &tmp)";
+static const char rep251[] = "glNewList($1, GL_COMPILE)";
+static const char rep252[] = "gluProject(XXX)";
+static const char rep253[] = "gluProject(XXX)";
+static const char rep254[] = "glMatrixMode($1)";
+static const char rep255[] = "if($1) glEnable(GL_NORMALIZE); else glDisable(GL_NORMALIZE)";
+static const char rep256[] = "glxCreateGLXPixmap(*display, *visual, pixmap)";
+static const char rep257[] = "gluNurbsCurve(*nobj, $1, $2, $3, $4, $5, $6)";
+static const char rep258[] = "gluNurbsSurface(*nobj, $1, $2, $3, $4, $5, $6, $7, $8, $9, $a)";
+static const char rep259[] = "glDeleteLists(LIST($1, $2), RANGE($1, $2))";
+static const char rep260[] = "{GLint mm; glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();glOrtho($1, $2, $3, $4, $5, $6);glMatrixMode(mm);}";
+static const char rep261[] = "{GLint mm; glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();gluOrtho2D($1, $2, $3, $4);glMatrixMode(mm);}";
+static const char rep262[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep263[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep264[] = "glPassThrough($1)";
+static const char rep265[] = "glVertex3f($1, $2, $3)";
+static const char rep266[] = "glVertex3i($1, $2, $3)";
+static const char rep267[] = "glVertex3s($1, $2, $3)";
+static const char rep268[] = "glVertex2f($1, $2)";
+static const char rep269[] = "glVertex2i($1, $2)";
+static const char rep270[] = "glVertex2s($1, $2)";
+static const char rep271[] = "glBegin(GL_POLYGON);glVertex3f($1, $2, $3)";
+static const char rep272[] = "glBegin(GL_POLYGON);glVertex3i($1, $2, $3)";
+static const char rep273[] = "glBegin(GL_POLYGON);glVertex3s($1, $2, $3)";
+static const char rep274[] = "glBegin(GL_POLYGON);glVertex2f($1, $2)";
+static const char rep275[] = "glBegin(GL_POLYGON);glVertex2i($1, $2)";
+static const char rep276[] = "glBegin(GL_POLYGON);glVertex2s($1, $2)";
+static const char rep277[] = "{GLint mm;glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();gluPerspective(.1*($1), $2, $3, $4);glMatrixMode(mm);}";
+static const char rep278[] = "glSelectBuffer($2, $1);glRenderMode(GL_SELECT);glMatrixMode(GL_PROJECTION);gluPickMatrix(x, y, w, h, viewport);glMatrixMode(GL_MODELVIEW)";
+static const char rep279[] = "gluPickMatrix(x, y, $1, $2, viewport)";
+static const char rep280[] = "glPixelTransfer($1, $2)";
+static const char rep281[] = "glPixelTransfer($1, $2)";
+static const char rep282[] = "glBegin(GL_POINTS);glVertex3f($1, $2, $3);glEnd()";
+static const char rep283[] = "glBegin(GL_POINTS);glVertex3i($1, $2, $3);glEnd()";
+static const char rep284[] = "glBegin(GL_POINTS);glVertex3s($1, $2, $3);glEnd()";
+static const char rep285[] = "glBegin(GL_POINTS);glVertex2f($1, $2);glEnd()";
+static const char rep286[] = "glBegin(GL_POINTS);glVertex2i($1, $2);glEnd()";
+static const char rep287[] = "glBegin(GL_POINTS);glVertex2s($1, $2);glEnd()";
+static const char rep288[] = "glPointSize((GLfloat)($1))";
+static const char rep289[] = "glPointSize((GLfloat)($1))";
+static const char rep290[] = "{if($1) glEnable(GL_POINT_SMOOTH) else glDisable(GL_POINT_SMOOTH);}";
+static const char rep291[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}";
+static const char rep292[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}";
+static const char rep293[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}";
+static const char rep294[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}";
+static const char rep295[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}";
+static const char rep296[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}";
+static const char rep297[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}";
+static const char rep298[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}";
+static const char rep299[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}";
+static const char rep300[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}";
+static const char rep301[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}";
+static const char rep302[] = "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}";
+static const char rep303[] = "glPolygonMode(GL_FRONT_AND_BACK, $1)";
+static const char rep304[] = "{if($1) glEnable(GL_POLYGON_SMOOTH) else glDisable(GL_POLYGON_SMOOTH);}";
+static const char rep305[] = "glPushName($1)";
+static const char rep306[] = "gluPwlCurve(*nobj, $1, $2, $3, $4)";
+static const char rep307[] = "glVertex3f($1, $2, $3)";
+static const char rep308[] = "glVertex2f($1, $2)";
+static const char rep309[] = "glVertex2i($1, $2)";
+static const char rep310[] = "glVertex2s($1, $2)";
+static const char rep311[] = "glVertex3i($1, $2, $3)";
+static const char rep312[] = "glVertex3s($1, $2, $3)";
+static const char rep313[] = "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)";
+static const char rep314[] = "{ int tmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POS, tmp);glReadPixels(tmp[0], tmp[1], $1, 1,  GL_RGBA, GL_BYTE, array);}";
+static const char rep315[] = "{ GLint tmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POS, tmp);glReadPixels(tmp[0], tmp[1], $1, 1,  GL_INDEX, GL_SHORT, $2);}";
+static const char rep316[] = "glReadBuffer($1)";
+static const char rep317[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRectf($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep318[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRecti($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep319[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRects($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep320[] = "glRectf($1, $2, $3, $4)";
+static const char rep321[] = "glRecti($1, $2, $3, $4)";
+static const char rep322[] = "glRects($1, $2, $3, $4)";
+static const char rep323[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRect($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep324[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRecti($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep325[] = "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRects($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)";
+static const char rep326[] = "glRect($1, $2, $3, $4)";
+static const char rep327[] = "glRecti($1, $2, $3, $4)";
+static const char rep328[] = "glRects($1, $2, $3, $4)";
+static const char rep329[] = "glRasterPos2i($5, $6);glCopyPixels($1, $2, $3-$1+1, $4-$2+1, GL_COLOR)";
+static const char rep330[] = "glPixelZoom($1, $2)";
+static const char rep331[] = "glColorMask($1, $2, $3, GL_TRUE)";
+static const char rep332[] = "glBegin(GL_LINES); glVertex3f($1, $2, $3)";
+static const char rep333[] = "glBegin(GL_LINES); glVertex2f($1, $2)";
+static const char rep334[] = "glBegin(GL_LINES); glVertex2i($1, $2)";
+static const char rep335[] = "glBegin(GL_LINES); glVertex2s($1, $2)";
+static const char rep336[] = "glBegin(GL_LINES); glVertex3i($1, $2, $3)";
+static const char rep337[] = "glBegin(GL_LINES); glVertex3s($1, $2, $3)";
+static const char rep338[] = "glRotatef($1, ($2)=='x'||($2)=='X', ($2)=='y'||($2)=='Y', ($2)=='z'||($2)=='Z')";
+static const char rep339[] = "glRotatef(.1*($1), ($2)=='x'||($2)=='X', ($2)=='y'||($2)=='Y', ($2)=='z'||($2)=='Z')";
+static const char rep340[] = "glVertex3f($1, $2, $3)";
+static const char rep341[] = "glVertex3i($1, $2, $3)";
+static const char rep342[] = "glVertex3s($1, $2, $3)";
+static const char rep343[] = "glVertex2f($1, $2)";
+static const char rep344[] = "glVertex2i($1, $2)";
+static const char rep345[] = "glVertex2s($1, $2)";
+static const char rep346[] = "glBegin(GL_POLYGON);glVertex3f($1, $2, $3)";
+static const char rep347[] = "glBegin(GL_POLYGON);glVertex3i($1, $2, $3)";
+static const char rep348[] = "glBegin(GL_POLYGON);glVertex3s($1, $2, $3)";
+static const char rep349[] = "glBegin(GL_POLYGON);glVertex2f($1, $2)";
+static const char rep350[] = "glBegin(GL_POLYGON);glVertex2i($1, $2)";
+static const char rep351[] = "glBegin(GL_POLYGON);glVertex2s($1, $2)";
+static const char rep352[] = "glScalef($1, $2, $3)";
+static const char rep353[] = "glClearStencil($1);glClear(GL_STENCIL_BUFFER_BIT)";
+static const char rep354[] = "glScissor($1, $2, $3, $4); glEnable(GL_SCISSOR_TEST)";
+static const char rep355[] = "gluNurbsProperty(*nobj, $1, $2)";
+static const char rep356[] = "if($1) {glCallList($1); glEnable(GL_POLYGON_STIPPLE);} else glDisable(GL_POLYGON_STIPPLE)";
+static const char rep357[] = "glShadeModel($1)";
+static const char rep358[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}";
+static const char rep359[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}";
+static const char rep360[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}";
+static const char rep361[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}";
+static const char rep362[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}";
+static const char rep363[] = "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}";
+static const char rep364[] = "if($1) { glEnable(GL_STENCIL_TEST);glStencilFunc($3, $2, $4); glStencilOp($5, $6, $7);} else glDisable(GL_STENCIL_TEST);";
+static const char rep365[] = "glStencilMask(0xff>>(8-($1)))";
+static const char rep366[] = "glStencilMask($1)";
+static const char rep367[] = "glViewport($1, $3, ($2)-($1)+1, ($4)-($3)+1); glScissor($1, $3, ($2)-($1)+1, ($4)-($3)+1)";
+static const char rep368[] = "{GLint mm;glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();glFrustum($1, $2, $3, $4, $5, $6);glMatrixMode(mm);}";
+static const char rep369[] = "glColorMask(($1)&0xff, (($1)>>8)&0xff, (($1)>>16)&0xff, (($1)>>24)&0xff)";
+static const char rep370[] = "glIndexMask($1)";
+static const char rep371[] = "glDrawPixels($1, 1, GL_COLOR_INDEX, GL_SHORT, $2)";
+static const char rep372[] = "glDrawPixels($1, 1, GL_RGBA, GL_BYTE, PACK($2, $3, $4))";
+static const char rep373[] = "if($1) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST)";
+static const char rep374[] = "glDepthFunc($1)";
+static const char rep375[] = "glDepthMask((GLBoolean)($1))";
+static const char rep376[] = "(glIsEnabled(GL_CULL_FACE) && (glGetIntegerv(GL_CULL_FACE_MODE, &tmp), (tmp == GL_BACK)))";
+static const char rep377[] = "(glGetIntegerv(GL_DRAW_BUFFERS, &tmp),  tmp)";
+static const char rep378[] = "(glGetBooleanv(GL_INDEX_MODE, &tmp), tmp)";
+static const char rep379[] = "{ GLint cpostmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POSITION, cpostmp); *($1) = cpostmp[0]; *($2) = cpostmp[1];}";
+static const char rep380[] = "glTexGenfv($1, $2, $3)";
+static const char rep381[] = "glNewList($1); glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, MODES($3)); glEndList()";
+static const char rep382[] = "glNewList($1); glTexImage2D(GL_TEXTURE_2D, 0, $2, $3, $4, border, GL_RGBA, GL_UNSIGNED_BYTE, $5); glEndList()";
+static const char rep383[] = "if($2) {glCallList($2); glEnable(GL_TEXTURE_2D);} else glDisable(GL_TEXTURE_2D)";
+static const char rep384[] = "if($2) {glCallList($2); glEnable(GL_TEXTURE_2D);} else glDisable(GL_TEXTURE_2D)";
+static const char rep385[] = "glTranslatef(0., 0., -($1)); glRotatef( -($4)*10., 0., 0., 1.); glRotatef( -($3)*10., 1., 0., 0.); glRotatef( -($2)*10., 0., 0., 1);";
+static const char rep386[] = "GL_BACK";
+static const char rep387[] = "GL_BACK";
+static const char rep388[] = "GL_FRONT";
+static const char rep389[] = "XXX";
+static const char rep390[] = "GL_AUX0";
+static const char rep391[] = "GL_AUX1";
+static const char rep392[] = "GL_AUX2";
+static const char rep393[] = "XXX";
+static const char rep394[] = "GL_ZERO";
+static const char rep395[] = "GL_ONE";
+static const char rep396[] = "GL_DST_COLOR";
+static const char rep397[] = "GL_SRC_COLOR";
+static const char rep398[] = "GL_ONE_MINUS_DST_COLOR";
+static const char rep399[] = "GL_ONE_MINUS_SRC_COLOR";
+static const char rep400[] = "GL_SRC_ALPHA";
+static const char rep401[] = "GL_ONE_MINUS_SRC_ALPHA";
+static const char rep402[] = "GL_DST_ALPHA";
+static const char rep403[] = "GL_ONE_MINUS_DST_ALPHA";
+static const char rep404[] = "GL_SRC_ALPHA_SATURATE";
+static const char rep405[] = "GL_NEVER";
+static const char rep406[] = "GL_LESS";
+static const char rep407[] = "GL_EQUAL";
+static const char rep408[] = "GL_LEQUAL";
+static const char rep409[] = "GL_GREATER";
+static const char rep410[] = "GL_NOTEQUAL";
+static const char rep411[] = "GL_GEQUAL";
+static const char rep412[] = "GL_ALWAYS";
+static const char rep413[] = "GL_NEVER";
+static const char rep414[] = "GL_LESS";
+static const char rep415[] = "GL_EQUAL";
+static const char rep416[] = "GL_LEQUAL";
+static const char rep417[] = "GL_GREATER";
+static const char rep418[] = "GL_NOTEQUAL";
+static const char rep419[] = "GL_GEQUAL";
+static const char rep420[] = "GL_ALWAYS";
+static const char rep421[] = "0";
+static const char rep422[] = "1";
+static const char rep423[] = "1";
+static const char rep424[] = "0";
+static const char rep425[] = "1";
+static const char rep426[] = "1";
+static const char rep427[] = "1";
+static const char rep428[] = "0";
+static const char rep429[] = "1";
+static const char rep430[] = "1";
+static const char rep431[] = "0";
+static const char rep432[] = "1";
+static const char rep433[] = "GL_FLAT";
+static const char rep434[] = "GL_SMOOTH";
+static const char rep435[] = "GL_CLEAR";
+static const char rep436[] = "GL_AND";
+static const char rep437[] = "GL_AND_REVERSE";
+static const char rep438[] = "GL_COPY";
+static const char rep439[] = "GL_AND_INVERTED";
+static const char rep440[] = "GL_NOOP";
+static const char rep441[] = "GL_XOR";
+static const char rep442[] = "GL_OR";
+static const char rep443[] = "GL_NOR";
+static const char rep444[] = "GL_EQUIV";
+static const char rep445[] = "GL_INVERT";
+static const char rep446[] = "GL_OR_REVERSE";
+static const char rep447[] = "GL_COPY_INVERTED";
+static const char rep448[] = "GL_OR_INVERTED";
+static const char rep449[] = "GL_NAND";
+static const char rep450[] = "GL_SET";
+static const char rep451[] = "GL_KEEP";
+static const char rep452[] = "GL_ZERO";
+static const char rep453[] = "GL_REPLACE";
+static const char rep454[] = "GL_INCR";
+static const char rep455[] = "GL_DECR";
+static const char rep456[] = "GL_INVERT";
+static const char rep457[] = "GL_NEVER";
+static const char rep458[] = "GL_LESS";
+static const char rep459[] = "GL_EQUAL";
+static const char rep460[] = "GL_LEQUAL";
+static const char rep461[] = "GL_GREATER";
+static const char rep462[] = "GL_NOTEQUAL";
+static const char rep463[] = "GL_GEQUAL";
+static const char rep464[] = "GL_ALWAYS";
+static const char rep465[] = "GL_FILL";
+static const char rep466[] = "GL_POINT";
+static const char rep467[] = "GL_LINE";
+static const char rep468[] = "GL_LINE";
+static const char rep469[] = "GL_LINE";
+static const char rep470[] = "0";
+static const char rep471[] = "1";
+static const char rep472[] = "XXX fg_define";
+static const char rep473[] = "GL_FOG_EXP";
+static const char rep474[] = "GL_LINEAR";
+static const char rep475[] = "GL_EXP";
+static const char rep476[] = "GL_LINEAR";
+static const char rep477[] = "GL_EXP2";
+static const char rep478[] = "GL_EXP2";
+static const char rep479[] = "XXX_SHIFT";
+static const char rep480[] = "XXX_EXPAND";
+static const char rep481[] = "XXX_C0";
+static const char rep482[] = "XXX_C1";
+static const char rep483[] = "XXX_ADD24";
+static const char rep484[] = "XXX_SIZE";
+static const char rep485[] = "XXX_OFFSET";
+static const char rep486[] = "XXX_STRIDE";
+static const char rep487[] = "XXX_TTOB";
+static const char rep488[] = "XXX_RTOL";
+static const char rep489[] = "XXX_ZDATA";
+static const char rep490[] = "XXX_WARP";
+static const char rep491[] = "XXX_RDX";
+static const char rep492[] = "XXX_RDY";
+static const char rep493[] = "XXX_CDX";
+static const char rep494[] = "XXX_CDY";
+static const char rep495[] = "XXX_XSTART";
+static const char rep496[] = "XXX_YSTART";
+static const char rep497[] = "XXX_VO1";
+static const char rep498[] = "0";
+static const char rep499[] = "1";
+static const char rep500[] = "XXX_CLEAR";
+static const char rep501[] = "GL_ACCUM";
+static const char rep502[] = "GL_LOAD";
+static const char rep503[] = "GL_RETURN";
+static const char rep504[] = "GL_MULT";
+static const char rep505[] = "GL_ADD";
+static const char rep506[] = "0";
+static const char rep507[] = "1";
+static const char rep508[] = "2";
+static const char rep509[] = "XXX_XPMAX";
+static const char rep510[] = "XXX_YPMAX";
+static const char rep511[] = "XXX_XMMAX";
+static const char rep512[] = "XXX_YMMAX";
+static const char rep513[] = "XXX_ZMIN";
+static const char rep514[] = "XXX_ZMAX";
+static const char rep515[] = "GL_RED_BITS";
+static const char rep516[] = "GL_GREEN_BITS";
+static const char rep517[] = "GL_BLUE_BITS";
+static const char rep518[] = "GL_RED_BITS";
+static const char rep519[] = "GL_GREEN_BITS";
+static const char rep520[] = "GL_BLUE_BITS";
+static const char rep521[] = "GL_INDEX_BITS";
+static const char rep522[] = "GL_INDEX_BITS";
+static const char rep523[] = "GL_INDEX_BITS";
+static const char rep524[] = "GL_INDEX_BITS";
+static const char rep525[] = "GL_DEPTH_BITS";
+static const char rep526[] = "XXX_BITS_OVER_SNG_CMODE";
+static const char rep527[] = "XXX_BITS_UNDR_SNG_CMODE";
+static const char rep528[] = "XXX_BITS_PUP_SNG_CMODE";
+static const char rep529[] = "GL_ALPHA_BITS";
+static const char rep530[] = "GL_ALPHA_BITS";
+static const char rep531[] = "XXX_BITS_CURSOR";
+static const char rep532[] = "XXX_OVERUNDER_SHARED";
+static const char rep533[] = "GL_BLEND";
+static const char rep534[] = "XXX_CIFRACT";
+static const char rep535[] = "XXX_CROSSHAIR_CINDEX";
+static const char rep536[] = "GL_DITHER";
+static const char rep537[] = "GL_LINE_SMOOTH";
+static const char rep538[] = "GL_LINE_SMOOTH";
+static const char rep539[] = "GL_LOGICOP";
+static const char rep540[] = "XXX_NSCRNS";
+static const char rep541[] = "GL_MAX_EVAL_ORDER";
+static const char rep542[] = "XXX_NBLINKS";
+static const char rep543[] = "XXX_NVERTEX_POLY";
+static const char rep544[] = "XXX_PATSIZE_64";
+static const char rep545[] = "GL_POINT_SMOOTH";
+static const char rep546[] = "GL_POINT_SMOOTH";
+static const char rep547[] = "XXX_PUP_TO_OVERUNDER";
+static const char rep548[] = "GL_READ_BUFFER";
+static const char rep549[] = "GL_READ_BUFFER";
+static const char rep550[] = "GL_STEREO";
+static const char rep551[] = "XXX_SUBPIXEL_LINE";
+static const char rep552[] = "GL_SUBPIXEL_PNT";
+static const char rep553[] = "GL_SUBPIXEL_POLY";
+static const char rep554[] = "GL_MAX_EVAL_ORDER";
+static const char rep555[] = "XXX_WSYS";
+static const char rep556[] = "XXX_ZDRAW_GEOM";
+static const char rep557[] = "XXX_ZDRAW_PIXELS";
+static const char rep558[] = "XXX_SCRNTYPE";
+static const char rep559[] = "XXX_TEXTPORT";
+static const char rep560[] = "XXX_NMMAPS";
+static const char rep561[] = "XXX_FRAMEGRABBER";
+static const char rep562[] = "XXX_TIMERHZ";
+static const char rep563[] = "XXX_DBBOX";
+static const char rep564[] = "GL_ALPHA_TEST";
+static const char rep565[] = "XXX_ALPHA_OVERUNDER";
+static const char rep566[] = "GL_ACCUM_RED_BITS";
+static const char rep567[] = "GL_ACCUM_RED_BITS";
+static const char rep568[] = "GL_STENCIL_BITS";
+static const char rep569[] = "GL_MAX_CLIP_PLANES";
+static const char rep570[] = "GL_FOG";
+static const char rep571[] = "XXX_LIGHTING_TWOSIDE";
+static const char rep572[] = "GL_POLYGON_MODE";
+static const char rep573[] = "GL_POLYGON_SMOOTH";
+static const char rep574[] = "XXX_SCRBOX";
+static const char rep575[] = "GL_TEXTURE_2D";
+static const char rep576[] = "GL_FOG";
+static const char rep577[] = "GL_TEXTURE_2D";
+static const char rep578[] = "XXX_MUXPIPES";
+static const char rep579[] = "GL_MODELVIEW";
+static const char rep580[] = "GL_PROJECTION";
+static const char rep581[] = "GL_MODELVIEW";
+static const char rep582[] = "GL_TEXTURE";
+static const char rep583[] = "GL_UNSIGNED_BYTE";
+static const char rep584[] = "GL_2_BYTES";
+static const char rep585[] = "GL_3_BYTES";
+static const char rep586[] = "GL_4_BYTES";
+static const char rep587[] = "GL_UNSIGNED_SHORT";
+static const char rep588[] = "GL_UNSIGNED_INT";
+static const char rep589[] = "XXX lmc_COLOR";
+static const char rep590[] = "GL_EMISSION";
+static const char rep591[] = "GL_AMBIENT";
+static const char rep592[] = "GL_DIFFUSE";
+static const char rep593[] = "GL_SPECULAR";
+static const char rep594[] = "GL_AMBIENT_AND_DIFFUSE";
+static const char rep595[] = "XXX_LMC_NULL";
+static const char rep596[] = "GL_TEXTURE_MIN_FILTER";
+static const char rep597[] = "GL_TEXTURE_MAG_FILTER";
+static const char rep598[] = "XXX_TX_WRAP";
+static const char rep599[] = "GL_TEXTURE_WRAP_S";
+static const char rep600[] = "GL_TEXTURE_WRAP_T";
+static const char rep601[] = "XXX_TX_TILE";
+static const char rep602[] = "XXX_TX_BORDER";
+static const char rep603[] = "";
+static const char rep604[] = "";
+static const char rep605[] = "GL_NEAREST";
+static const char rep606[] = "GL_LINEAR";
+static const char rep607[] = "GL_NEAREST_MIPMAP_LINEAR";
+static const char rep608[] = "GL_NEAREST_MIPMAP_NEAREST";
+static const char rep609[] = "GL_NEAREST_MIPMAP_LINEAR";
+static const char rep610[] = "GL_LINEAR_MIPMAP_NEAREST";
+static const char rep611[] = "GL_LINEAR_MIPMAP_LINEAR";
+static const char rep612[] = "GL_MODULATE";
+static const char rep613[] = "GL_BLEND";
+static const char rep614[] = "GL_DECAL";
+static const char rep615[] = "GL_TEXTURE_ENV_COLOR";
+static const char rep616[] = "GL_S";
+static const char rep617[] = "GL_T";
+static const char rep618[] = "GL_REPEAT";
+static const char rep619[] = "GL_CLAMP";
+static const char rep620[] = "XXX_SELECT";
+static const char rep621[] = "XXX_TG_OFF";
+static const char rep622[] = "XXX_TG_ON";
+static const char rep623[] = "GL_TG_CONTOUR";
+static const char rep624[] = "GL_EYE_LINEAR";
+static const char rep625[] = "GL_SPHERE_MAP";
+static const char rep626[] = "GL_TEXTURE_ENV";
+static const char rep627[] = "GL_TEXTURE_2D";
+static const char rep628[] = "GL_INDEX_BITS";
+static const char rep629[] = "GL_RED_BITS";
+static const char rep630[] = "GL_GREEN_BITS";
+static const char rep631[] = "GL_BLUE_BITS";
+static const char rep632[] = "GL_ALPHA_BITS";
+static const char rep633[] = "GL_DEPTH_BITS";
+static const char rep634[] = "XXX_ZMIN";
+static const char rep635[] = "XXX_Z_MAX";
+static const char rep636[] = "GL_STENCIL_BITS";
+static const char rep637[] = "GL_ACCUM_RED_BITS";
+static const char rep638[] = "XXX_MS_SAMPLES";
+static const char rep639[] = "XXX_MS_ZBUFFER";
+static const char rep640[] = "XXX_MS_ZMIN";
+static const char rep641[] = "XXX_MS_ZMAX";
+static const char rep642[] = "GL_STENCIL_BITS";
+static const char rep643[] = "GL_STEREO";
+static const char rep644[] = "GL_DOUBLEBUFFER";
+static const char rep645[] = "GLbyte";
+static const char rep646[] = "GLboolean";
+static const char rep647[] = "GLbyte *";
+static const char rep648[] = "GLint *";
+static const char rep649[] = "GLfloat";
+static const char rep650[] = "GLuint";
+static const char rep651[] = "GLshort";
+static const char rep652[] = "GLint";
+static const char rep653[] = "GLfloat";
+static const char rep654[] = "GLfloat *";
+static const char rep655[] = "GLshort";
+static const char rep656[] = "GLuint";
+static const char rep657[] = "GLuint *";
+static const char rep658[] = "GLuint *";
+static const char rep659[] = "GLuint *";
+static const char rep660[] = "GLuint *";
+static const char rep661[] = "GLuint";
+static const char rep662[] = "";
+static const char rep663[] = "";
+static const char rep664[] = "";
+static const char rep665[] = "";
+static const char rep666[] = "";
+static const char rep667[] = "";
+static const char rep668[] = "";
+static const char rep669[] = "";
+static const char rep670[] = "";
+static const char rep671[] = "";
+static const char rep672[] = "";
+static const char rep673[] = "";
+static const char rep674[] = "";
+static const char rep675[] = "";
+static const char rep676[] = "";
+static const char rep677[] = "";
+static const char rep678[] = "";
+static const char rep679[] = "";
+static const char rep680[] = "";
+static const char rep681[] = "";
+static const char rep682[] = "";
+static const char rep683[] = "";
+static const char rep684[] = "";
+static const char rep685[] = "";
+static const char rep686[] = "";
+static const char rep687[] = "";
+static const char rep688[] = "";
+static const char rep689[] = "";
+static const char rep690[] = "";
+static const char rep691[] = "";
+static const char rep692[] = "";
+static const char rep693[] = "";
+static const char rep694[] = "";
+static const char rep695[] = "";
+static const char rep696[] = "";
+static const char rep697[] = "";
+static const char rep698[] = "";
+static const char rep699[] = "";
+static const char rep700[] = "";
+static const char rep701[] = "";
+static const char rep702[] = "";
+static const char rep703[] = "";
+static const char rep704[] = "";
+static const char rep705[] = "";
+static const char rep706[] = "";
+static const char rep707[] = "";
+static const char rep708[] = "";
+static const char rep709[] = "";
+static const char rep710[] = "";
+static const char rep711[] = "";
+static const char rep712[] = "";
+static const char rep713[] = "";
+static const char rep714[] = "";
+static const char rep715[] = "";
+static const char rep716[] = "";
+static const char rep717[] = "";
+static const char rep718[] = "";
+static const char rep719[] = "";
+static const char rep720[] = "";
+static const char rep721[] = "";
+static const char rep722[] = "";
+static const char rep723[] = "";
+static const char rep724[] = "";
+static const char rep725[] = "";
+static const char rep726[] = "";
+static const char rep727[] = "";
+static const char rep728[] = "";
+static const char rep729[] = "";
+static const char rep730[] = "";
+static const char rep731[] = "";
+static const char rep732[] = "glXSwapBuffers(*display, window)";
+static const char rep733[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep734[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep735[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep736[] = "glxChooseVisual(*dpy, screen, *attriblist)";
+static const char rep737[] = "";
+static const char rep738[] = "";
+static const char rep739[] = "";
+static const char rep740[] = "";
+static const char rep741[] = "";
+static const char rep742[] = "";
+static const char rep743[] = "";
+static const char rep744[] = "";
+static const char rep745[] = "";
+static const char rep746[] = "";
+static const char rep747[] = "";
+static const char rep748[] = "";
+static const char rep749[] = "";
+static const char rep750[] = "";
+static const char rep751[] = "";
+static const char rep752[] = "";
+static const char rep753[] = "";
+static const char rep754[] = "";
+static const char rep755[] = "";
+static const char rep756[] = "";
+static const char rep757[] = "";
+static const char rep758[] = "";
+static const char rep759[] = "";
+static const char rep760[] = "";
+static const char rep761[] = "";
+static const char rep762[] = "";
+static const char rep763[] = "(glGetIntegerv(GL_MAX_LIGHTS, &tmp), tmp)";
+static const char rep764[] = "GL_FRONT";
+static const char rep765[] = "GL_BACK";
+static const char rep766[] = "GL_LIGHT7";
+static const char rep767[] = "GL_LIGHT6";
+static const char rep768[] = "GL_LIGHT5";
+static const char rep769[] = "GL_LIGHT4";
+static const char rep770[] = "GL_LIGHT3";
+static const char rep771[] = "GL_LIGHT2";
+static const char rep772[] = "GL_LIGHT1";
+static const char rep773[] = "GL_LIGHT0";
+static const char rep774[] = "";
+static const char rep775[] = "GL_LIGHT_MODEL_TWO_SIDE";
+static const char rep776[] = "GL_QUADRATIC_ATTENUATION";
+static const char rep777[] = "GL_CONSTANT_ATTENUATION";
+static const char rep778[] = "GL_LIGHT_MODEL_LOCAL_VIEWER";
+static const char rep779[] = "XXX_SPOTLIGHT";
+static const char rep780[] = "GL_POSITION";
+static const char rep781[] = "GL_DIFFUSE";
+static const char rep782[] = "GL_COLOR_INDEXES";
+static const char rep783[] = "XXX_ALPHA";
+static const char rep784[] = "GL_SHININESS";
+static const char rep785[] = "GL_SPECULAR";
+static const char rep786[] = "GL_DIFFUSE";
+static const char rep787[] = "GL_AMBIENT";
+static const char rep788[] = "GL_EMISSION";
+static const char rep789[] = "GL_SPOT_DIRECTION";
+static const char rep790[] = "if($2) {glCallList($2); glEnable($1);} else glDisable($1)";
+static const char rep791[] = "glNewList($2, GL_COMPILE); glMaterialf(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, *$4); glEndList();";
+static const char rep792[] = "mylmbind($1, $2)";
+static const char rep793[] = "mylmdef($1, $2, $3, $4)";
+
+static const RuleSegment segs[] = {
+    {rep0 + 0, 22, 0},
+    {rep1 + 0, 7, 0},
+    {rep2 + 0, 26, 0},
+    {rep3 + 0, 7, 0},
+    {rep4 + 0, 22, 0},
+    {rep5 + 0, 7, 0},
+    {rep6 + 0, 21, 0},
+    {rep7 + 0, 7, 0},
+    {rep8 + 0, 18, 0},
+    {rep9 + 0, 7, 0},
+    {rep10 + 0, 19, 0},
+    {rep11 + 0, 7, 0},
+    {rep12 + 0, 14, 0},
+    {rep13 + 0, 13, 0},
+    {rep14 + 0, 74, 0},
+    {rep15 + 0, 46, 0},
+    {rep16 + 0, 49, 0},
+    {rep17 + 0, 48, 0},
+    {rep18 + 0, 20, 0},
+    {rep19 + 0, 22, 0},
+    {rep20 + 0, 19, 0},
+    {rep21 + 0, 11, 0},
+    {rep22 + 0, 18, 0},
+    {rep23 + 0, 23, 0},
+    {rep24 + 0, 23, 0},
+    {rep25 + 0, 20, 0},
+    {rep26 + 0, 17, 0},
+    {rep27 + 0, 10, 0},
+    {rep28 + 0, 13, 0},
+    {rep29 + 0, 19, 0},
+    {rep30 + 0, 13, 0},
+    {rep31 + 0, 7, 0},
+    {rep32 + 0, 13, 0},
+    {rep33 + 0, 11, 0},
+    {rep34 + 0, 13, 0},
+    {rep35 + 0, 32, 0},
+    {rep36 + 0, 29, 0},
+    {rep37 + 0, 0, 0},
+    {rep38 + 0, 0, 0},
+    {rep39 + 0, 0, 0},
+    {rep40 + 0, 0, 0},
+    {rep41 + 0, 0, 0},
+    {rep42 + 0, 0, 0},
+    {rep43 + 0, 0, 0},
+    {rep44 + 0, 0, 0},
+    {rep45 + 0, 0, 0},
+    {rep46 + 0, 0, 0},
+    {rep47 + 0, 0, 0},
+    {rep48 + 0, 0, 0},
+    {rep49 + 0, 0, 0},
+    {rep50 + 0, 0, 0},
+    {rep51 + 0, 0, 0},
+    {rep52 + 0, 0, 0},
+    {rep53 + 0, 0, 0},
+    {rep54 + 0, 0, 0},
+    {rep55 + 0, 0, 0},
+    {rep56 + 0, 0, 0},
+    {rep57 + 0, 0, 0},
+    {rep58 + 0, 0, 0},
+    {rep59 + 0, 0, 0},
+    {rep60 + 0, 0, 0},
+    {rep61 + 0, 0, 0},
+    {rep62 + 0, 0, 0},
+    {rep63 + 0, 0, 0},
+    {rep64 + 0, 0, 0},
+    {rep65 + 0, 0, 0},
+    {rep66 + 0, 0, 0},
+    {rep67 + 0, 0, 0},
+    {rep68 + 0, 0, 0},
+    {rep69 + 0, 0, 0},
+    {rep70 + 0, 0, 0},
+    {rep71 + 0, 0, 0},
+    {rep72 + 0, 0, 0},
+    {rep73 + 0, 0, 0},
+    {rep74 + 0, 0, 0},
+    {rep75 + 0, 0, 0},
+    {rep76 + 0, 0, 0},
+    {rep77 + 0, 0, 0},
+    {rep78 + 0, 0, 0},
+    {rep79 + 0, 0, 0},
+    {rep80 + 0, 0, 0},
+    {rep81 + 0, 0, 0},
+    {rep82 + 0, 0, 0},
+    {rep83 + 0, 0, 0},
+    {rep84 + 0, 0, 0},
+    {rep85 + 0, 0, 0},
+    {rep86 + 0, 0, 0},
+    {rep87 + 0, 0, 0},
+    {rep88 + 0, 0, 0},
+    {rep89 + 0, 0, 0},
+    {rep90 + 0, 0, 0},
+    {rep91 + 0, 0, 0},
+    {rep92 + 0, 0, 0},
+    {rep93 + 0, 0, 0},
+    {rep94 + 0, 0, 0},
+    {rep95 + 0, 0, 0},
+    {rep96 + 0, 0, 0},
+    {rep97 + 0, 0, 0},
+    {rep98 + 0, 0, 0},
+    {rep99 + 0, 0, 0},
+    {rep100 + 0, 0, 0},
+    {rep101 + 0, 0, 0},
+    {rep102 + 0, 0, 0},
+    {rep103 + 0, 0, 0},
+    {rep104 + 0, 0, 0},
+    {rep105 + 0, 0, 0},
+    {rep106 + 0, 0, 0},
+    {rep107 + 0, 0, 0},
+    {rep108 + 0, 0, 0},
+    {rep109 + 0, 0, 0},
+    {rep110 + 0, 0, 0},
+    {rep111 + 0, 0, 0},
+    {rep112 + 0, 0, 0},
+    {rep113 + 0, 0, 0},
+    {rep114 + 0, 0, 0},
+    {rep115 + 0, 0, 0},
+    {rep116 + 0, 0, 0},
+    {rep117 + 0, 0, 0},
+    {rep118 + 0, 0, 0},
+    {rep119 + 0, 11, 1},
+    {rep119 + 13, 1, 0},
+    {rep120 + 0, 11, 1},
+    {rep120 + 13, 1, 0},
+    {rep121 + 0, 11, 1},
+    {rep121 + 13, 1, 0},
+    {rep122 + 0, 11, 1},
+    {rep122 + 13, 1, 0},
+    {rep123 + 0, 11, 1},
+    {rep123 + 13, 1, 0},
+    {rep124 + 0, 11, 1},
+    {rep124 + 13, 1, 0},
+    {rep125 + 0, 12, 1},
+    {rep125 + 14, 1, 0},
+    {rep126 + 0, 12, 1},
+    {rep126 + 14, 1, 0},
+    {rep127 + 0, 12, 1},
+    {rep127 + 14, 1, 0},
+    {rep128 + 0, 12, 1},
+    {rep128 + 14, 1, 0},
+    {rep129 + 0, 12, 1},
+    {rep129 + 14, 1, 0},
+    {rep130 + 0, 12, 1},
+    {rep130 + 14, 1, 0},
+    {rep131 + 0, 12, 1},
+    {rep131 + 14, 1, 0},
+    {rep132 + 0, 12, 1},
+    {rep132 + 14, 1, 0},
+    {rep133 + 0, 12, 1},
+    {rep133 + 14, 1, 0},
+    {rep134 + 0, 12, 1},
+    {rep134 + 14, 1, 0},
+    {rep135 + 0, 12, 1},
+    {rep135 + 14, 1, 0},
+    {rep136 + 0, 12, 1},
+    {rep136 + 14, 1, 0},
+    {rep137 + 0, 12, 1},
+    {rep137 + 14, 1, 0},
+    {rep138 + 0, 14, 1},
+    {rep138 + 16, 1, 0},
+    {rep139 + 0, 14, 1},
+    {rep139 + 16, 1, 0},
+    {rep140 + 0, 14, 1},
+    {rep140 + 16, 1, 0},
+    {rep141 + 0, 14, 1},
+    {rep141 + 16, 1, 0},
+    {rep142 + 0, 14, 1},
+    {rep142 + 16, 1, 0},
+    {rep143 + 0, 13, 1},
+    {rep143 + 15, 2, 2},
+    {rep143 + 19, 2, 3},
+    {rep143 + 23, 1, 0},
+    {rep144 + 0, 14, 1},
+    {rep144 + 16, 1, 0},
+    {rep145 + 0, 14, 1},
+    {rep145 + 16, 1, 0},
+    {rep146 + 0, 11, 1},
+    {rep146 + 13, 2, 2},
+    {rep146 + 17, 2, 3},
+    {rep146 + 21, 1, 0},
+    {rep147 + 0, 12, 1},
+    {rep147 + 14, 1, 0},
+    {rep148 + 0, 12, 1},
+    {rep148 + 14, 2, 2},
+    {rep148 + 18, 7, 1},
+    {rep148 + 27, 16, 2},
+    {rep148 + 45, 57, 0},
+    {rep149 + 0, 11, 1},
+    {rep149 + 13, 1, 0},
+    {rep150 + 0, 19, 1},
+    {rep150 + 21, 21, 1},
+    {rep150 + 44, 1, 0},
+    {rep151 + 0, 14, 1},
+    {rep151 + 16, 2, 2},
+    {rep151 + 20, 2, 3},
+    {rep151 + 24, 1, 0},
+    {rep152 + 0, 14, 1},
+    {rep152 + 16, 2, 2},
+    {rep152 + 20, 1, 0},
+    {rep153 + 0, 14, 1},
+    {rep153 + 16, 2, 2},
+    {rep153 + 20, 1, 0},
+    {rep154 + 0, 14, 1},
+    {rep154 + 16, 2, 2},
+    {rep154 + 20, 1, 0},
+    {rep155 + 0, 14, 1},
+    {rep155 + 16, 2, 2},
+    {rep155 + 20, 2, 3},
+    {rep155 + 24, 1, 0},
+    {rep156 + 0, 14, 1},
+    {rep156 + 16, 2, 2},
+    {rep156 + 20, 2, 3},
+    {rep156 + 24, 1, 0},
+    {rep157 + 0, 9, 1},
+    {rep157 + 11, 1, 0},
+    {rep158 + 0, 9, 1},
+    {rep158 + 11, 1, 0},
+    {rep159 + 0, 9, 1},
+    {rep159 + 11, 1, 0},
+    {rep160 + 0, 17, 0},
+    {rep161 + 0, 12, 2},
+    {rep161 + 14, 3, 1},
+    {rep161 + 19, 13, 2},
+    {rep161 + 34, 67, 0},
+    {rep162 + 0, 8, 1},
+    {rep162 + 10, 2, 2},
+    {rep162 + 14, 1, 0},
+    {rep163 + 0, 71, 1},
+    {rep163 + 73, 21, 2},
+    {rep163 + 96, 20, 0},
+    {rep164 + 0, 3, 1},
+    {rep164 + 5, 58, 0},
+    {rep165 + 0, 3, 1},
+    {rep165 + 5, 58, 0},
+    {rep166 + 0, 3, 1},
+    {rep166 + 5, 64, 0},
+    {rep167 + 0, 113, 1},
+    {rep167 + 115, 2, 2},
+    {rep167 + 119, 34, 3},
+    {rep167 + 155, 10, 4},
+    {rep167 + 167, 8, 5},
+    {rep167 + 177, 3, 4},
+    {rep167 + 182, 48, 0},
+    {rep168 + 0, 113, 1},
+    {rep168 + 115, 2, 2},
+    {rep168 + 119, 33, 3},
+    {rep168 + 154, 10, 4},
+    {rep168 + 166, 8, 5},
+    {rep168 + 176, 3, 4},
+    {rep168 + 181, 48, 0},
+    {rep169 + 0, 113, 1},
+    {rep169 + 115, 2, 2},
+    {rep169 + 119, 33, 3},
+    {rep169 + 154, 10, 4},
+    {rep169 + 166, 8, 5},
+    {rep169 + 176, 3, 4},
+    {rep169 + 181, 48, 0},
+    {rep170 + 0, 70, 1},
+    {rep170 + 72, 2, 2},
+    {rep170 + 76, 33, 3},
+    {rep170 + 111, 10, 4},
+    {rep170 + 123, 8, 5},
+    {rep170 + 133, 3, 4},
+    {rep170 + 138, 48, 0},
+    {rep171 + 0, 70, 1},
+    {rep171 + 72, 2, 2},
+    {rep171 + 76, 33, 3},
+    {rep171 + 111, 10, 4},
+    {rep171 + 123, 8, 5},
+    {rep171 + 133, 3, 4},
+    {rep171 + 138, 48, 0},
+    {rep172 + 0, 70, 1},
+    {rep172 + 72, 2, 2},
+    {rep172 + 76, 33, 3},
+    {rep172 + 111, 10, 4},
+    {rep172 + 123, 8, 5},
+    {rep172 + 133, 3, 4},
+    {rep172 + 138, 48, 0},
+    {rep173 + 0, 112, 1},
+    {rep173 + 114, 2, 2},
+    {rep173 + 118, 26, 3},
+    {rep173 + 146, 50, 0},
+    {rep174 + 0, 112, 1},
+    {rep174 + 114, 2, 2},
+    {rep174 + 118, 26, 3},
+    {rep174 + 146, 50, 0},
+    {rep175 + 0, 112, 1},
+    {rep175 + 114, 2, 2},
+    {rep175 + 118, 26, 3},
+    {rep175 + 146, 50, 0},
+    {rep176 + 0, 69, 1},
+    {rep176 + 71, 2, 2},
+    {rep176 + 75, 26, 3},
+    {rep176 + 103, 50, 0},
+    {rep177 + 0, 69, 1},
+    {rep177 + 71, 2, 2},
+    {rep177 + 75, 26, 3},
+    {rep177 + 103, 50, 0},
+    {rep178 + 0, 69, 1},
+    {rep178 + 71, 2, 2},
+    {rep178 + 75, 26, 3},
+    {rep178 + 103, 50, 0},
+    {rep179 + 0, 11, 1},
+    {rep179 + 13, 1, 0},
+    {rep180 + 0, 29, 1},
+    {rep180 + 31, 18, 2},
+    {rep180 + 51, 26, 1},
+    {rep180 + 79, 35, 1},
+    {rep180 + 116, 2, 0},
+    {rep181 + 0, 14, 1},
+    {rep181 + 16, 2, 0},
+    {rep182 + 0, 18, 0},
+    {rep183 + 0, 30, 0},
+    {rep184 + 0, 29, 0},
+    {rep185 + 0, 29, 0},
+    {rep186 + 0, 13, 2},
+    {rep186 + 15, 25, 1},
+    {rep186 + 42, 24, 1},
+    {rep186 + 68, 26, 1},
+    {rep186 + 96, 27, 1},
+    {rep186 + 125, 67, 0},
+    {rep187 + 0, 10, 1},
+    {rep187 + 12, 36, 2},
+    {rep187 + 50, 14, 0},
+    {rep188 + 0, 3, 1},
+    {rep188 + 5, 14, 1},
+    {rep188 + 21, 62, 0},
+    {rep189 + 0, 10, 1},
+    {rep189 + 12, 37, 3},
+    {rep189 + 51, 15, 0},
+    {rep190 + 0, 42, 0},
+    {rep191 + 0, 15, 1},
+    {rep191 + 17, 4, 0},
+    {rep192 + 0, 3, 1},
+    {rep192 + 5, 48, 0},
+    {rep193 + 0, 46, 0},
+    {rep194 + 0, 46, 0},
+    {rep195 + 0, 144, 0},
+    {rep196 + 0, 17, 2},
+    {rep196 + 19, 15, 1},
+    {rep196 + 36, 29, 0},
+    {rep197 + 0, 8, 1},
+    {rep197 + 10, 2, 2},
+    {rep197 + 14, 6, 1},
+    {rep197 + 22, 42, 0},
+    {rep198 + 0, 14, 1},
+    {rep198 + 16, 23, 0},
+    {rep199 + 0, 14, 1},
+    {rep199 + 16, 23, 0},
+    {rep200 + 0, 12, 1},
+    {rep200 + 14, 26, 1},
+    {rep200 + 42, 50, 0},
+    {rep201 + 0, 13, 1},
+    {rep201 + 15, 26, 1},
+    {rep201 + 43, 50, 0},
+    {rep202 + 0, 11, 1},
+    {rep202 + 13, 2, 2},
+    {rep202 + 17, 2, 3},
+    {rep202 + 21, 1, 0},
+    {rep203 + 0, 11, 1},
+    {rep203 + 13, 2, 2},
+    {rep203 + 17, 1, 0},
+    {rep204 + 0, 11, 1},
+    {rep204 + 13, 2, 2},
+    {rep204 + 17, 1, 0},
+    {rep205 + 0, 11, 1},
+    {rep205 + 13, 2, 2},
+    {rep205 + 17, 1, 0},
+    {rep206 + 0, 11, 1},
+    {rep206 + 13, 2, 2},
+    {rep206 + 17, 2, 3},
+    {rep206 + 21, 1, 0},
+    {rep207 + 0, 11, 1},
+    {rep207 + 13, 2, 2},
+    {rep207 + 17, 2, 3},
+    {rep207 + 21, 1, 0},
+    {rep208 + 0, 35, 1},
+    {rep208 + 37, 2, 2},
+    {rep208 + 41, 2, 3},
+    {rep208 + 45, 1, 0},
+    {rep209 + 0, 35, 1},
+    {rep209 + 37, 2, 2},
+    {rep209 + 41, 1, 0},
+    {rep210 + 0, 35, 1},
+    {rep210 + 37, 2, 2},
+    {rep210 + 41, 1, 0},
+    {rep211 + 0, 35, 1},
+    {rep211 + 37, 2, 2},
+    {rep211 + 41, 1, 0},
+    {rep212 + 0, 35, 1},
+    {rep212 + 37, 2, 2},
+    {rep212 + 41, 2, 3},
+    {rep212 + 45, 1, 0},
+    {rep213 + 0, 35, 1},
+    {rep213 + 37, 2, 2},
+    {rep213 + 41, 2, 3},
+    {rep213 + 45, 1, 0},
+    {rep214 + 0, 45, 0},
+    {rep215 + 0, 22, 0},
+    {rep216 + 0, 15, 1},
+    {rep216 + 17, 17, 0},
+    {rep217 + 0, 15, 1},
+    {rep217 + 17, 17, 0},
+    {rep218 + 0, 33, 1},
+    {rep218 + 35, 1, 0},
+    {rep219 + 0, 46, 0},
+    {rep220 + 0, 41, 0},
+    {rep221 + 0, 42, 0},
+    {rep222 + 0, 25, 0},
+    {rep223 + 0, 42, 0},
+    {rep224 + 0, 54, 1},
+    {rep224 + 56, 11, 2},
+    {rep224 + 69, 20, 3},
+    {rep224 + 91, 11, 4},
+    {rep224 + 104, 19, 0},
+    {rep225 + 0, 42, 0},
+    {rep226 + 0, 49, 1},
+    {rep226 + 51, 11, 2},
+    {rep226 + 64, 20, 3},
+    {rep226 + 86, 11, 4},
+    {rep226 + 99, 19, 0},
+    {rep227 + 0, 107, 0},
+    {rep228 + 0, 26, 0},
+    {rep229 + 0, 9, 0},
+    {rep230 + 0, 52, 1},
+    {rep230 + 54, 11, 2},
+    {rep230 + 67, 11, 3},
+    {rep230 + 80, 10, 0},
+    {rep231 + 0, 60, 1},
+    {rep231 + 62, 11, 2},
+    {rep231 + 75, 11, 3},
+    {rep231 + 88, 10, 0},
+    {rep232 + 0, 15, 2},
+    {rep232 + 17, 2, 1},
+    {rep232 + 21, 26, 0},
+    {rep233 + 0, 9, 1},
+    {rep233 + 11, 1, 0},
+    {rep234 + 0, 20, 2},
+    {rep234 + 22, 3, 1},
+    {rep234 + 27, 2, 2},
+    {rep234 + 31, 1, 0},
+    {rep235 + 0, 12, 1},
+    {rep235 + 14, 1, 0},
+    {rep236 + 0, 22, 1},
+    {rep236 + 24, 2, 0},
+    {rep237 + 0, 41, 0},
+    {rep238 + 0, 35, 1},
+    {rep238 + 37, 29, 0},
+    {rep239 + 0, 13, 1},
+    {rep239 + 15, 1, 0},
+    {rep240 + 0, 11, 1},
+    {rep240 + 13, 1, 0},
+    {rep241 + 0, 10, 1},
+    {rep241 + 12, 6, 1},
+    {rep241 + 20, 63, 0},
+    {rep242 + 0, 10, 1},
+    {rep242 + 12, 2, 2},
+    {rep242 + 16, 2, 3},
+    {rep242 + 20, 2, 4},
+    {rep242 + 24, 2, 5},
+    {rep242 + 28, 2, 6},
+    {rep242 + 32, 6, 7},
+    {rep242 + 40, 7, 7},
+    {rep242 + 49, 7, 7},
+    {rep242 + 58, 2, 0},
+    {rep243 + 0, 13, 1},
+    {rep243 + 15, 2, 2},
+    {rep243 + 19, 3, 3},
+    {rep243 + 24, 3, 1},
+    {rep243 + 29, 6, 4},
+    {rep243 + 37, 3, 2},
+    {rep243 + 42, 23, 5},
+    {rep243 + 67, 1, 0},
+    {rep244 + 0, 13, 1},
+    {rep244 + 15, 2, 2},
+    {rep244 + 19, 3, 3},
+    {rep244 + 24, 3, 1},
+    {rep244 + 29, 6, 4},
+    {rep244 + 37, 3, 2},
+    {rep244 + 42, 31, 5},
+    {rep244 + 75, 1, 0},
+    {rep245 + 0, 14, 1},
+    {rep245 + 16, 2, 2},
+    {rep245 + 20, 16, 3},
+    {rep245 + 38, 3, 1},
+    {rep245 + 43, 6, 4},
+    {rep245 + 51, 3, 2},
+    {rep245 + 56, 23, 5},
+    {rep245 + 81, 1, 0},
+    {rep246 + 0, 14, 1},
+    {rep246 + 16, 2, 2},
+    {rep246 + 20, 16, 3},
+    {rep246 + 38, 3, 1},
+    {rep246 + 43, 6, 4},
+    {rep246 + 51, 3, 2},
+    {rep246 + 56, 31, 5},
+    {rep246 + 89, 1, 0},
+    {rep247 + 0, 13, 1},
+    {rep247 + 15, 2, 2},
+    {rep247 + 19, 1, 0},
+    {rep248 + 0, 13, 1},
+    {rep248 + 15, 2, 2},
+    {rep248 + 19, 1, 0},
+    {rep249 + 0, 14, 1},
+    {rep249 + 16, 10, 0},
+    {rep250 + 0, 43, 0},
+    {rep251 + 0, 10, 1},
+    {rep251 + 12, 13, 0},
+    {rep252 + 0, 15, 0},
+    {rep253 + 0, 15, 0},
+    {rep254 + 0, 13, 1},
+    {rep254 + 15, 1, 0},
+    {rep255 + 0, 3, 1},
+    {rep255 + 5, 54, 0},
+    {rep256 + 0, 45, 0},
+    {rep257 + 0, 21, 1},
+    {rep257 + 23, 2, 2},
+    {rep257 + 27, 2, 3},
+    {rep257 + 31, 2, 4},
+    {rep257 + 35, 2, 5},
+    {rep257 + 39, 2, 6},
+    {rep257 + 43, 1, 0},
+    {rep258 + 0, 23, 1},
+    {rep258 + 25, 2, 2},
+    {rep258 + 29, 2, 3},
+    {rep258 + 33, 2, 4},
+    {rep258 + 37, 2, 5},
+    {rep258 + 41, 2, 6},
+    {rep258 + 45, 2, 7},
+    {rep258 + 49, 2, 8},
+    {rep258 + 53, 2, 9},
+    {rep258 + 57, 2, 10},
+    {rep258 + 61, 1, 0},
+    {rep259 + 0, 19, 1},
+    {rep259 + 21, 2, 2},
+    {rep259 + 25, 9, 1},
+    {rep259 + 36, 2, 2},
+    {rep259 + 40, 2, 0},
+    {rep260 + 0, 99, 1},
+    {rep260 + 101, 2, 2},
+    {rep260 + 105, 2, 3},
+    {rep260 + 109, 2, 4},
+    {rep260 + 113, 2, 5},
+    {rep260 + 117, 2, 6},
+    {rep260 + 121, 20, 0},
+    {rep261 + 0, 102, 1},
+    {rep261 + 104, 2, 2},
+    {rep261 + 108, 2, 3},
+    {rep261 + 112, 2, 4},
+    {rep261 + 116, 20, 0},
+    {rep262 + 0, 42, 0},
+    {rep263 + 0, 42, 0},
+    {rep264 + 0, 14, 1},
+    {rep264 + 16, 1, 0},
+    {rep265 + 0, 11, 1},
+    {rep265 + 13, 2, 2},
+    {rep265 + 17, 2, 3},
+    {rep265 + 21, 1, 0},
+    {rep266 + 0, 11, 1},
+    {rep266 + 13, 2, 2},
+    {rep266 + 17, 2, 3},
+    {rep266 + 21, 1, 0},
+    {rep267 + 0, 11, 1},
+    {rep267 + 13, 2, 2},
+    {rep267 + 17, 2, 3},
+    {rep267 + 21, 1, 0},
+    {rep268 + 0, 11, 1},
+    {rep268 + 13, 2, 2},
+    {rep268 + 17, 1, 0},
+    {rep269 + 0, 11, 1},
+    {rep269 + 13, 2, 2},
+    {rep269 + 17, 1, 0},
+    {rep270 + 0, 11, 1},
+    {rep270 + 13, 2, 2},
+    {rep270 + 17, 1, 0},
+    {rep271 + 0, 31, 1},
+    {rep271 + 33, 2, 2},
+    {rep271 + 37, 2, 3},
+    {rep271 + 41, 1, 0},
+    {rep272 + 0, 31, 1},
+    {rep272 + 33, 2, 2},
+    {rep272 + 37, 2, 3},
+    {rep272 + 41, 1, 0},
+    {rep273 + 0, 31, 1},
+    {rep273 + 33, 2, 2},
+    {rep273 + 37, 2, 3},
+    {rep273 + 41, 1, 0},
+    {rep274 + 0, 31, 1},
+    {rep274 + 33, 2, 2},
+    {rep274 + 37, 1, 0},
+    {rep275 + 0, 31, 1},
+    {rep275 + 33, 2, 2},
+    {rep275 + 37, 1, 0},
+    {rep276 + 0, 31, 1},
+    {rep276 + 33, 2, 2},
+    {rep276 + 37, 1, 0},
+    {rep277 + 0, 109, 1},
+    {rep277 + 111, 3, 2},
+    {rep277 + 116, 2, 3},
+    {rep277 + 120, 2, 4},
+    {rep277 + 124, 20, 0},
+    {rep278 + 0, 15, 2},
+    {rep278 + 17, 2, 1},
+    {rep278 + 21, 116, 0},
+    {rep279 + 0, 20, 1},
+    {rep279 + 22, 2, 2},
+    {rep279 + 26, 11, 0},
+    {rep280 + 0, 16, 1},
+    {rep280 + 18, 2, 2},
+    {rep280 + 22, 1, 0},
+    {rep281 + 0, 16, 1},
+    {rep281 + 18, 2, 2},
+    {rep281 + 22, 1, 0},
+    {rep282 + 0, 30, 1},
+    {rep282 + 32, 2, 2},
+    {rep282 + 36, 2, 3},
+    {rep282 + 40, 9, 0},
+    {rep283 + 0, 30, 1},
+    {rep283 + 32, 2, 2},
+    {rep283 + 36, 2, 3},
+    {rep283 + 40, 9, 0},
+    {rep284 + 0, 30, 1},
+    {rep284 + 32, 2, 2},
+    {rep284 + 36, 2, 3},
+    {rep284 + 40, 9, 0},
+    {rep285 + 0, 30, 1},
+    {rep285 + 32, 2, 2},
+    {rep285 + 36, 9, 0},
+    {rep286 + 0, 30, 1},
+    {rep286 + 32, 2, 2},
+    {rep286 + 36, 9, 0},
+    {rep287 + 0, 30, 1},
+    {rep287 + 32, 2, 2},
+    {rep287 + 36, 9, 0},
+    {rep288 + 0, 22, 1},
+    {rep288 + 24, 2, 0},
+    {rep289 + 0, 22, 1},
+    {rep289 + 24, 2, 0},
+    {rep290 + 0, 4, 1},
+    {rep290 + 6, 61, 0},
+    {rep291 + 0, 44, 1},
+    {rep291 + 46, 19, 2},
+    {rep291 + 67, 16, 0},
+    {rep292 + 0, 44, 1},
+    {rep292 + 46, 19, 2},
+    {rep292 + 67, 16, 0},
+    {rep293 + 0, 44, 1},
+    {rep293 + 46, 19, 2},
+    {rep293 + 67, 16, 0},
+    {rep294 + 0, 44, 1},
+    {rep294 + 46, 19, 2},
+    {rep294 + 67, 16, 0},
+    {rep295 + 0, 44, 1},
+    {rep295 + 46, 19, 2},
+    {rep295 + 67, 16, 0},
+    {rep296 + 0, 44, 1},
+    {rep296 + 46, 19, 2},
+    {rep296 + 67, 16, 0},
+    {rep297 + 0, 46, 1},
+    {rep297 + 48, 19, 2},
+    {rep297 + 69, 16, 0},
+    {rep298 + 0, 46, 1},
+    {rep298 + 48, 19, 2},
+    {rep298 + 69, 16, 0},
+    {rep299 + 0, 46, 1},
+    {rep299 + 48, 19, 2},
+    {rep299 + 69, 16, 0},
+    {rep300 + 0, 46, 1},
+    {rep300 + 48, 19, 2},
+    {rep300 + 69, 16, 0},
+    {rep301 + 0, 46, 1},
+    {rep301 + 48, 19, 2},
+    {rep301 + 69, 16, 0},
+    {rep302 + 0, 46, 1},
+    {rep302 + 48, 19, 2},
+    {rep302 + 69, 16, 0},
+    {rep303 + 0, 33, 1},
+    {rep303 + 35, 1, 0},
+    {rep304 + 0, 4, 1},
+    {rep304 + 6, 65, 0},
+    {rep305 + 0, 11, 1},
+    {rep305 + 13, 1, 0},
+    {rep306 + 0, 19, 1},
+    {rep306 + 21, 2, 2},
+    {rep306 + 25, 2, 3},
+    {rep306 + 29, 2, 4},
+    {rep306 + 33, 1, 0},
+    {rep307 + 0, 11, 1},
+    {rep307 + 13, 2, 2},
+    {rep307 + 17, 2, 3},
+    {rep307 + 21, 1, 0},
+    {rep308 + 0, 11, 1},
+    {rep308 + 13, 2, 2},
+    {rep308 + 17, 1, 0},
+    {rep309 + 0, 11, 1},
+    {rep309 + 13, 2, 2},
+    {rep309 + 17, 1, 0},
+    {rep310 + 0, 11, 1},
+    {rep310 + 13, 2, 2},
+    {rep310 + 17, 1, 0},
+    {rep311 + 0, 11, 1},
+    {rep311 + 13, 2, 2},
+    {rep311 + 17, 2, 3},
+    {rep311 + 21, 1, 0},
+    {rep312 + 0, 11, 1},
+    {rep312 + 13, 2, 2},
+    {rep312 + 17, 2, 3},
+    {rep312 + 21, 1, 0},
+    {rep313 + 0, 13, 1},
+    {rep313 + 15, 2, 2},
+    {rep313 + 19, 3, 3},
+    {rep313 + 24, 3, 1},
+    {rep313 + 29, 6, 4},
+    {rep313 + 37, 3, 2},
+    {rep313 + 42, 23, 5},
+    {rep313 + 67, 1, 0},
+    {rep314 + 0, 85, 1},
+    {rep314 + 87, 32, 0},
+    {rep315 + 0, 87, 1},
+    {rep315 + 89, 26, 2},
+    {rep315 + 117, 3, 0},
+    {rep316 + 0, 13, 1},
+    {rep316 + 15, 1, 0},
+    {rep317 + 0, 51, 1},
+    {rep317 + 53, 2, 2},
+    {rep317 + 57, 2, 3},
+    {rep317 + 61, 2, 4},
+    {rep317 + 65, 44, 0},
+    {rep318 + 0, 51, 1},
+    {rep318 + 53, 2, 2},
+    {rep318 + 57, 2, 3},
+    {rep318 + 61, 2, 4},
+    {rep318 + 65, 44, 0},
+    {rep319 + 0, 51, 1},
+    {rep319 + 53, 2, 2},
+    {rep319 + 57, 2, 3},
+    {rep319 + 61, 2, 4},
+    {rep319 + 65, 44, 0},
+    {rep320 + 0, 8, 1},
+    {rep320 + 10, 2, 2},
+    {rep320 + 14, 2, 3},
+    {rep320 + 18, 2, 4},
+    {rep320 + 22, 1, 0},
+    {rep321 + 0, 8, 1},
+    {rep321 + 10, 2, 2},
+    {rep321 + 14, 2, 3},
+    {rep321 + 18, 2, 4},
+    {rep321 + 22, 1, 0},
+    {rep322 + 0, 8, 1},
+    {rep322 + 10, 2, 2},
+    {rep322 + 14, 2, 3},
+    {rep322 + 18, 2, 4},
+    {rep322 + 22, 1, 0},
+    {rep323 + 0, 50, 1},
+    {rep323 + 52, 2, 2},
+    {rep323 + 56, 2, 3},
+    {rep323 + 60, 2, 4},
+    {rep323 + 64, 44, 0},
+    {rep324 + 0, 51, 1},
+    {rep324 + 53, 2, 2},
+    {rep324 + 57, 2, 3},
+    {rep324 + 61, 2, 4},
+    {rep324 + 65, 44, 0},
+    {rep325 + 0, 51, 1},
+    {rep325 + 53, 2, 2},
+    {rep325 + 57, 2, 3},
+    {rep325 + 61, 2, 4},
+    {rep325 + 65, 44, 0},
+    {rep326 + 0, 7, 1},
+    {rep326 + 9, 2, 2},
+    {rep326 + 13, 2, 3},
+    {rep326 + 17, 2, 4},
+    {rep326 + 21, 1, 0},
+    {rep327 + 0, 8, 1},
+    {rep327 + 10, 2, 2},
+    {rep327 + 14, 2, 3},
+    {rep327 + 18, 2, 4},
+    {rep327 + 22, 1, 0},
+    {rep328 + 0, 8, 1},
+    {rep328 + 10, 2, 2},
+    {rep328 + 14, 2, 3},
+    {rep328 + 18, 2, 4},
+    {rep328 + 22, 1, 0},
+    {rep329 + 0, 14, 5},
+    {rep329 + 16, 2, 6},
+    {rep329 + 20, 15, 1},
+    {rep329 + 37, 2, 2},
+    {rep329 + 41, 2, 3},
+    {rep329 + 45, 1, 1},
+    {rep329 + 48, 4, 4},
+    {rep329 + 54, 1, 2},
+    {rep329 + 57, 13, 0},
+    {rep330 + 0, 12, 1},
+    {rep330 + 14, 2, 2},
+    {rep330 + 18, 1, 0},
+    {rep331 + 0, 12, 1},
+    {rep331 + 14, 2, 2},
+    {rep331 + 18, 2, 3},
+    {rep331 + 22, 10, 0},
+    {rep332 + 0, 30, 1},
+    {rep332 + 32, 2, 2},
+    {rep332 + 36, 2, 3},
+    {rep332 + 40, 1, 0},
+    {rep333 + 0, 30, 1},
+    {rep333 + 32, 2, 2},
+    {rep333 + 36, 1, 0},
+    {rep334 + 0, 30, 1},
+    {rep334 + 32, 2, 2},
+    {rep334 + 36, 1, 0},
+    {rep335 + 0, 30, 1},
+    {rep335 + 32, 2, 2},
+    {rep335 + 36, 1, 0},
+    {rep336 + 0, 30, 1},
+    {rep336 + 32, 2, 2},
+    {rep336 + 36, 2, 3},
+    {rep336 + 40, 1, 0},
+    {rep337 + 0, 30, 1},
+    {rep337 + 32, 2, 2},
+    {rep337 + 36, 2, 3},
+    {rep337 + 40, 1, 0},
+    {rep338 + 0, 10, 1},
+    {rep338 + 12, 3, 2},
+    {rep338 + 17, 9, 2},
+    {rep338 + 28, 9, 2},
+    {rep338 + 39, 9, 2},
+    {rep338 + 50, 9, 2},
+    {rep338 + 61, 9, 2},
+    {rep338 + 72, 7, 0},
+    {rep339 + 0, 14, 1},
+    {rep339 + 16, 4, 2},
+    {rep339 + 22, 9, 2},
+    {rep339 + 33, 9, 2},
+    {rep339 + 44, 9, 2},
+    {rep339 + 55, 9, 2},
+    {rep339 + 66, 9, 2},
+    {rep339 + 77, 7, 0},
+    {rep340 + 0, 11, 1},
+    {rep340 + 13, 2, 2},
+    {rep340 + 17, 2, 3},
+    {rep340 + 21, 1, 0},
+    {rep341 + 0, 11, 1},
+    {rep341 + 13, 2, 2},
+    {rep341 + 17, 2, 3},
+    {rep341 + 21, 1, 0},
+    {rep342 + 0, 11, 1},
+    {rep342 + 13, 2, 2},
+    {rep342 + 17, 2, 3},
+    {rep342 + 21, 1, 0},
+    {rep343 + 0, 11, 1},
+    {rep343 + 13, 2, 2},
+    {rep343 + 17, 1, 0},
+    {rep344 + 0, 11, 1},
+    {rep344 + 13, 2, 2},
+    {rep344 + 17, 1, 0},
+    {rep345 + 0, 11, 1},
+    {rep345 + 13, 2, 2},
+    {rep345 + 17, 1, 0},
+    {rep346 + 0, 31, 1},
+    {rep346 + 33, 2, 2},
+    {rep346 + 37, 2, 3},
+    {rep346 + 41, 1, 0},
+    {rep347 + 0, 31, 1},
+    {rep347 + 33, 2, 2},
+    {rep347 + 37, 2, 3},
+    {rep347 + 41, 1, 0},
+    {rep348 + 0, 31, 1},
+    {rep348 + 33, 2, 2},
+    {rep348 + 37, 2, 3},
+    {rep348 + 41, 1, 0},
+    {rep349 + 0, 31, 1},
+    {rep349 + 33, 2, 2},
+    {rep349 + 37, 1, 0},
+    {rep350 + 0, 31, 1},
+    {rep350 + 33, 2, 2},
+    {rep350 + 37, 1, 0},
+    {rep351 + 0, 31, 1},
+    {rep351 + 33, 2, 2},
+    {rep351 + 37, 1, 0},
+    {rep352 + 0, 9, 1},
+    {rep352 + 11, 2, 2},
+    {rep352 + 15, 2, 3},
+    {rep352 + 19, 1, 0},
+    {rep353 + 0, 15, 1},
+    {rep353 + 17, 32, 0},
+    {rep354 + 0, 10, 1},
+    {rep354 + 12, 2, 2},
+    {rep354 + 16, 2, 3},
+    {rep354 + 20, 2, 4},
+    {rep354 + 24, 28, 0},
+    {rep355 + 0, 24, 1},
+    {rep355 + 26, 2, 2},
+    {rep355 + 30, 1, 0},
+    {rep356 + 0, 3, 1},
+    {rep356 + 5, 14, 1},
+    {rep356 + 21, 68, 0},
+    {rep357 + 0, 13, 1},
+    {rep357 + 15, 1, 0},
+    {rep358 + 0, 44, 1},
+    {rep358 + 46, 19, 2},
+    {rep358 + 67, 16, 0},
+    {rep359 + 0, 44, 1},
+    {rep359 + 46, 19, 2},
+    {rep359 + 67, 16, 0},
+    {rep360 + 0, 44, 1},
+    {rep360 + 46, 19, 2},
+    {rep360 + 67, 16, 0},
+    {rep361 + 0, 44, 1},
+    {rep361 + 46, 19, 2},
+    {rep361 + 67, 16, 0},
+    {rep362 + 0, 44, 1},
+    {rep362 + 46, 19, 2},
+    {rep362 + 67, 16, 0},
+    {rep363 + 0, 44, 1},
+    {rep363 + 46, 19, 2},
+    {rep363 + 67, 16, 0},
+    {rep364 + 0, 3, 1},
+    {rep364 + 5, 44, 3},
+    {rep364 + 51, 2, 2},
+    {rep364 + 55, 2, 4},
+    {rep364 + 59, 15, 5},
+    {rep364 + 76, 2, 6},
+    {rep364 + 80, 2, 7},
+    {rep364 + 84, 36, 0},
+    {rep365 + 0, 24, 1},
+    {rep365 + 26, 3, 0},
+    {rep366 + 0, 14, 1},
+    {rep366 + 16, 1, 0},
+    {rep367 + 0, 11, 1},
+    {rep367 + 13, 2, 3},
+    {rep367 + 17, 3, 2},
+    {rep367 + 22, 3, 1},
+    {rep367 + 27, 6, 4},
+    {rep367 + 35, 3, 3},
+    {rep367 + 40, 16, 1},
+    {rep367 + 58, 2, 3},
+    {rep367 + 62, 3, 2},
+    {rep367 + 67, 3, 1},
+    {rep367 + 72, 6, 4},
+    {rep367 + 80, 3, 3},
+    {rep367 + 85, 4, 0},
+    {rep368 + 0, 100, 1},
+    {rep368 + 102, 2, 2},
+    {rep368 + 106, 2, 3},
+    {rep368 + 110, 2, 4},
+    {rep368 + 114, 2, 5},
+    {rep368 + 118, 2, 6},
+    {rep368 + 122, 20, 0},
+    {rep369 + 0, 13, 1},
+    {rep369 + 15, 10, 1},
+    {rep369 + 27, 14, 1},
+    {rep369 + 43, 15, 1},
+    {rep369 + 60, 12, 0},
+    {rep370 + 0, 12, 1},
+    {rep370 + 14, 1, 0},
+    {rep371 + 0, 13, 1},
+    {rep371 + 15, 31, 2},
+    {rep371 + 48, 1, 0},
+    {rep372 + 0, 13, 1},
+    {rep372 + 15, 28, 2},
+    {rep372 + 45, 2, 3},
+    {rep372 + 49, 2, 4},
+    {rep372 + 53, 2, 0},
+    {rep373 + 0, 3, 1},
+    {rep373 + 5, 56, 0},
+    {rep374 + 0, 12, 1},
+    {rep374 + 14, 1, 0},
+    {rep375 + 0, 24, 1},
+    {rep375 + 26, 2, 0},
+    {rep376 + 0, 89, 0},
+    {rep377 + 0, 44, 0},
+    {rep378 + 0, 41, 0},
+    {rep379 + 0, 74, 1},
+    {rep379 + 76, 18, 2},
+    {rep379 + 96, 16, 0},
+    {rep380 + 0, 11, 1},
+    {rep380 + 13, 2, 2},
+    {rep380 + 17, 2, 3},
+    {rep380 + 21, 1, 0},
+    {rep381 + 0, 10, 1},
+    {rep381 + 12, 57, 3},
+    {rep381 + 71, 15, 0},
+    {rep382 + 0, 10, 1},
+    {rep382 + 12, 34, 2},
+    {rep382 + 48, 2, 3},
+    {rep382 + 52, 2, 4},
+    {rep382 + 56, 37, 5},
+    {rep382 + 95, 14, 0},
+    {rep383 + 0, 3, 2},
+    {rep383 + 5, 14, 2},
+    {rep383 + 21, 58, 0},
+    {rep384 + 0, 3, 2},
+    {rep384 + 5, 14, 2},
+    {rep384 + 21, 58, 0},
+    {rep385 + 0, 23, 1},
+    {rep385 + 25, 17, 4},
+    {rep385 + 44, 33, 3},
+    {rep385 + 79, 33, 2},
+    {rep385 + 114, 18, 0},
+    {rep386 + 0, 7, 0},
+    {rep387 + 0, 7, 0},
+    {rep388 + 0, 8, 0},
+    {rep389 + 0, 3, 0},
+    {rep390 + 0, 7, 0},
+    {rep391 + 0, 7, 0},
+    {rep392 + 0, 7, 0},
+    {rep393 + 0, 3, 0},
+    {rep394 + 0, 7, 0},
+    {rep395 + 0, 6, 0},
+    {rep396 + 0, 12, 0},
+    {rep397 + 0, 12, 0},
+    {rep398 + 0, 22, 0},
+    {rep399 + 0, 22, 0},
+    {rep400 + 0, 12, 0},
+    {rep401 + 0, 22, 0},
+    {rep402 + 0, 12, 0},
+    {rep403 + 0, 22, 0},
+    {rep404 + 0, 21, 0},
+    {rep405 + 0, 8, 0},
+    {rep406 + 0, 7, 0},
+    {rep407 + 0, 8, 0},
+    {rep408 + 0, 9, 0},
+    {rep409 + 0, 10, 0},
+    {rep410 + 0, 11, 0},
+    {rep411 + 0, 9, 0},
+    {rep412 + 0, 9, 0},
+    {rep413 + 0, 8, 0},
+    {rep414 + 0, 7, 0},
+    {rep415 + 0, 8, 0},
+    {rep416 + 0, 9, 0},
+    {rep417 + 0, 10, 0},
+    {rep418 + 0, 11, 0},
+    {rep419 + 0, 9, 0},
+    {rep420 + 0, 9, 0},
+    {rep421 + 0, 1, 0},
+    {rep422 + 0, 1, 0},
+    {rep423 + 0, 1, 0},
+    {rep424 + 0, 1, 0},
+    {rep425 + 0, 1, 0},
+    {rep426 + 0, 1, 0},
+    {rep427 + 0, 1, 0},
+    {rep428 + 0, 1, 0},
+    {rep429 + 0, 1, 0},
+    {rep430 + 0, 1, 0},
+    {rep431 + 0, 1, 0},
+    {rep432 + 0, 1, 0},
+    {rep433 + 0, 7, 0},
+    {rep434 + 0, 9, 0},
+    {rep435 + 0, 8, 0},
+    {rep436 + 0, 6, 0},
+    {rep437 + 0, 14, 0},
+    {rep438 + 0, 7, 0},
+    {rep439 + 0, 15, 0},
+    {rep440 + 0, 7, 0},
+    {rep441 + 0, 6, 0},
+    {rep442 + 0, 5, 0},
+    {rep443 + 0, 6, 0},
+    {rep444 + 0, 8, 0},
+    {rep445 + 0, 9, 0},
+    {rep446 + 0, 13, 0},
+    {rep447 + 0, 16, 0},
+    {rep448 + 0, 14, 0},
+    {rep449 + 0, 7, 0},
+    {rep450 + 0, 6, 0},
+    {rep451 + 0, 7, 0},
+    {rep452 + 0, 7, 0},
+    {rep453 + 0, 10, 0},
+    {rep454 + 0, 7, 0},
+    {rep455 + 0, 7, 0},
+    {rep456 + 0, 9, 0},
+    {rep457 + 0, 8, 0},
+    {rep458 + 0, 7, 0},
+    {rep459 + 0, 8, 0},
+    {rep460 + 0, 9, 0},
+    {rep461 + 0, 10, 0},
+    {rep462 + 0, 11, 0},
+    {rep463 + 0, 9, 0},
+    {rep464 + 0, 9, 0},
+    {rep465 + 0, 7, 0},
+    {rep466 + 0, 8, 0},
+    {rep467 + 0, 7, 0},
+    {rep468 + 0, 7, 0},
+    {rep469 + 0, 7, 0},
+    {rep470 + 0, 1, 0},
+    {rep471 + 0, 1, 0},
+    {rep472 + 0, 13, 0},
+    {rep473 + 0, 10, 0},
+    {rep474 + 0, 9, 0},
+    {rep475 + 0, 6, 0},
+    {rep476 + 0, 9, 0},
+    {rep477 + 0, 7, 0},
+    {rep478 + 0, 7, 0},
+    {rep479 + 0, 9, 0},
+    {rep480 + 0, 10, 0},
+    {rep481 + 0, 6, 0},
+    {rep482 + 0, 6, 0},
+    {rep483 + 0, 9, 0},
+    {rep484 + 0, 8, 0},
+    {rep485 + 0, 10, 0},
+    {rep486 + 0, 10, 0},
+    {rep487 + 0, 8, 0},
+    {rep488 + 0, 8, 0},
+    {rep489 + 0, 9, 0},
+    {rep490 + 0, 8, 0},
+    {rep491 + 0, 7, 0},
+    {rep492 + 0, 7, 0},
+    {rep493 + 0, 7, 0},
+    {rep494 + 0, 7, 0},
+    {rep495 + 0, 10, 0},
+    {rep496 + 0, 10, 0},
+    {rep497 + 0, 7, 0},
+    {rep498 + 0, 1, 0},
+    {rep499 + 0, 1, 0},
+    {rep500 + 0, 9, 0},
+    {rep501 + 0, 8, 0},
+    {rep502 + 0, 7, 0},
+    {rep503 + 0, 9, 0},
+    {rep504 + 0, 7, 0},
+    {rep505 + 0, 6, 0},
+    {rep506 + 0, 1, 0},
+    {rep507 + 0, 1, 0},
+    {rep508 + 0, 1, 0},
+    {rep509 + 0, 9, 0},
+    {rep510 + 0, 9, 0},
+    {rep511 + 0, 9, 0},
+    {rep512 + 0, 9, 0},
+    {rep513 + 0, 8, 0},
+    {rep514 + 0, 8, 0},
+    {rep515 + 0, 11, 0},
+    {rep516 + 0, 13, 0},
+    {rep517 + 0, 12, 0},
+    {rep518 + 0, 11, 0},
+    {rep519 + 0, 13, 0},
+    {rep520 + 0, 12, 0},
+    {rep521 + 0, 13, 0},
+    {rep522 + 0, 13, 0},
+    {rep523 + 0, 13, 0},
+    {rep524 + 0, 13, 0},
+    {rep525 + 0, 13, 0},
+    {rep526 + 0, 23, 0},
+    {rep527 + 0, 23, 0},
+    {rep528 + 0, 22, 0},
+    {rep529 + 0, 13, 0},
+    {rep530 + 0, 13, 0},
+    {rep531 + 0, 15, 0},
+    {rep532 + 0, 20, 0},
+    {rep533 + 0, 8, 0},
+    {rep534 + 0, 11, 0},
+    {rep535 + 0, 20, 0},
+    {rep536 + 0, 9, 0},
+    {rep537 + 0, 14, 0},
+    {rep538 + 0, 14, 0},
+    {rep539 + 0, 10, 0},
+    {rep540 + 0, 10, 0},
+    {rep541 + 0, 17, 0},
+    {rep542 + 0, 11, 0},
+    {rep543 + 0, 16, 0},
+    {rep544 + 0, 14, 0},
+    {rep545 + 0, 15, 0},
+    {rep546 + 0, 15, 0},
+    {rep547 + 0, 20, 0},
+    {rep548 + 0, 14, 0},
+    {rep549 + 0, 14, 0},
+    {rep550 + 0, 9, 0},
+    {rep551 + 0, 17, 0},
+    {rep552 + 0, 15, 0},
+    {rep553 + 0, 16, 0},
+    {rep554 + 0, 17, 0},
+    {rep555 + 0, 8, 0},
+    {rep556 + 0, 14, 0},
+    {rep557 + 0, 16, 0},
+    {rep558 + 0, 12, 0},
+    {rep559 + 0, 12, 0},
+    {rep560 + 0, 10, 0},
+    {rep561 + 0, 16, 0},
+    {rep562 + 0, 11, 0},
+    {rep563 + 0, 9, 0},
+    {rep564 + 0, 13, 0},
+    {rep565 + 0, 19, 0},
+    {rep566 + 0, 17, 0},
+    {rep567 + 0, 17, 0},
+    {rep568 + 0, 15, 0},
+    {rep569 + 0, 18, 0},
+    {rep570 + 0, 6, 0},
+    {rep571 + 0, 20, 0},
+    {rep572 + 0, 15, 0},
+    {rep573 + 0, 17, 0},
+    {rep574 + 0, 10, 0},
+    {rep575 + 0, 13, 0},
+    {rep576 + 0, 6, 0},
+    {rep577 + 0, 13, 0},
+    {rep578 + 0, 12, 0},
+    {rep579 + 0, 12, 0},
+    {rep580 + 0, 13, 0},
+    {rep581 + 0, 12, 0},
+    {rep582 + 0, 10, 0},
+    {rep583 + 0, 16, 0},
+    {rep584 + 0, 10, 0},
+    {rep585 + 0, 10, 0},
+    {rep586 + 0, 10, 0},
+    {rep587 + 0, 17, 0},
+    {rep588 + 0, 15, 0},
+    {rep589 + 0, 13, 0},
+    {rep590 + 0, 11, 0},
+    {rep591 + 0, 10, 0},
+    {rep592 + 0, 10, 0},
+    {rep593 + 0, 11, 0},
+    {rep594 + 0, 22, 0},
+    {rep595 + 0, 12, 0},
+    {rep596 + 0, 21, 0},
+    {rep597 + 0, 21, 0},
+    {rep598 + 0, 11, 0},
+    {rep599 + 0, 17, 0},
+    {rep600 + 0, 17, 0},
+    {rep601 + 0, 11, 0},
+    {rep602 + 0, 13, 0},
+    {rep603 + 0, 0, 0},
+    {rep604 + 0, 0, 0},
+    {rep605 + 0, 10, 0},
+    {rep606 + 0, 9, 0},
+    {rep607 + 0, 24, 0},
+    {rep608 + 0, 25, 0},
+    {rep609 + 0, 24, 0},
+    {rep610 + 0, 24, 0},
+    {rep611 + 0, 23, 0},
+    {rep612 + 0, 11, 0},
+    {rep613 + 0, 8, 0},
+    {rep614 + 0, 8, 0},
+    {rep615 + 0, 20, 0},
+    {rep616 + 0, 4, 0},
+    {rep617 + 0, 4, 0},
+    {rep618 + 0, 9, 0},
+    {rep619 + 0, 8, 0},
+    {rep620 + 0, 10, 0},
+    {rep621 + 0, 10, 0},
+    {rep622 + 0, 9, 0},
+    {rep623 + 0, 13, 0},
+    {rep624 + 0, 13, 0},
+    {rep625 + 0, 13, 0},
+    {rep626 + 0, 14, 0},
+    {rep627 + 0, 13, 0},
+    {rep628 + 0, 13, 0},
+    {rep629 + 0, 11, 0},
+    {rep630 + 0, 13, 0},
+    {rep631 + 0, 12, 0},
+    {rep632 + 0, 13, 0},
+    {rep633 + 0, 13, 0},
+    {rep634 + 0, 8, 0},
+    {rep635 + 0, 9, 0},
+    {rep636 + 0, 15, 0},
+    {rep637 + 0, 17, 0},
+    {rep638 + 0, 14, 0},
+    {rep639 + 0, 14, 0},
+    {rep640 + 0, 11, 0},
+    {rep641 + 0, 11, 0},
+    {rep642 + 0, 15, 0},
+    {rep643 + 0, 9, 0},
+    {rep644 + 0, 15, 0},
+    {rep645 + 0, 6, 0},
+    {rep646 + 0, 9, 0},
+    {rep647 + 0, 8, 0},
+    {rep648 + 0, 7, 0},
+    {rep649 + 0, 7, 0},
+    {rep650 + 0, 6, 0},
+    {rep651 + 0, 7, 0},
+    {rep652 + 0, 5, 0},
+    {rep653 + 0, 7, 0},
+    {rep654 + 0, 9, 0},
+    {rep655 + 0, 7, 0},
+    {rep656 + 0, 6, 0},
+    {rep657 + 0, 8, 0},
+    {rep658 + 0, 8, 0},
+    {rep659 + 0, 8, 0},
+    {rep660 + 0, 8, 0},
+    {rep661 + 0, 6, 0},
+    {rep662 + 0, 0, 0},
+    {rep663 + 0, 0, 0},
+    {rep664 + 0, 0, 0},
+    {rep665 + 0, 0, 0},
+    {rep666 + 0, 0, 0},
+    {rep667 + 0, 0, 0},
+    {rep668 + 0, 0, 0},
+    {rep669 + 0, 0, 0},
+    {rep670 + 0, 0, 0},
+    {rep671 + 0, 0, 0},
+    {rep672 + 0, 0, 0},
+    {rep673 + 0, 0, 0},
+    {rep674 + 0, 0, 0},
+    {rep675 + 0, 0, 0},
+    {rep676 + 0, 0, 0},
+    {rep677 + 0, 0, 0},
+    {rep678 + 0, 0, 0},
+    {rep679 + 0, 0, 0},
+    {rep680 + 0, 0, 0},
+    {rep681 + 0, 0, 0},
+    {rep682 + 0, 0, 0},
+    {rep683 + 0, 0, 0},
+    {rep684 + 0, 0, 0},
+    {rep685 + 0, 0, 0},
+    {rep686 + 0, 0, 0},
+    {rep687 + 0, 0, 0},
+    {rep688 + 0, 0, 0},
+    {rep689 + 0, 0, 0},
+    {rep690 + 0, 0, 0},
+    {rep691 + 0, 0, 0},
+    {rep692 + 0, 0, 0},
+    {rep693 + 0, 0, 0},
+    {rep694 + 0, 0, 0},
+    {rep695 + 0, 0, 0},
+    {rep696 + 0, 0, 0},
+    {rep697 + 0, 0, 0},
+    {rep698 + 0, 0, 0},
+    {rep699 + 0, 0, 0},
+    {rep700 + 0, 0, 0},
+    {rep701 + 0, 0, 0},
+    {rep702 + 0, 0, 0},
+    {rep703 + 0, 0, 0},
+    {rep704 + 0, 0, 0},
+    {rep705 + 0, 0, 0},
+    {rep706 + 0, 0, 0},
+    {rep707 + 0, 0, 0},
+    {rep708 + 0, 0, 0},
+    {rep709 + 0, 0, 0},
+    {rep710 + 0, 0, 0},
+    {rep711 + 0, 0, 0},
+    {rep712 + 0, 0, 0},
+    {rep713 + 0, 0, 0},
+    {rep714 + 0, 0, 0},
+    {rep715 + 0, 0, 0},
+    {rep716 + 0, 0, 0},
+    {rep717 + 0, 0, 0},
+    {rep718 + 0, 0, 0},
+    {rep719 + 0, 0, 0},
+    {rep720 + 0, 0, 0},
+    {rep721 + 0, 0, 0},
+    {rep722 + 0, 0, 0},
+    {rep723 + 0, 0, 0},
+    {rep724 + 0, 0, 0},
+    {rep725 + 0, 0, 0},
+    {rep726 + 0, 0, 0},
+    {rep727 + 0, 0, 0},
+    {rep728 + 0, 0, 0},
+    {rep729 + 0, 0, 0},
+    {rep730 + 0, 0, 0},
+    {rep731 + 0, 0, 0},
+    {rep732 + 0, 32, 0},
+    {rep733 + 0, 42, 0},
+    {rep734 + 0, 42, 0},
+    {rep735 + 0, 42, 0},
+    {rep736 + 0, 42, 0},
+    {rep737 + 0, 0, 0},
+    {rep738 + 0, 0, 0},
+    {rep739 + 0, 0, 0},
+    {rep740 + 0, 0, 0},
+    {rep741 + 0, 0, 0},
+    {rep742 + 0, 0, 0},
+    {rep743 + 0, 0, 0},
+    {rep744 + 0, 0, 0},
+    {rep745 + 0, 0, 0},
+    {rep746 + 0, 0, 0},
+    {rep747 + 0, 0, 0},
+    {rep748 + 0, 0, 0},
+    {rep749 + 0, 0, 0},
+    {rep750 + 0, 0, 0},
+    {rep751 + 0, 0, 0},
+    {rep752 + 0, 0, 0},
+    {rep753 + 0, 0, 0},
+    {rep754 + 0, 0, 0},
+    {rep755 + 0, 0, 0},
+    {rep756 + 0, 0, 0},
+    {rep757 + 0, 0, 0},
+    {rep758 + 0, 0, 0},
+    {rep759 + 0, 0, 0},
+    {rep760 + 0, 0, 0},
+    {rep761 + 0, 0, 0},
+    {rep762 + 0, 0, 0},
+    {rep763 + 0, 41, 0},
+    {rep764 + 0, 8, 0},
+    {rep765 + 0, 7, 0},
+    {rep766 + 0, 9, 0},
+    {rep767 + 0, 9, 0},
+    {rep768 + 0, 9, 0},
+    {rep769 + 0, 9, 0},
+    {rep770 + 0, 9, 0},
+    {rep771 + 0, 9, 0},
+    {rep772 + 0, 9, 0},
+    {rep773 + 0, 9, 0},
+    {rep774 + 0, 0, 0},
+    {rep775 + 0, 23, 0},
+    {rep776 + 0, 24, 0},
+    {rep777 + 0, 23, 0},
+    {rep778 + 0, 27, 0},
+    {rep779 + 0, 13, 0},
+    {rep780 + 0, 11, 0},
+    {rep781 + 0, 10, 0},
+    {rep782 + 0, 16, 0},
+    {rep783 + 0, 9, 0},
+    {rep784 + 0, 12, 0},
+    {rep785 + 0, 11, 0},
+    {rep786 + 0, 10, 0},
+    {rep787 + 0, 10, 0},
+    {rep788 + 0, 11, 0},
+    {rep789 + 0, 17, 0},
+    {rep790 + 0, 3, 2},
+    {rep790 + 5, 14, 2},
+    {rep790 + 21, 12, 1},
+    {rep790 + 35, 19, 1},
+    {rep790 + 56, 1, 0},
+    {rep791 + 0, 10, 2},
+    {rep791 + 12, 71, 4},
+    {rep791 + 85, 15, 0},
+    {rep792 + 0, 9, 1},
+    {rep792 + 11, 2, 2},
+    {rep792 + 15, 1, 0},
+    {rep793 + 0, 8, 1},
+    {rep793 + 10, 2, 2},
+    {rep793 + 14, 2, 3},
+    {rep793 + 18, 2, 4},
+    {rep793 + 22, 1, 0},
+};
+
+static const char *const lines[] = {
+    "for multiple, independent line segments: use GL_LINES",
+    "special cases for polygons:",
+    "\tindependant quads: use GL_QUADS",
+    "\tindependent triangles: use GL_TRIANGLES",
+    "clear: use only one of glCLearIndex or glClearColor,",
+    "and change index or r, g, b, a to correct values",
+    "getcolor:",
+    "GLint gctmp;",
+    "getshade:",
+    "GLint gctmp;",
+    "replace obj with your GLUnurbsObj*",
+    "replace obj with your GLUnurbsObj*",
+    "replace obj with your GLUnurbsObj*",
+    "replace obj with your GLUnurbsObj*",
+    "replace obj with your GLUnurbsObj*",
+    "replace obj with your GLUnurbsObj*",
+    "glGenLists: change range param to get more than one",
+    "depthcue supported by GL_FOG",
+    "popviewport: see glPopAttrib man page",
+    "addtopup not supported",
+    "always subpixel",
+    "gconfig not supported:",
+    "\tcollect glxChooseVisual attributes into one list for visual selection",
+    "use gluBeginPolygon(tobj) to draw concave polys",
+    "endpupmode obsolete",
+    "getothermonitor obsolete",
+    "gRGBcursor obsolete",
+    "ismex obsolete -- (always TRUE)",
+    "pupmode obsolete",
+    "spclos obsolete",
+    "swaptmesh not supported, maybe glBegin(GL_TRIANGLE_FAN)",
+    "RGBrange not supported, see glFog()",
+    "lRGBrange not supported, see glFog()",
+    "shaderange not supported, see glFog()",
+    "lshaderange not supported, see glFog()",
+    "callfunc not supported",
+    "chunksize not supported",
+    "clearhitcode not supported",
+    "compactify not supported",
+    "curveit not supported, see glEvalMesh()",
+    "defbasis not supported, see glEvalMesh()",
+    "deflfont not supported, see glCallLists()",
+    "defpup not supported",
+    "deltag not supported",
+    "depthcue not supported, See glFog()",
+    "dopup not supported",
+    "editobj not supported",
+    " -- use display list hierarchy",
+    "foreground not supported -- see fork man page",
+    "freepup not supported",
+    "bbox2 not supported",
+    "bbox2i not supported",
+    "bbox2s not supported",
+    "gentag not supported -- use display list hierarchy",
+    "getdescender not supported",
+    "getfont not supported",
+    "getheight not supported",
+    "gethitcode not supported",
+    "getlsbackup not supported",
+    "getlstyle not supported",
+    "getresetls not supported",
+    "getscrbox not supported",
+    "glcompat not supported",
+    "gsync not supported",
+    "gversion not supported -- how about \"OpenGL\"?",
+    "istag not supported -- use display list hierarchy",
+    "lsbackup not supported",
+    "maketag not supported -- use display list hierarchy",
+    "newpup not supported",
+    "newtag not supported -- use display list hierarchy",
+    "objinsert not supported -- use display list hierarchy",
+    "objreplace not supported -- use display list hierarchy",
+    "pagecolor not supported",
+    "resetls not supported",
+    "scrbox not supported",
+    "setpup not supported -- See Window Manager",
+    "strwidth not supported -- See Fonts",
+    "lstrwidth not supported -- See Fonts",
+    "swapinterval not supported -- See MBX",
+    "zdraw not supported -- See stencil for similar functions",
+    "zsource not supported",
+    "getgpos -- graphics position not supported",
+    "patch not supported, see gluNurbsSurface man page",
+    "rpatch not supported, see gluNurbsSurface man page",
+    "patchbassis not supported, see gluNurbsSurface man page",
+    "patchcurves not supported, see gluNurbsSurface man page",
+    "patchprecision not supported, see gluNurbsSurface man page",
+    "rcrv not supported -- see gluNurbsCurve man page",
+    "rcrvn not supported -- see gluNurbsCurve man page",
+    "xfpt not supported -- see gluProject man page",
+    "xfpti not supported -- see gluProject man page",
+    "xfpts not supported -- see gluProject man page",
+    "xfpt2 not supported -- see gluProject man page",
+    "xfpt2i not supported -- see gluProject man page",
+    "xfpt2s not supported -- see gluProject man page",
+    "xfpt4 not supported -- see gluProject man page",
+    "xfpt4i not supported -- see gluProject man page",
+    "xfpt4s not supported -- see gluProject man page",
+    "scrsubdivide not needed.",
+    "Object tags not supported",
+    "Object tags not supported",
+    "Cursor -- use Window Manager",
+    "Device -- use Window Manager",
+    "color values need to be scaled",
+    "color values need to be scaled",
+    "color values need to be scaled",
+    "color values need to be scaled",
+    "check list numbering",
+    "charstr: check list numbering",
+    "see glListBase info",
+    "You can probably do better than this.",
+    "See gluPartialDisk man page.",
+    "See gluPartialDisk man page.",
+    "See gluPartialDisk man page.",
+    "See gluPartialDisk man page.",
+    "See gluPartialDisk man page.",
+    "See gluPartialDisk man page.",
+    "See gluDisk man page.",
+    "See gluDisk man page.",
+    "See gluDisk man page.",
+    "See gluDisk man page.",
+    "See gluDisk man page.",
+    "See gluDisk man page.",
+    "check list numbering",
+    "see man page for glClipPlane equation",
+    "cpack: if argument is not a variable",
+    "might need to be:",
+    "\tglColor4b(($1)&0xff, ($1)>>8&0xff, ($1)>>16&0xff, ($1)>>24&0xff)",
+    "replace u with domain coordinate",
+    "replace n with domain coordinate index",
+    "curvebasis: see man pages",
+    "curveprecision:see man pages",
+    "change glClearDepth parameter to be in [0, 1]",
+    "LineStipple:",
+    "\tget factor from lsrepeat()",
+    "\tYou don't really need to make a display list.",
+    "\tCheck list numbering.",
+    "setlinestyle: Check list numbering.",
+    "glPolygonStipple:",
+    "\tSee man page to change $3 into mask.",
+    "\tYou don't really need to make a display list.",
+    "\tCheck list numbering.",
+    "glXUseFont: see man page",
+    "glDeleteLists: check object numbers",
+    "glxChooseVisual: add $1 to attriblist",
+    "glxChooseVisual: add GLX_ACCUM_RED_SIZE, $1, etc. to attriblist",
+    "endpick:",
+    "\treplace gluPerspective args",
+    "\tor use glPopMatrix() to restore.",
+    "Fog: have to translate params.",
+    "frontbuffer: other possibilities include GL_FRONT_AND_BACK",
+    "backbuffer: other possibilities include GL_FRONT_AND_BACK",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "Add glEnd() after these vertices,  before next glBegin()",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "glBegin: Use GL_LINES if only one line segment is desired.",
+    "get display mode:",
+    "\tHow to tell if doublebuffered?",
+    "\tYou can do better than this.",
+    "GLint dmtmp;",
+    "see man page",
+    "getgconfig:",
+    "GLint gctmp;",
+    "getgdesc other posiblilties:",
+    "\tglxGetConfig();",
+    "\tglxGetCurrentContext();",
+    "\tglxGetCurrentDrawable();",
+    "GLint gdtmp;",
+    "getmatrix: you might mean",
+    "glGetFloatv(GL_PROJECTION_MATRIX, $1)",
+    "getmmode: translate returned values",
+    "GLint mmtmp;",
+    "see man page for gluGetNurbsProperty",
+    "move results from tmp.",
+    "getopenobj: ",
+    "int tmp;",
+    "glGetPolygonStipple:",
+    "\tmask is a 32x32 array (See man page).",
+    "\tGLuByte *mask;",
+    "getplanes:",
+    "int tmp;",
+    "get GL_SCISSOR_BOX:",
+    "You can probably do better than this.",
+    "getsm:",
+    "GLint tmp;",
+    "get GL_VIEWPORT:",
+    "You can probably do better than this.",
+    "getwritemask:",
+    "GLint tmp;",
+    "get GL_CURRENT_COLOR: scale color values",
+    "glIsList: check object numbering",
+    "lcharstr: replace lstrlen with strlen(string) like function",
+    "line width:",
+    "Could also be:",
+    "float tmp;",
+    "glGetFloatv(GL_LINE_WIDTH, &tmp);",
+    "lmcolor: if LMC_NULL,  use:",
+    "glDisable(GL_COLOR_MATERIAL);",
+    "lookat: replace UPx with vector",
+    "lrectread: see man page for glReadPixels",
+    "rectread: see man page for glReadPixels",
+    "lrectwrite: see man page for glDrawPixels",
+    "rectwrite: see man page for glDrawPixels",
+    "glDepthRange params must be scaled to [0, 1]",
+    "glDepthRange params must be scaled to [0, 1]",
+    "lsrepeat: combine with pattern from deflinestyle",
+    "getlsrepeat: move tmp into your variable.",
+    "Check list numbering.",
+    "XXX I think this is backwards",
+    "XXX I think this is backwards",
+    "noport: see man page",
+    "gluNurbsCurve: replace nobj with your object",
+    "See man page",
+    "gluNurbsCurve: replace nobj with your object",
+    "See man page",
+    "objdelete: tags not supported",
+    "See glDeleteLists man page.",
+    "overlay: use GLX_BUFFER_SIZE $1, GLX_LEVEL 1 in attriblist",
+    "underlay: use GLX_BUFFER_SIZE $1, GLX_LEVEL -1 in attriblist",
+    "pick:",
+    "\tSelect buffer is type GLuint.",
+    "\tSet gluPickMatrix params.",
+    "See man pages.",
+    "\tMight want to push Projection matrix if you have endpick pop it.",
+    "picksize: merge this with other gluPickMatrix call due to pick()",
+    "pixmode: see glPixelTransfer man page",
+    "Translate parameters.",
+    "pixmodef: see glPixelTransfer man page",
+    "Translate parameters.",
+    "points: put as many vertices as possible between Begin and End",
+    "points: put as many vertices as possible between Begin and End",
+    "points: put as many vertices as possible between Begin and End",
+    "points: put as many vertices as possible between Begin and End",
+    "points: put as many vertices as possible between Begin and End",
+    "points: put as many vertices as possible between Begin and End",
+    "gluPwlCurve: replace nobj with your object",
+    "See man page",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "Add glEnd() after these vertices,  before next glBegin().",
+    "Relative drawing not supported -- change",
+    "readdisplay: see man page for glReadPixels",
+    "readRGB: see man page for glReadPixels",
+    "readpixels: see man page for glReadPixels",
+    "rect: remove extra PolygonMode changes",
+    "rect: remove extra PolygonMode changes",
+    "rect: remove extra PolygonMode changes",
+    "sbox: remove extra PolygonMode changes.",
+    "not screen-aligned -- See glRect",
+    "sboxi: remove extra PolygonMode changes.",
+    "not screen-aligned -- See glRect",
+    "sboxs: remove extra PolygonMode changes.",
+    "not screen-aligned -- See glRect",
+    "sboxf not screen-aligned -- See glRect",
+    "sboxfi not screen-aligned -- See glRect",
+    "sboxfs not screen-aligned -- See glRect",
+    "glColorMask: only Boolean values allowed",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "You can do better than this.",
+    "You can do better than this.",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Relative drawing not supported -- change",
+    "Replace nobj with your object -- see man page",
+    "pattern: check list numbering.",
+    "See substitutions made for defpattern.",
+    "see glPolygonStipple man page.",
+    "writepixels: see man page for glDrawPixels",
+    "writeRGB: see man page for glDrawPixels",
+    "\tYouhave to pack the arrays into RGBA",
+    "glDepthMask is boolean only",
+    "You can probably do better than this.",
+    "long tmp;",
+    "getbuffer: translate results.",
+    "long tmp;",
+    "getcmmode: multimap mode not supported.",
+    "long tmp;",
+    "getcpos: You can probably do better than this.",
+    "texgen: translate parameters.",
+    "glTexEnvfv:",
+    "\tSee man page.",
+    "\tTranslate parameters.",
+    "\tCheck list numbering.",
+    "glTexImage2D:",
+    "\tSee man page.",
+    "\tIf MipMaps desired, use gluBuild2DMIPmaps().",
+    "\tTranslate parameters.",
+    "\tSee glTexParameterf().",
+    "\tCheck list numbering.",
+    "texbind: check list numbering",
+    "tevbind: check list numbering",
+    "SRC_AUTO not really supported -- see glReadBuffer man page",
+    "SRC_ZBUFFER: use GL_DEPTH_COMPONENT in glReadPixels call",
+    "XXX which aux buffer is pup planes?",
+    "XXX which aux buffer is overlay planes?",
+    "XXX which aux buffer is underlay planes?",
+    "SRC_FRAMEGRABBER not supported",
+    "PYSM_SHRINK not really supported -- see glEnable man page",
+    "polymode PYM_HOLLOW not supported",
+    "see glFogf man page",
+    "see glFogf man page",
+    "see glFogf man page",
+    "see glFogf man page",
+    "see glFogf man page",
+    "see glFogf man page",
+    "see glFogf man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "pixmode: see glPixelTransfer man page",
+    "see glAccum man page for how to clear:",
+    "glClearAccum(r, g, b, a);",
+    "glClear(GL_ACCUM_BUFFER_BIT);",
+    "see window manager",
+    "see window manager",
+    "see window manager",
+    "see window manager",
+    "ZMIN not needed -- always 0.",
+    "ZMAX not needed -- always 1.",
+    "multi-map not supported",
+    "multi-map not supported",
+    "XXX what to do?",
+    "XXX what to do?",
+    "XXX what to do?",
+    "cursor bits not supported",
+    "overunder_shared: not supported",
+    "blending is ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "CIFRACT irrelevant",
+    "cursors not supported -- see window manager",
+    "dither ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "smooth lines ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "smooth lines ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "logic ops ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "nscrns not supported -- see window manager",
+    "blink not supported -- see window manager",
+    "There is NO limit to the number of vertices in a polygon.",
+    "all patterns are the same size",
+    "Smooth points ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "Smooth points ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "pup_to_overunder: not supported",
+    "read buffer ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "read buffer ALWAYS supported.",
+    "This function returns whether it is enabled.",
+    "subpixel ALWAYS supported",
+    "subpixel ALWAYS supported",
+    "subpixel ALWAYS supported",
+    "XXX see glu man pages",
+    "see window manager",
+    "zdraw not supported",
+    "zdraw not supported",
+    "see window manager",
+    "see window manager",
+    "multimap not supported -- see window manager",
+    "framegrabber not supported",
+    "timers not supported -- use event functions.",
+    "devices not supported -- use event functions.",
+    "alpha test ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "alpha_overunder: not supported",
+    "see glAccum man page.",
+    "see glAccum man page.",
+    "Fog ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "Twosided lighting ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "polygon mode ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "Smooth polygons ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "scrbox not supported",
+    "Texture ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "Fog ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "Texture ALWAYS supported.",
+    "This function returns whether is is enabled.",
+    "muxpipes: not supported -- See Window Manager?",
+    "MSINGLE not supported",
+    "LMC_COLOR: use glDisable(GL_COLOR_MATERIAL);",
+    "LMC_NULL: use glDisable(GL_COLOR_MATERIAL);",
+    "TX_WRAP not supported: see glTexParameterfv man page.",
+    "TX_TILE not supported: see glTexParamterfv man page.",
+    "Border needs to be added to glTexImage2D parameters",
+    "XXX is there a problem with GL_BLEND?",
+    "env_color: see glTexEnv man page",
+    "TX_SELECT not supported",
+    "tg_off use: ",
+    "glDisable(GL_TEXTURE_GEN_S);",
+    "glDisable(GL_TEXTURE_GEN_T);",
+    "tg_on use: ",
+    "glEnable(GL_TEXTURE_GEN_S);",
+    "glEnable(GL_TEXTURE_GEN_T);",
+    "getgconfig: ZMIN always 0",
+    "getgconfig: ZMAX always 1",
+    "BITS_ACBUF: add together all red, grn, blu, alp bits.",
+    "multisample not supported in base OpenGL",
+    "multisample not supported in base OpenGL",
+    "zmin always 0.",
+    "multisample not supported in base OpenGL",
+    "zmax always 1.",
+    "multisample not supported in base OpenGL",
+    "multisample not supported in base OpenGL",
+    "XXX fix this.",
+    "XXX see glPolygonStipple man page",
+    "XXX see glPolygonStipple man page",
+    "XXX see glPolygonStipple man page",
+    "XXX see glLineStipple man page",
+    "wintitle not supported -- See Window Manager",
+    "winset not supported -- See Window Manager",
+    "winpush not supported -- See Window Manager",
+    "winposition not supported -- See Window Manager",
+    "winpop not supported -- See Window Manager",
+    "winopen not supported -- See Window Manager",
+    "winmove not supported -- See Window Manager",
+    "winget not supported -- See Window Manager",
+    "windepth not supported -- See Window Manager",
+    "winconstraints not supported -- See Window Manager",
+    "winclose not supported -- See Window Manager",
+    "videocmd not supported",
+    "tpon not supported",
+    "tpoff not supported",
+    "textport not supported",
+    "textinit not supported",
+    "textcolor not supported -- See Fonts",
+    "swinopen not supported -- See Window Manager",
+    "stepunit not supported -- See Window Manager",
+    "setvideo not supported",
+    "setmonitor not supported",
+    "setmap not supported -- See Window Manager",
+    "setdblights not supported -- See Window Manager",
+    "setbell not supported -- See Window Manager",
+    "scrnselect not supported -- See Window Manager",
+    "scrnattach not supported -- See Window Manager",
+    "screenspace not supported",
+    "ringbell not supported -- See Window Manager",
+    "reshapeviewport not supported -- See Window Manager",
+    "prefposition not supported -- See Window Manager",
+    "prefsize not supported -- See Window Manager",
+    "onemap not supported -- See Window Manager",
+    "noborder not supported -- See Window Manager",
+    "multimap not supported -- See Window Manager?",
+    "mswapbuffers not supported -- See Window Manager",
+    "mapcolor not supported -- See Window Manager",
+    "imakebackground not supported -- See Window Manager",
+    "icontitle not supported -- See Window Manager",
+    "iconsize not supported -- See Window Manager",
+    "greset not supported -- See Window Manager",
+    "ginit not supported -- See Window Manager",
+    "gexit not supported -- See Window Manager",
+    "\tThere's bound to be something you have to do!",
+    "getwscrn not supported -- See Window Manager",
+    "getvideo not supported",
+    "getsize not supported -- See Window Manager",
+    "getorigin not supported -- See Window Manager",
+    "getmcolor not supported -- See Window Manager",
+    "getmonitor not supported",
+    "getmap not supported",
+    "getbutton not supported -- See Window Manager",
+    "gammaramp not supported",
+    "fullscrn not supported",
+    "fudge not supported",
+    "endfullscrn not supported",
+    "dglopen not supported",
+    "dglclose not supported",
+    "dbtext not supported, see Window Manager",
+    "defcursor not supported, see Window Manager",
+    "cyclemap not supported, see Window Manager?",
+    "curstype not supported",
+    "curson not supported",
+    "cursoff not supported",
+    "curorigin not supported",
+    "blink not supported, see Window Manager",
+    "blanktime not supported, see Window Manager",
+    "blankscreen not supported, see Window Manager",
+    "winattach obsolete -- see Window Manager",
+    "setcursor not supported -- see Window Manager",
+    "RGBcursor obsolete -- see Window Manager",
+    "getcursor not supported -- see Window Manager?",
+    "swapbuffers: replace display and window",
+    "singlebuffer: don't use GLX_DOUBLEBUFFER in attriblist",
+    "doublebuffer: use GLX_DOUBLEBUFFER in attriblist",
+    "cmode: use GLX_BUFFER_SIZE, 1024 in attriblist",
+    "RGBmode: use GLX_RGBA in attriblist",
+    "gbegin not supported -- See Window Manager",
+    "getport obsolete -- see Window Manager",
+    "keepaspect not supported -- See Window Manager",
+    "maxsize not supported -- See Window Manager",
+    "minsize not supported -- See Window Manager",
+    "clkon not supported",
+    "clkoff not supported",
+    "lampoff not supported -- See Window Manager",
+    "lampon not supported -- See Window Manager",
+    "attachcursor not supported -- See Window Manager",
+    "blkqread not supported, see Events",
+    "getvaluator not supported -- See Events",
+    "isqueued not supported -- See Events",
+    "noise not supported -- See Events",
+    "qdevice not supported -- See Events",
+    "qenter not supported -- See Events",
+    "qgetfd not supported -- See Events",
+    "qread not supported -- See Events",
+    "qreset not supported -- See Events",
+    "qtest not supported -- See Events",
+    "setvaluator not supported -- See Events",
+    "tie not supported -- See Events",
+    "unqdevice not supported -- See Events",
+    "unqdevice not supported -- See Events",
+    "getdev not supported -- See Events",
+    "qcontrol not supported -- See Events",
+    "maxlights:",
+    "GLint tmp;",
+    "Use GL_FRONT in call to glMaterialf.",
+    "Use GL_BACK in call to glMaterialf.",
+    "light model parameters need to be moved into a glLightModelf call.",
+    "attenuation: see glLightf man page:",
+    "Add GL_LINEAR_ATTENUATION.",
+    "light model parameters need to be moved into a glLightModelf call.",
+    "see glLightf man page",
+    "Add GL_SPOT_EXPONENT and GL_SPOT_CUTOFF parameters.",
+    "light color: need to add GL_AMBIENT and GL_SPECULAR components.",
+    "ALPHA needs to be included in parameters.",
+    "alpha is to be included with other parameters",
+    "include ALPHA parameter with specular",
+    "include ALPHA parameter with diffuse",
+    "Ambient:",
+    "\tIf this is a light model lmdef, then use glLightModelf and GL_LIGHT_MODEL_AMBIENT.",
+    "Include ALPHA parameter with ambient",
+    "include ALPHA parameter with emission",
+    "lmbind: check object numbering.",
+    "lmdef other possibilities include:",
+    "\tglLightf(light, pname, *params);",
+    "\tglLightModelf(pname, param);",
+    "Check list numbering.",
+    "Translate params as needed.",
+    0
+};
+
+Rule rules[] = {
+    {"Tag", 3, 3, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Tag[ \t]*)(\\(.*)$"}, rep115, segs + 115, lines + 99, 1, 1, 0},
+    {"c3f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c3f[ \t]*)(\\(.*)$"}, rep119, segs + 119, lines + 103, 2, 0, 12},
+    {"c3s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c3s[ \t]*)(\\(.*)$"}, rep120, segs + 121, lines + 103, 2, 1, 12},
+    {"c3i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c3i[ \t]*)(\\(.*)$"}, rep121, segs + 123, lines + 104, 2, 1, 12},
+    {"c4f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c4f[ \t]*)(\\(.*)$"}, rep122, segs + 125, lines + 105, 2, 0, 12},
+    {"c4s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c4s[ \t]*)(\\(.*)$"}, rep123, segs + 127, lines + 105, 2, 1, 12},
+    {"c4i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(c4i[ \t]*)(\\(.*)$"}, rep124, segs + 129, lines + 106, 2, 1, 12},
+    {"v2f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v2f[ \t]*)(\\(.*)$"}, rep125, segs + 131, lines + 107, 2, 0, 13},
+    {"v2s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v2s[ \t]*)(\\(.*)$"}, rep126, segs + 133, lines + 107, 2, 0, 13},
+    {"v2i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v2i[ \t]*)(\\(.*)$"}, rep127, segs + 135, lines + 107, 2, 0, 13},
+    {"v2d", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v2d[ \t]*)(\\(.*)$"}, rep128, segs + 137, lines + 107, 2, 0, 13},
+    {"v3f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v3f[ \t]*)(\\(.*)$"}, rep129, segs + 139, lines + 107, 2, 0, 13},
+    {"v3s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v3s[ \t]*)(\\(.*)$"}, rep130, segs + 141, lines + 107, 2, 0, 13},
+    {"v3i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v3i[ \t]*)(\\(.*)$"}, rep131, segs + 143, lines + 107, 2, 0, 13},
+    {"v3d", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v3d[ \t]*)(\\(.*)$"}, rep132, segs + 145, lines + 107, 2, 0, 13},
+    {"v4f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v4f[ \t]*)(\\(.*)$"}, rep133, segs + 147, lines + 107, 2, 0, 13},
+    {"v4s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v4s[ \t]*)(\\(.*)$"}, rep134, segs + 149, lines + 107, 2, 0, 13},
+    {"v4i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v4i[ \t]*)(\\(.*)$"}, rep135, segs + 151, lines + 107, 2, 0, 13},
+    {"v4d", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(v4d[ \t]*)(\\(.*)$"}, rep136, segs + 153, lines + 107, 2, 0, 13},
+    {"n3f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(n3f[ \t]*)(\\(.*)$"}, rep137, segs + 155, lines + 107, 2, 0, 13},
+    {"t2f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(t2f[ \t]*)(\\(.*)$"}, rep138, segs + 157, lines + 107, 2, 0, 15},
+    {"t3f", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(t3f[ \t]*)(\\(.*)$"}, rep139, segs + 159, lines + 107, 2, 0, 15},
+    {"t2s", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(t2s[ \t]*)(\\(.*)$"}, rep140, segs + 161, lines + 107, 2, 0, 15},
+    {"t2i", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(t2i[ \t]*)(\\(.*)$"}, rep141, segs + 163, lines + 107, 2, 0, 15},
+    {"t2d", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(t2d[ \t]*)(\\(.*)$"}, rep142, segs + 165, lines + 107, 2, 0, 15},
+    {"arc", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arc[ \t]*)(\\(.*)$"}, rep167, segs + 235, lines + 111, 7, 1, 218},
+    {"crv", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(crv[ \t]*)(\\(.*)$"}, rep182, segs + 310, lines + 128, 1, 1, 18},
+    {"pdr", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdr[ \t]*)(\\(.*)$"}, rep265, segs + 553, lines + 227, 4, 0, 16},
+    {"pmv", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmv[ \t]*)(\\(.*)$"}, rep271, segs + 574, lines + 227, 4, 0, 36},
+    {"pnt", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnt[ \t]*)(\\(.*)$"}, rep282, segs + 612, lines + 237, 4, 1, 43},
+    {"rdr", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdr[ \t]*)(\\(.*)$"}, rep307, segs + 686, lines + 245, 4, 2, 16},
+    {"rmv", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmv[ \t]*)(\\(.*)$"}, rep332, segs + 798, lines + 273, 4, 1, 35},
+    {"rot", 3, 3, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rot[ \t]*)(\\(.*)$"}, rep338, segs + 819, lines + 279, 8, 1, 65},
+    {"tie", 3, 3, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(tie[ \t]*)(\\(.*)$"}, rep758, segs + 1369, lines + 557, 1, 1, 0},
+    {"rcrv", 4, 4, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rcrv[ \t]*)(\\(.*)$"}, rep103, segs + 103, lines + 87, 1, 1, 0},
+    {"xfpt", 4, 4, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt[ \t]*)(\\(.*)$"}, rep105, segs + 105, lines + 89, 1, 1, 0},
+    {"cmov", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmov[ \t]*)(\\(.*)$"}, rep151, segs + 191, lines + 109, 4, 0, 19},
+    {"font", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(font[ \t]*)(\\(.*)$"}, rep160, segs + 218, lines + 109, 1, 1, 17},
+    {"arci", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arci[ \t]*)(\\(.*)$"}, rep168, segs + 242, lines + 112, 7, 1, 217},
+    {"arcs", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arcs[ \t]*)(\\(.*)$"}, rep169, segs + 249, lines + 113, 7, 1, 217},
+    {"arcf", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arcf[ \t]*)(\\(.*)$"}, rep170, segs + 256, lines + 114, 7, 1, 174},
+    {"circ", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circ[ \t]*)(\\(.*)$"}, rep173, segs + 277, lines + 117, 4, 1, 190},
+    {"crvn", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(crvn[ \t]*)(\\(.*)$"}, rep183, segs + 311, lines + 129, 1, 1, 30},
+    {"draw", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(draw[ \t]*)(\\(.*)$"}, rep202, segs + 354, lines + 152, 4, 1, 16},
+    {"move", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(move[ \t]*)(\\(.*)$"}, rep208, segs + 375, lines + 158, 4, 1, 40},
+    {"mapw", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(mapw[ \t]*)(\\(.*)$"}, rep252, segs + 507, lines + 216, 1, 1, 15},
+    {"pdri", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdri[ \t]*)(\\(.*)$"}, rep266, segs + 557, lines + 227, 4, 0, 16},
+    {"pdrs", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdrs[ \t]*)(\\(.*)$"}, rep267, segs + 561, lines + 227, 4, 0, 16},
+    {"pdr2", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdr2[ \t]*)(\\(.*)$"}, rep268, segs + 565, lines + 227, 3, 0, 14},
+    {"pmvi", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmvi[ \t]*)(\\(.*)$"}, rep272, segs + 578, lines + 227, 4, 0, 36},
+    {"pmvs", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmvs[ \t]*)(\\(.*)$"}, rep273, segs + 582, lines + 227, 4, 0, 36},
+    {"pmv2", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmv2[ \t]*)(\\(.*)$"}, rep274, segs + 586, lines + 227, 3, 0, 34},
+    {"pick", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pick[ \t]*)(\\(.*)$"}, rep278, segs + 600, lines + 227, 3, 5, 133},
+    {"pnti", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnti[ \t]*)(\\(.*)$"}, rep283, segs + 616, lines + 238, 4, 1, 43},
+    {"pnts", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnts[ \t]*)(\\(.*)$"}, rep284, segs + 620, lines + 239, 4, 1, 43},
+    {"pnt2", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnt2[ \t]*)(\\(.*)$"}, rep285, segs + 624, lines + 240, 3, 1, 41},
+    {"polf", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polf[ \t]*)(\\(.*)$"}, rep291, segs + 639, lines + 243, 3, 0, 79},
+    {"poly", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(poly[ \t]*)(\\(.*)$"}, rep297, segs + 657, lines + 243, 3, 0, 81},
+    {"rdr2", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdr2[ \t]*)(\\(.*)$"}, rep308, segs + 690, lines + 247, 3, 2, 14},
+    {"rdri", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdri[ \t]*)(\\(.*)$"}, rep311, segs + 699, lines + 253, 4, 2, 16},
+    {"rdrs", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdrs[ \t]*)(\\(.*)$"}, rep312, segs + 703, lines + 255, 4, 2, 16},
+    {"rect", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rect[ \t]*)(\\(.*)$"}, rep317, segs + 722, lines + 260, 5, 1, 101},
+    {"sbox", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sbox[ \t]*)(\\(.*)$"}, rep323, segs + 752, lines + 263, 5, 2, 100},
+    {"rmv2", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmv2[ \t]*)(\\(.*)$"}, rep333, segs + 802, lines + 274, 3, 1, 33},
+    {"rmvi", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmvi[ \t]*)(\\(.*)$"}, rep336, segs + 811, lines + 277, 4, 1, 35},
+    {"rmvs", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmvs[ \t]*)(\\(.*)$"}, rep337, segs + 815, lines + 278, 4, 1, 35},
+    {"rpdr", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdr[ \t]*)(\\(.*)$"}, rep340, segs + 835, lines + 281, 4, 1, 16},
+    {"rpmv", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmv[ \t]*)(\\(.*)$"}, rep346, segs + 856, lines + 287, 4, 1, 36},
+    {"splf", 4, 4, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splf[ \t]*)(\\(.*)$"}, rep358, segs + 896, lines + 297, 3, 0, 79},
+    {"FLAT", 4, 4, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FLAT)([^a-zA-Z_0-9]+.*|)$"}, rep433, segs + 1044, lines + 328, 1, 0, 7},
+    {"TX_S", 4, 4, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_S)([^a-zA-Z_0-9]+.*|)$"}, rep616, segs + 1227, lines + 438, 1, 0, 4},
+    {"TX_T", 4, 4, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_T)([^a-zA-Z_0-9]+.*|)$"}, rep617, segs + 1228, lines + 438, 1, 0, 4},
+    {"Byte", 4, 4, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Byte)([^a-zA-Z_0-9]+.*|)$"}, rep645, segs + 1256, lines + 455, 1, 0, 6},
+    {"tpon", 4, 4, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(tpon[ \t]*)(\\(.*)$"}, rep674, segs + 1285, lines + 472, 1, 1, 0},
+    {"clear", 5, 5, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(clear[ \t]*)(\\(.*)$"}, rep14, segs + 14, lines + 4, 1, 2, 74},
+    {"pclos", 5, 5, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pclos[ \t]*)(\\(.*)$"}, rep31, segs + 31, lines + 18, 1, 0, 7},
+    {"ismex", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ismex[ \t]*)(\\(.*)$"}, rep44, segs + 44, lines + 27, 1, 1, 0},
+    {"dopup", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(dopup[ \t]*)(\\(.*)$"}, rep62, segs + 62, lines + 45, 1, 1, 0},
+    {"bbox2", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bbox2[ \t]*)(\\(.*)$"}, rep66, segs + 66, lines + 50, 1, 1, 0},
+    {"gsync", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gsync[ \t]*)(\\(.*)$"}, rep79, segs + 79, lines + 63, 1, 1, 0},
+    {"istag", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(istag[ \t]*)(\\(.*)$"}, rep81, segs + 81, lines + 65, 1, 1, 0},
+    {"zdraw", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zdraw[ \t]*)(\\(.*)$"}, rep95, segs + 95, lines + 79, 1, 1, 0},
+    {"patch", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(patch[ \t]*)(\\(.*)$"}, rep98, segs + 98, lines + 82, 1, 1, 0},
+    {"rcrvn", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rcrvn[ \t]*)(\\(.*)$"}, rep104, segs + 104, lines + 88, 1, 1, 0},
+    {"xfpti", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpti[ \t]*)(\\(.*)$"}, rep106, segs + 106, lines + 90, 1, 1, 0},
+    {"xfpts", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpts[ \t]*)(\\(.*)$"}, rep107, segs + 107, lines + 91, 1, 1, 0},
+    {"xfpt2", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt2[ \t]*)(\\(.*)$"}, rep108, segs + 108, lines + 92, 1, 1, 0},
+    {"xfpt4", 5, 5, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt4[ \t]*)(\\(.*)$"}, rep111, segs + 111, lines + 95, 1, 1, 0},
+    {"cmov2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmov2[ \t]*)(\\(.*)$"}, rep152, segs + 195, lines + 109, 3, 0, 17},
+    {"cmovi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmovi[ \t]*)(\\(.*)$"}, rep155, segs + 204, lines + 109, 4, 0, 19},
+    {"cmovs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmovs[ \t]*)(\\(.*)$"}, rep156, segs + 208, lines + 109, 4, 0, 19},
+    {"color", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(color[ \t]*)(\\(.*)$"}, rep157, segs + 212, lines + 109, 2, 0, 10},
+    {"acbuf", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(acbuf[ \t]*)(\\(.*)$"}, rep162, segs + 223, lines + 110, 3, 0, 11},
+    {"arcfi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arcfi[ \t]*)(\\(.*)$"}, rep171, segs + 263, lines + 115, 7, 1, 174},
+    {"arcfs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(arcfs[ \t]*)(\\(.*)$"}, rep172, segs + 270, lines + 116, 7, 1, 174},
+    {"circi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circi[ \t]*)(\\(.*)$"}, rep174, segs + 281, lines + 118, 4, 1, 190},
+    {"circs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circs[ \t]*)(\\(.*)$"}, rep175, segs + 285, lines + 119, 4, 1, 190},
+    {"circf", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circf[ \t]*)(\\(.*)$"}, rep176, segs + 289, lines + 120, 4, 1, 147},
+    {"cpack", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cpack[ \t]*)(\\(.*)$"}, rep181, segs + 308, lines + 125, 2, 3, 16},
+    {"draw2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(draw2[ \t]*)(\\(.*)$"}, rep203, segs + 358, lines + 153, 3, 1, 14},
+    {"drawi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(drawi[ \t]*)(\\(.*)$"}, rep206, segs + 367, lines + 156, 4, 1, 16},
+    {"draws", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(draws[ \t]*)(\\(.*)$"}, rep207, segs + 371, lines + 157, 4, 1, 16},
+    {"move2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(move2[ \t]*)(\\(.*)$"}, rep209, segs + 379, lines + 159, 3, 1, 38},
+    {"movei", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(movei[ \t]*)(\\(.*)$"}, rep212, segs + 388, lines + 162, 4, 1, 40},
+    {"moves", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(moves[ \t]*)(\\(.*)$"}, rep213, segs + 392, lines + 163, 4, 1, 40},
+    {"getsm", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getsm[ \t]*)(\\(.*)$"}, rep225, segs + 414, lines + 191, 1, 2, 42},
+    {"isobj", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(isobj[ \t]*)(\\(.*)$"}, rep233, segs + 434, lines + 198, 2, 1, 10},
+    {"mapw2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(mapw2[ \t]*)(\\(.*)$"}, rep253, segs + 508, lines + 217, 1, 1, 15},
+    {"mmode", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(mmode[ \t]*)(\\(.*)$"}, rep254, segs + 509, lines + 218, 2, 0, 14},
+    {"nmode", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(nmode[ \t]*)(\\(.*)$"}, rep255, segs + 511, lines + 218, 2, 0, 57},
+    {"ortho", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ortho[ \t]*)(\\(.*)$"}, rep260, segs + 537, lines + 225, 7, 0, 129},
+    {"pdr2i", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdr2i[ \t]*)(\\(.*)$"}, rep269, segs + 568, lines + 227, 3, 0, 14},
+    {"pdr2s", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pdr2s[ \t]*)(\\(.*)$"}, rep270, segs + 571, lines + 227, 3, 0, 14},
+    {"pmv2i", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmv2i[ \t]*)(\\(.*)$"}, rep275, segs + 589, lines + 227, 3, 0, 34},
+    {"pmv2s", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pmv2s[ \t]*)(\\(.*)$"}, rep276, segs + 592, lines + 227, 3, 0, 34},
+    {"pnt2i", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnt2i[ \t]*)(\\(.*)$"}, rep286, segs + 627, lines + 241, 3, 1, 41},
+    {"pnt2s", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pnt2s[ \t]*)(\\(.*)$"}, rep287, segs + 630, lines + 242, 3, 1, 41},
+    {"polfi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polfi[ \t]*)(\\(.*)$"}, rep292, segs + 642, lines + 243, 3, 0, 79},
+    {"polfs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polfs[ \t]*)(\\(.*)$"}, rep293, segs + 645, lines + 243, 3, 0, 79},
+    {"polf2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polf2[ \t]*)(\\(.*)$"}, rep294, segs + 648, lines + 243, 3, 0, 79},
+    {"polyi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polyi[ \t]*)(\\(.*)$"}, rep298, segs + 660, lines + 243, 3, 0, 81},
+    {"polys", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polys[ \t]*)(\\(.*)$"}, rep299, segs + 663, lines + 243, 3, 0, 81},
+    {"poly2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(poly2[ \t]*)(\\(.*)$"}, rep300, segs + 666, lines + 243, 3, 0, 81},
+    {"rdr2i", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdr2i[ \t]*)(\\(.*)$"}, rep309, segs + 693, lines + 249, 3, 2, 14},
+    {"rdr2s", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rdr2s[ \t]*)(\\(.*)$"}, rep310, segs + 696, lines + 251, 3, 2, 14},
+    {"recti", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(recti[ \t]*)(\\(.*)$"}, rep318, segs + 727, lines + 261, 5, 1, 101},
+    {"rects", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rects[ \t]*)(\\(.*)$"}, rep319, segs + 732, lines + 262, 5, 1, 101},
+    {"rectf", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectf[ \t]*)(\\(.*)$"}, rep320, segs + 737, lines + 263, 5, 0, 15},
+    {"sboxi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sboxi[ \t]*)(\\(.*)$"}, rep324, segs + 757, lines + 265, 5, 2, 101},
+    {"sboxs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sboxs[ \t]*)(\\(.*)$"}, rep325, segs + 762, lines + 267, 5, 2, 101},
+    {"sboxf", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sboxf[ \t]*)(\\(.*)$"}, rep326, segs + 767, lines + 269, 5, 1, 14},
+    {"rmv2i", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmv2i[ \t]*)(\\(.*)$"}, rep334, segs + 805, lines + 275, 3, 1, 33},
+    {"rmv2s", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rmv2s[ \t]*)(\\(.*)$"}, rep335, segs + 808, lines + 276, 3, 1, 33},
+    {"rpdri", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdri[ \t]*)(\\(.*)$"}, rep341, segs + 839, lines + 282, 4, 1, 16},
+    {"rpdrs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdrs[ \t]*)(\\(.*)$"}, rep342, segs + 843, lines + 283, 4, 1, 16},
+    {"rpdr2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdr2[ \t]*)(\\(.*)$"}, rep343, segs + 847, lines + 284, 3, 1, 14},
+    {"rpmvi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmvi[ \t]*)(\\(.*)$"}, rep347, segs + 860, lines + 288, 4, 1, 36},
+    {"rpmvs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmvs[ \t]*)(\\(.*)$"}, rep348, segs + 864, lines + 289, 4, 1, 36},
+    {"rpmv2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmv2[ \t]*)(\\(.*)$"}, rep349, segs + 868, lines + 290, 3, 1, 34},
+    {"scale", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(scale[ \t]*)(\\(.*)$"}, rep352, segs + 877, lines + 293, 4, 0, 14},
+    {"splfi", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splfi[ \t]*)(\\(.*)$"}, rep359, segs + 899, lines + 297, 3, 0, 79},
+    {"splfs", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splfs[ \t]*)(\\(.*)$"}, rep360, segs + 902, lines + 297, 3, 0, 79},
+    {"splf2", 5, 5, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splf2[ \t]*)(\\(.*)$"}, rep361, segs + 905, lines + 297, 3, 0, 79},
+    {"BF_DC", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_DC)([^a-zA-Z_0-9]+.*|)$"}, rep396, segs + 1007, lines + 327, 1, 0, 12},
+    {"BF_SC", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_SC)([^a-zA-Z_0-9]+.*|)$"}, rep397, segs + 1008, lines + 327, 1, 0, 12},
+    {"BF_SA", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_SA)([^a-zA-Z_0-9]+.*|)$"}, rep400, segs + 1011, lines + 327, 1, 0, 12},
+    {"BF_DA", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_DA)([^a-zA-Z_0-9]+.*|)$"}, rep402, segs + 1013, lines + 327, 1, 0, 12},
+    {"DT_ON", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(DT_ON)([^a-zA-Z_0-9]+.*|)$"}, rep432, segs + 1043, lines + 328, 1, 0, 1},
+    {"LO_OR", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_OR)([^a-zA-Z_0-9]+.*|)$"}, rep442, segs + 1053, lines + 328, 1, 0, 5},
+    {"FG_ON", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_ON)([^a-zA-Z_0-9]+.*|)$"}, rep471, segs + 1082, lines + 329, 1, 0, 1},
+    {"PM_C0", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_C0)([^a-zA-Z_0-9]+.*|)$"}, rep481, segs + 1092, lines + 338, 1, 1, 6},
+    {"PM_C1", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_C1)([^a-zA-Z_0-9]+.*|)$"}, rep482, segs + 1093, lines + 339, 1, 1, 6},
+    {"NAUTO", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(NAUTO)([^a-zA-Z_0-9]+.*|)$"}, rep498, segs + 1109, lines + 355, 1, 0, 1},
+    {"CP_ON", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(CP_ON)([^a-zA-Z_0-9]+.*|)$"}, rep507, segs + 1118, lines + 358, 1, 0, 1},
+    {"STR_B", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_B)([^a-zA-Z_0-9]+.*|)$"}, rep583, segs + 1194, lines + 431, 1, 0, 16},
+    {"TG_ON", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TG_ON)([^a-zA-Z_0-9]+.*|)$"}, rep622, segs + 1233, lines + 442, 1, 3, 9},
+    {"Angle", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Angle)([^a-zA-Z_0-9]+.*|)$"}, rep649, segs + 1260, lines + 455, 1, 0, 7},
+    {"Coord", 5, 5, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Coord)([^a-zA-Z_0-9]+.*|)$"}, rep653, segs + 1264, lines + 455, 1, 0, 7},
+    {"tpoff", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(tpoff[ \t]*)(\\(.*)$"}, rep675, segs + 1286, lines + 473, 1, 1, 0},
+    {"ginit", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(ginit[ \t]*)(\\(.*)$"}, rep702, segs + 1313, lines + 500, 1, 1, 0},
+    {"gexit", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(gexit[ \t]*)(\\(.*)$"}, rep703, segs + 1314, lines + 501, 1, 2, 0},
+    {"fudge", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(fudge[ \t]*)(\\(.*)$"}, rep714, segs + 1325, lines + 513, 1, 1, 0},
+    {"blink", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(blink[ \t]*)(\\(.*)$"}, rep725, segs + 1336, lines + 524, 1, 1, 0},
+    {"cmode", 5, 5, Rule::simple, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmode[ \t]*)(\\(.*)$"}, rep735, segs + 1346, lines + 534, 1, 1, 42},
+    {"clkon", 5, 5, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(clkon[ \t]*)(\\(.*)$"}, rep742, segs + 1353, lines + 541, 1, 1, 0},
+    {"noise", 5, 5, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(noise[ \t]*)(\\(.*)$"}, rep750, segs + 1361, lines + 549, 1, 1, 0},
+    {"qread", 5, 5, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qread[ \t]*)(\\(.*)$"}, rep754, segs + 1365, lines + 553, 1, 1, 0},
+    {"qtest", 5, 5, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qtest[ \t]*)(\\(.*)$"}, rep756, segs + 1367, lines + 555, 1, 1, 0},
+    {"ALPHA", 5, 5, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(ALPHA)([^a-zA-Z_0-9]+.*|)$"}, rep783, segs + 1394, lines + 574, 1, 1, 9},
+    {"lmdef", 5, 5, Rule::args, Rule::lighting, 170, {"^(.*[^a-zA-Z_0-9]+|)(lmdef[ \t]*)(\\(.*)$"}, rep791, segs + 1406, lines + 582, 3, 5, 96},
+    {"lmdef", 5, 5, Rule::args, Rule::emulation, -1, {"^(.*[^a-zA-Z_0-9]+|)(lmdef[ \t]*)(\\(.*)$"}, rep793, segs + 1412, lines + 587, 5, 0, 15},
+    {"zclear", 6, 6, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zclear[ \t]*)(\\(.*)$"}, rep15, segs + 15, lines + 6, 1, 0, 46},
+    {"finish", 6, 6, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(finish[ \t]*)(\\(.*)$"}, rep27, segs + 27, lines + 16, 1, 0, 10},
+    {"genobj", 6, 6, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(genobj[ \t]*)(\\(.*)$"}, rep28, segs + 28, lines + 16, 1, 1, 13},
+    {"getdcm", 6, 6, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdcm[ \t]*)(\\(.*)$"}, rep29, segs + 29, lines + 17, 1, 1, 19},
+    {"spclos", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(spclos[ \t]*)(\\(.*)$"}, rep46, segs + 46, lines + 29, 1, 1, 0},
+    {"defpup", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(defpup[ \t]*)(\\(.*)$"}, rep59, segs + 59, lines + 42, 1, 1, 0},
+    {"deltag", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(deltag[ \t]*)(\\(.*)$"}, rep60, segs + 60, lines + 43, 1, 1, 0},
+    {"bbox2i", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bbox2i[ \t]*)(\\(.*)$"}, rep67, segs + 67, lines + 51, 1, 1, 0},
+    {"bbox2s", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bbox2s[ \t]*)(\\(.*)$"}, rep68, segs + 68, lines + 52, 1, 1, 0},
+    {"gentag", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gentag[ \t]*)(\\(.*)$"}, rep69, segs + 69, lines + 53, 1, 1, 0},
+    {"newpup", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(newpup[ \t]*)(\\(.*)$"}, rep84, segs + 84, lines + 68, 1, 1, 0},
+    {"newtag", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(newtag[ \t]*)(\\(.*)$"}, rep85, segs + 85, lines + 69, 1, 1, 0},
+    {"scrbox", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(scrbox[ \t]*)(\\(.*)$"}, rep90, segs + 90, lines + 74, 1, 1, 0},
+    {"setpup", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setpup[ \t]*)(\\(.*)$"}, rep91, segs + 91, lines + 75, 1, 1, 0},
+    {"rpatch", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpatch[ \t]*)(\\(.*)$"}, rep99, segs + 99, lines + 83, 1, 1, 0},
+    {"xfpt2i", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt2i[ \t]*)(\\(.*)$"}, rep109, segs + 109, lines + 93, 1, 1, 0},
+    {"xfpt2s", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt2s[ \t]*)(\\(.*)$"}, rep110, segs + 110, lines + 94, 1, 1, 0},
+    {"xfpt4i", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt4i[ \t]*)(\\(.*)$"}, rep112, segs + 112, lines + 96, 1, 1, 0},
+    {"xfpt4s", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(xfpt4s[ \t]*)(\\(.*)$"}, rep113, segs + 113, lines + 97, 1, 1, 0},
+    {"Offset", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Offset[ \t]*)(\\(.*)$"}, rep116, segs + 116, lines + 100, 1, 1, 0},
+    {"Cursor", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Cursor[ \t]*)(\\(.*)$"}, rep117, segs + 117, lines + 101, 1, 1, 0},
+    {"Device", 6, 6, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Device[ \t]*)(\\(.*)$"}, rep118, segs + 118, lines + 102, 1, 1, 0},
+    {"normal", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(normal[ \t]*)(\\(.*)$"}, rep147, segs + 179, lines + 107, 2, 0, 13},
+    {"cmov2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmov2i[ \t]*)(\\(.*)$"}, rep153, segs + 198, lines + 109, 3, 0, 17},
+    {"cmov2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(cmov2s[ \t]*)(\\(.*)$"}, rep154, segs + 201, lines + 109, 3, 0, 17},
+    {"colorf", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(colorf[ \t]*)(\\(.*)$"}, rep158, segs + 214, lines + 109, 2, 0, 10},
+    {"circfi", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circfi[ \t]*)(\\(.*)$"}, rep177, segs + 293, lines + 121, 4, 1, 147},
+    {"circfs", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(circfs[ \t]*)(\\(.*)$"}, rep178, segs + 297, lines + 122, 4, 1, 147},
+    {"delobj", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(delobj[ \t]*)(\\(.*)$"}, rep191, segs + 330, lines + 143, 2, 1, 19},
+    {"dither", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(dither[ \t]*)(\\(.*)$"}, rep192, segs + 332, lines + 144, 2, 0, 51},
+    {"acsize", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(acsize[ \t]*)(\\(.*)$"}, rep194, segs + 335, lines + 145, 1, 1, 46},
+    {"draw2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(draw2i[ \t]*)(\\(.*)$"}, rep204, segs + 361, lines + 154, 3, 1, 14},
+    {"draw2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(draw2s[ \t]*)(\\(.*)$"}, rep205, segs + 364, lines + 155, 3, 1, 14},
+    {"move2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(move2i[ \t]*)(\\(.*)$"}, rep210, segs + 382, lines + 160, 3, 1, 38},
+    {"move2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(move2s[ \t]*)(\\(.*)$"}, rep211, segs + 385, lines + 161, 3, 1, 38},
+    {"gflush", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gflush[ \t]*)(\\(.*)$"}, rep229, segs + 422, lines + 197, 1, 0, 9},
+    {"lookat", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lookat[ \t]*)(\\(.*)$"}, rep242, segs + 454, lines + 206, 10, 1, 42},
+    {"noport", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(noport[ \t]*)(\\(.*)$"}, rep256, segs + 513, lines + 218, 1, 1, 45},
+    {"ortho2", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ortho2[ \t]*)(\\(.*)$"}, rep261, segs + 544, lines + 225, 5, 0, 128},
+    {"polf2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polf2i[ \t]*)(\\(.*)$"}, rep295, segs + 651, lines + 243, 3, 0, 79},
+    {"polf2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polf2s[ \t]*)(\\(.*)$"}, rep296, segs + 654, lines + 243, 3, 0, 79},
+    {"poly2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(poly2i[ \t]*)(\\(.*)$"}, rep301, segs + 669, lines + 243, 3, 0, 81},
+    {"poly2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(poly2s[ \t]*)(\\(.*)$"}, rep302, segs + 672, lines + 243, 3, 0, 81},
+    {"rectfi", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectfi[ \t]*)(\\(.*)$"}, rep321, segs + 742, lines + 263, 5, 0, 15},
+    {"rectfs", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectfs[ \t]*)(\\(.*)$"}, rep322, segs + 747, lines + 263, 5, 0, 15},
+    {"sboxfi", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sboxfi[ \t]*)(\\(.*)$"}, rep327, segs + 772, lines + 270, 5, 1, 15},
+    {"sboxfs", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sboxfs[ \t]*)(\\(.*)$"}, rep328, segs + 777, lines + 271, 5, 1, 15},
+    {"rotate", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rotate[ \t]*)(\\(.*)$"}, rep339, segs + 827, lines + 280, 8, 1, 70},
+    {"rpdr2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdr2i[ \t]*)(\\(.*)$"}, rep344, segs + 850, lines + 285, 3, 1, 14},
+    {"rpdr2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpdr2s[ \t]*)(\\(.*)$"}, rep345, segs + 853, lines + 286, 3, 1, 14},
+    {"rpmv2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmv2i[ \t]*)(\\(.*)$"}, rep350, segs + 871, lines + 291, 3, 1, 34},
+    {"rpmv2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rpmv2s[ \t]*)(\\(.*)$"}, rep351, segs + 874, lines + 292, 3, 1, 34},
+    {"sclear", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(sclear[ \t]*)(\\(.*)$"}, rep353, segs + 881, lines + 293, 2, 0, 47},
+    {"splf2i", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splf2i[ \t]*)(\\(.*)$"}, rep362, segs + 908, lines + 297, 3, 0, 79},
+    {"splf2s", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(splf2s[ \t]*)(\\(.*)$"}, rep363, segs + 911, lines + 297, 3, 0, 79},
+    {"window", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(window[ \t]*)(\\(.*)$"}, rep368, segs + 939, lines + 297, 7, 0, 130},
+    {"wmpack", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(wmpack[ \t]*)(\\(.*)$"}, rep369, segs + 946, lines + 297, 5, 0, 64},
+    {"texgen", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(texgen[ \t]*)(\\(.*)$"}, rep380, segs + 973, lines + 308, 4, 1, 16},
+    {"tevdef", 6, 6, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(tevdef[ \t]*)(\\(.*)$"}, rep381, segs + 977, lines + 309, 3, 4, 82},
+    {"BF_ONE", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_ONE)([^a-zA-Z_0-9]+.*|)$"}, rep395, segs + 1006, lines + 327, 1, 0, 6},
+    {"BF_MDC", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_MDC)([^a-zA-Z_0-9]+.*|)$"}, rep398, segs + 1009, lines + 327, 1, 0, 22},
+    {"BF_MSC", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_MSC)([^a-zA-Z_0-9]+.*|)$"}, rep399, segs + 1010, lines + 327, 1, 0, 22},
+    {"BF_MSA", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_MSA)([^a-zA-Z_0-9]+.*|)$"}, rep401, segs + 1012, lines + 327, 1, 0, 22},
+    {"BF_MDA", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_MDA)([^a-zA-Z_0-9]+.*|)$"}, rep403, segs + 1014, lines + 327, 1, 0, 22},
+    {"SMP_ON", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SMP_ON)([^a-zA-Z_0-9]+.*|)$"}, rep422, segs + 1033, lines + 327, 1, 0, 1},
+    {"SML_ON", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SML_ON)([^a-zA-Z_0-9]+.*|)$"}, rep425, segs + 1036, lines + 327, 1, 0, 1},
+    {"DT_OFF", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(DT_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep431, segs + 1042, lines + 328, 1, 0, 1},
+    {"LO_AND", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_AND)([^a-zA-Z_0-9]+.*|)$"}, rep436, segs + 1047, lines + 328, 1, 0, 6},
+    {"LO_SRC", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_SRC)([^a-zA-Z_0-9]+.*|)$"}, rep438, segs + 1049, lines + 328, 1, 0, 7},
+    {"LO_DST", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_DST)([^a-zA-Z_0-9]+.*|)$"}, rep440, segs + 1051, lines + 328, 1, 0, 7},
+    {"LO_XOR", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_XOR)([^a-zA-Z_0-9]+.*|)$"}, rep441, segs + 1052, lines + 328, 1, 0, 6},
+    {"LO_NOR", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_NOR)([^a-zA-Z_0-9]+.*|)$"}, rep443, segs + 1054, lines + 328, 1, 0, 6},
+    {"LO_ORR", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ORR)([^a-zA-Z_0-9]+.*|)$"}, rep446, segs + 1057, lines + 328, 1, 0, 13},
+    {"LO_ORI", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ORI)([^a-zA-Z_0-9]+.*|)$"}, rep448, segs + 1059, lines + 328, 1, 0, 14},
+    {"LO_ONE", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ONE)([^a-zA-Z_0-9]+.*|)$"}, rep450, segs + 1061, lines + 328, 1, 0, 6},
+    {"FG_OFF", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep470, segs + 1081, lines + 329, 1, 0, 1},
+    {"PM_RDX", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_RDX)([^a-zA-Z_0-9]+.*|)$"}, rep491, segs + 1102, lines + 348, 1, 1, 7},
+    {"PM_RDY", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_RDY)([^a-zA-Z_0-9]+.*|)$"}, rep492, segs + 1103, lines + 349, 1, 1, 7},
+    {"PM_CDX", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_CDX)([^a-zA-Z_0-9]+.*|)$"}, rep493, segs + 1104, lines + 350, 1, 1, 7},
+    {"PM_CDY", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_CDY)([^a-zA-Z_0-9]+.*|)$"}, rep494, segs + 1105, lines + 351, 1, 1, 7},
+    {"PM_VO1", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_VO1)([^a-zA-Z_0-9]+.*|)$"}, rep497, segs + 1108, lines + 354, 1, 1, 7},
+    {"AC_ADD", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_ADD)([^a-zA-Z_0-9]+.*|)$"}, rep505, segs + 1116, lines + 358, 1, 0, 6},
+    {"CP_OFF", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(CP_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep506, segs + 1117, lines + 358, 1, 0, 1},
+    {"STR_2B", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_2B)([^a-zA-Z_0-9]+.*|)$"}, rep584, segs + 1195, lines + 431, 1, 0, 10},
+    {"STR_3B", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_3B)([^a-zA-Z_0-9]+.*|)$"}, rep585, segs + 1196, lines + 431, 1, 0, 10},
+    {"STR_4B", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_4B)([^a-zA-Z_0-9]+.*|)$"}, rep586, segs + 1197, lines + 431, 1, 0, 10},
+    {"STR_16", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_16)([^a-zA-Z_0-9]+.*|)$"}, rep587, segs + 1198, lines + 431, 1, 0, 17},
+    {"STR_32", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(STR_32)([^a-zA-Z_0-9]+.*|)$"}, rep588, segs + 1199, lines + 431, 1, 0, 15},
+    {"LMC_AD", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_AD)([^a-zA-Z_0-9]+.*|)$"}, rep594, segs + 1205, lines + 432, 1, 0, 22},
+    {"TG_OFF", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TG_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep621, segs + 1232, lines + 439, 1, 3, 10},
+    {"String", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(String)([^a-zA-Z_0-9]+.*|)$"}, rep647, segs + 1258, lines + 455, 1, 0, 8},
+    {"Scoord", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Scoord)([^a-zA-Z_0-9]+.*|)$"}, rep651, segs + 1262, lines + 455, 1, 0, 7},
+    {"Icoord", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Icoord)([^a-zA-Z_0-9]+.*|)$"}, rep652, segs + 1263, lines + 455, 1, 0, 5},
+    {"Matrix", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Matrix)([^a-zA-Z_0-9]+.*|)$"}, rep654, segs + 1265, lines + 455, 1, 1, 9},
+    {"Object", 6, 6, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Object)([^a-zA-Z_0-9]+.*|)$"}, rep661, segs + 1272, lines + 460, 1, 0, 6},
+    {"winset", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winset[ \t]*)(\\(.*)$"}, rep663, segs + 1274, lines + 461, 1, 1, 0},
+    {"winpop", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winpop[ \t]*)(\\(.*)$"}, rep666, segs + 1277, lines + 464, 1, 1, 0},
+    {"winget", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winget[ \t]*)(\\(.*)$"}, rep669, segs + 1280, lines + 467, 1, 1, 0},
+    {"setmap", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setmap[ \t]*)(\\(.*)$"}, rep683, segs + 1294, lines + 481, 1, 1, 0},
+    {"onemap", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(onemap[ \t]*)(\\(.*)$"}, rep693, segs + 1304, lines + 491, 1, 1, 0},
+    {"greset", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(greset[ \t]*)(\\(.*)$"}, rep701, segs + 1312, lines + 499, 1, 1, 0},
+    {"getmap", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getmap[ \t]*)(\\(.*)$"}, rep710, segs + 1321, lines + 509, 1, 1, 0},
+    {"dbtext", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(dbtext[ \t]*)(\\(.*)$"}, rep718, segs + 1329, lines + 517, 1, 1, 0},
+    {"curson", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(curson[ \t]*)(\\(.*)$"}, rep722, segs + 1333, lines + 521, 1, 1, 0},
+    {"gbegin", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(gbegin[ \t]*)(\\(.*)$"}, rep737, segs + 1348, lines + 536, 1, 1, 0},
+    {"clkoff", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(clkoff[ \t]*)(\\(.*)$"}, rep743, segs + 1354, lines + 542, 1, 1, 0},
+    {"lampon", 6, 6, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(lampon[ \t]*)(\\(.*)$"}, rep745, segs + 1356, lines + 544, 1, 1, 0},
+    {"qenter", 6, 6, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qenter[ \t]*)(\\(.*)$"}, rep752, segs + 1363, lines + 551, 1, 1, 0},
+    {"qgetfd", 6, 6, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qgetfd[ \t]*)(\\(.*)$"}, rep753, segs + 1364, lines + 552, 1, 1, 0},
+    {"qreset", 6, 6, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qreset[ \t]*)(\\(.*)$"}, rep755, segs + 1366, lines + 554, 1, 1, 0},
+    {"getdev", 6, 6, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdev[ \t]*)(\\(.*)$"}, rep761, segs + 1372, lines + 560, 1, 1, 0},
+    {"LIGHT7", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT7)([^a-zA-Z_0-9]+.*|)$"}, rep766, segs + 1377, lines + 566, 1, 0, 9},
+    {"LIGHT6", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT6)([^a-zA-Z_0-9]+.*|)$"}, rep767, segs + 1378, lines + 566, 1, 0, 9},
+    {"LIGHT5", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT5)([^a-zA-Z_0-9]+.*|)$"}, rep768, segs + 1379, lines + 566, 1, 0, 9},
+    {"LIGHT4", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT4)([^a-zA-Z_0-9]+.*|)$"}, rep769, segs + 1380, lines + 566, 1, 0, 9},
+    {"LIGHT3", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT3)([^a-zA-Z_0-9]+.*|)$"}, rep770, segs + 1381, lines + 566, 1, 0, 9},
+    {"LIGHT2", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT2)([^a-zA-Z_0-9]+.*|)$"}, rep771, segs + 1382, lines + 566, 1, 0, 9},
+    {"LIGHT1", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT1)([^a-zA-Z_0-9]+.*|)$"}, rep772, segs + 1383, lines + 566, 1, 0, 9},
+    {"LIGHT0", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LIGHT0)([^a-zA-Z_0-9]+.*|)$"}, rep773, segs + 1384, lines + 566, 1, 0, 9},
+    {"LMNULL", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMNULL)([^a-zA-Z_0-9]+.*|)$"}, rep774, segs + 1385, lines + 566, 1, 0, 0},
+    {"LCOLOR", 6, 6, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LCOLOR)([^a-zA-Z_0-9]+.*|)$"}, rep781, segs + 1392, lines + 572, 1, 2, 10},
+    {"lmbind", 6, 6, Rule::args, Rule::lighting, 293, {"^(.*[^a-zA-Z_0-9]+|)(lmbind[ \t]*)(\\(.*)$"}, rep790, segs + 1401, lines + 581, 5, 1, 49},
+    {"lmbind", 6, 6, Rule::args, Rule::emulation, -1, {"^(.*[^a-zA-Z_0-9]+|)(lmbind[ \t]*)(\\(.*)$"}, rep792, segs + 1409, lines + 587, 3, 0, 12},
+    {"bgnline", 7, 7, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnline[ \t]*)(\\(.*)$"}, rep4, segs + 4, lines + 0, 1, 1, 22},
+    {"endline", 7, 7, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endline[ \t]*)(\\(.*)$"}, rep5, segs + 5, lines + 1, 1, 0, 7},
+    {"bgntrim", 7, 7, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgntrim[ \t]*)(\\(.*)$"}, rep20, segs + 20, lines + 12, 1, 1, 19},
+    {"endtrim", 7, 7, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endtrim[ \t]*)(\\(.*)$"}, rep26, segs + 26, lines + 15, 1, 1, 17},
+    {"popname", 7, 7, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(popname[ \t]*)(\\(.*)$"}, rep33, segs + 33, lines + 18, 1, 0, 11},
+    {"gconfig", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gconfig[ \t]*)(\\(.*)$"}, rep39, segs + 39, lines + 21, 1, 2, 0},
+    {"concave", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(concave[ \t]*)(\\(.*)$"}, rep40, segs + 40, lines + 23, 1, 1, 0},
+    {"pupmode", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pupmode[ \t]*)(\\(.*)$"}, rep45, segs + 45, lines + 28, 1, 1, 0},
+    {"curveit", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(curveit[ \t]*)(\\(.*)$"}, rep56, segs + 56, lines + 39, 1, 1, 0},
+    {"editobj", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(editobj[ \t]*)(\\(.*)$"}, rep63, segs + 63, lines + 46, 1, 2, 0},
+    {"freepup", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(freepup[ \t]*)(\\(.*)$"}, rep65, segs + 65, lines + 49, 1, 1, 0},
+    {"getfont", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getfont[ \t]*)(\\(.*)$"}, rep71, segs + 71, lines + 55, 1, 1, 0},
+    {"maketag", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(maketag[ \t]*)(\\(.*)$"}, rep83, segs + 83, lines + 67, 1, 1, 0},
+    {"resetls", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(resetls[ \t]*)(\\(.*)$"}, rep89, segs + 89, lines + 73, 1, 1, 0},
+    {"zsource", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zsource[ \t]*)(\\(.*)$"}, rep96, segs + 96, lines + 80, 1, 1, 0},
+    {"getgpos", 7, 7, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getgpos[ \t]*)(\\(.*)$"}, rep97, segs + 97, lines + 81, 1, 1, 0},
+    {"callobj", 7, 7, Rule::args, Rule::always, 312, {"^(.*[^a-zA-Z_0-9]+|)(callobj[ \t]*)(\\(.*)$"}, rep149, segs + 186, lines + 107, 2, 1, 12},
+    {"charstr", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(charstr[ \t]*)(\\(.*)$"}, rep150, segs + 188, lines + 108, 3, 1, 41},
+    {"callobj", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(callobj[ \t]*)(\\(.*)$"}, rep179, segs + 301, lines + 123, 2, 1, 12},
+    {"czclear", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(czclear[ \t]*)(\\(.*)$"}, rep186, segs + 314, lines + 132, 6, 1, 182},
+    {"endpick", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endpick[ \t]*)(\\(.*)$"}, rep195, segs + 336, lines + 146, 1, 3, 144},
+    {"gselect", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gselect[ \t]*)(\\(.*)$"}, rep232, segs + 431, lines + 198, 3, 0, 43},
+    {"lmcolor", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lmcolor[ \t]*)(\\(.*)$"}, rep238, segs + 445, lines + 204, 2, 2, 64},
+    {"logicop", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(logicop[ \t]*)(\\(.*)$"}, rep241, segs + 451, lines + 206, 3, 0, 79},
+    {"makeobj", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(makeobj[ \t]*)(\\(.*)$"}, rep251, segs + 505, lines + 215, 2, 1, 23},
+    {"overlay", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(overlay[ \t]*)(\\(.*)$"}, rep262, segs + 549, lines + 225, 1, 1, 42},
+    {"pixmode", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pixmode[ \t]*)(\\(.*)$"}, rep280, segs + 606, lines + 233, 3, 2, 19},
+    {"pntsize", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pntsize[ \t]*)(\\(.*)$"}, rep288, segs + 633, lines + 243, 2, 0, 24},
+    {"readRGB", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(readRGB[ \t]*)(\\(.*)$"}, rep314, segs + 715, lines + 258, 2, 1, 117},
+    {"scrmask", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(scrmask[ \t]*)(\\(.*)$"}, rep354, segs + 883, lines + 293, 5, 0, 44},
+    {"stencil", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(stencil[ \t]*)(\\(.*)$"}, rep364, segs + 914, lines + 297, 8, 0, 106},
+    {"zbuffer", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zbuffer[ \t]*)(\\(.*)$"}, rep373, segs + 961, lines + 300, 2, 0, 59},
+    {"getcpos", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getcpos[ \t]*)(\\(.*)$"}, rep379, segs + 970, lines + 307, 3, 1, 108},
+    {"texbind", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(texbind[ \t]*)(\\(.*)$"}, rep383, segs + 986, lines + 319, 3, 1, 75},
+    {"tevbind", 7, 7, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(tevbind[ \t]*)(\\(.*)$"}, rep384, segs + 989, lines + 320, 3, 1, 75},
+    {"SRC_PUP", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_PUP)([^a-zA-Z_0-9]+.*|)$"}, rep390, segs + 1001, lines + 323, 1, 1, 7},
+    {"BF_ZERO", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_ZERO)([^a-zA-Z_0-9]+.*|)$"}, rep394, segs + 1005, lines + 327, 1, 0, 7},
+    {"AF_LESS", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_LESS)([^a-zA-Z_0-9]+.*|)$"}, rep406, segs + 1017, lines + 327, 1, 0, 7},
+    {"ZF_LESS", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_LESS)([^a-zA-Z_0-9]+.*|)$"}, rep414, segs + 1025, lines + 327, 1, 0, 7},
+    {"SMP_OFF", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SMP_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep421, segs + 1032, lines + 327, 1, 0, 1},
+    {"SML_OFF", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SML_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep424, segs + 1035, lines + 327, 1, 0, 1},
+    {"PYSM_ON", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYSM_ON)([^a-zA-Z_0-9]+.*|)$"}, rep429, segs + 1040, lines + 327, 1, 0, 1},
+    {"GOURAUD", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GOURAUD)([^a-zA-Z_0-9]+.*|)$"}, rep434, segs + 1045, lines + 328, 1, 0, 9},
+    {"LO_ZERO", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ZERO)([^a-zA-Z_0-9]+.*|)$"}, rep435, segs + 1046, lines + 328, 1, 0, 8},
+    {"LO_ANDR", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ANDR)([^a-zA-Z_0-9]+.*|)$"}, rep437, segs + 1048, lines + 328, 1, 0, 14},
+    {"LO_ANDI", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_ANDI)([^a-zA-Z_0-9]+.*|)$"}, rep439, segs + 1050, lines + 328, 1, 0, 15},
+    {"LO_XNOR", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_XNOR)([^a-zA-Z_0-9]+.*|)$"}, rep444, segs + 1055, lines + 328, 1, 0, 8},
+    {"LO_NDST", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_NDST)([^a-zA-Z_0-9]+.*|)$"}, rep445, segs + 1056, lines + 328, 1, 0, 9},
+    {"LO_NSRC", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_NSRC)([^a-zA-Z_0-9]+.*|)$"}, rep447, segs + 1058, lines + 328, 1, 0, 16},
+    {"LO_NAND", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LO_NAND)([^a-zA-Z_0-9]+.*|)$"}, rep449, segs + 1060, lines + 328, 1, 0, 7},
+    {"ST_KEEP", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_KEEP)([^a-zA-Z_0-9]+.*|)$"}, rep451, segs + 1062, lines + 328, 1, 0, 7},
+    {"ST_ZERO", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_ZERO)([^a-zA-Z_0-9]+.*|)$"}, rep452, segs + 1063, lines + 328, 1, 0, 7},
+    {"ST_INCR", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_INCR)([^a-zA-Z_0-9]+.*|)$"}, rep454, segs + 1065, lines + 328, 1, 0, 7},
+    {"ST_DECR", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_DECR)([^a-zA-Z_0-9]+.*|)$"}, rep455, segs + 1066, lines + 328, 1, 0, 7},
+    {"SF_LESS", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_LESS)([^a-zA-Z_0-9]+.*|)$"}, rep458, segs + 1069, lines + 328, 1, 0, 7},
+    {"PM_SIZE", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_SIZE)([^a-zA-Z_0-9]+.*|)$"}, rep484, segs + 1095, lines + 341, 1, 1, 8},
+    {"PM_TTOB", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_TTOB)([^a-zA-Z_0-9]+.*|)$"}, rep487, segs + 1098, lines + 344, 1, 1, 8},
+    {"PM_RTOL", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_RTOL)([^a-zA-Z_0-9]+.*|)$"}, rep488, segs + 1099, lines + 345, 1, 1, 8},
+    {"PM_WARP", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_WARP)([^a-zA-Z_0-9]+.*|)$"}, rep490, segs + 1101, lines + 347, 1, 1, 8},
+    {"AC_MULT", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_MULT)([^a-zA-Z_0-9]+.*|)$"}, rep504, segs + 1115, lines + 358, 1, 0, 7},
+    {"GD_ZMIN", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_ZMIN)([^a-zA-Z_0-9]+.*|)$"}, rep513, segs + 1124, lines + 362, 1, 1, 8},
+    {"GD_ZMAX", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_ZMAX)([^a-zA-Z_0-9]+.*|)$"}, rep514, segs + 1125, lines + 363, 1, 1, 8},
+    {"GD_WSYS", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_WSYS)([^a-zA-Z_0-9]+.*|)$"}, rep555, segs + 1166, lines + 400, 1, 1, 8},
+    {"MSINGLE", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(MSINGLE)([^a-zA-Z_0-9]+.*|)$"}, rep579, segs + 1190, lines + 430, 1, 1, 12},
+    {"TX_WRAP", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_WRAP)([^a-zA-Z_0-9]+.*|)$"}, rep598, segs + 1209, lines + 433, 1, 1, 11},
+    {"TX_TILE", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_TILE)([^a-zA-Z_0-9]+.*|)$"}, rep601, segs + 1212, lines + 434, 1, 1, 11},
+    {"TX_NULL", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_NULL)([^a-zA-Z_0-9]+.*|)$"}, rep603, segs + 1214, lines + 436, 1, 0, 0},
+    {"TV_NULL", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_NULL)([^a-zA-Z_0-9]+.*|)$"}, rep604, segs + 1215, lines + 436, 1, 0, 0},
+    {"TV_ENV0", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_ENV0)([^a-zA-Z_0-9]+.*|)$"}, rep626, segs + 1237, lines + 445, 1, 0, 14},
+    {"GC_ZMIN", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_ZMIN)([^a-zA-Z_0-9]+.*|)$"}, rep634, segs + 1245, lines + 445, 1, 1, 8},
+    {"GC_ZMAX", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_ZMAX)([^a-zA-Z_0-9]+.*|)$"}, rep635, segs + 1246, lines + 446, 1, 1, 9},
+    {"Boolean", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Boolean)([^a-zA-Z_0-9]+.*|)$"}, rep646, segs + 1257, lines + 455, 1, 0, 9},
+    {"Lstring", 7, 7, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Lstring)([^a-zA-Z_0-9]+.*|)$"}, rep648, segs + 1259, lines + 455, 1, 0, 7},
+    {"winpush", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winpush[ \t]*)(\\(.*)$"}, rep664, segs + 1275, lines + 462, 1, 1, 0},
+    {"winopen", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winopen[ \t]*)(\\(.*)$"}, rep667, segs + 1278, lines + 465, 1, 1, 0},
+    {"winmove", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winmove[ \t]*)(\\(.*)$"}, rep668, segs + 1279, lines + 466, 1, 1, 0},
+    {"setbell", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setbell[ \t]*)(\\(.*)$"}, rep685, segs + 1296, lines + 483, 1, 1, 0},
+    {"getsize", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getsize[ \t]*)(\\(.*)$"}, rep706, segs + 1317, lines + 505, 1, 1, 0},
+    {"dglopen", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(dglopen[ \t]*)(\\(.*)$"}, rep716, segs + 1327, lines + 515, 1, 1, 0},
+    {"cursoff", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(cursoff[ \t]*)(\\(.*)$"}, rep723, segs + 1334, lines + 522, 1, 1, 0},
+    {"RGBmode", 7, 7, Rule::simple, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBmode[ \t]*)(\\(.*)$"}, rep736, segs + 1347, lines + 535, 1, 1, 42},
+    {"getport", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getport[ \t]*)(\\(.*)$"}, rep738, segs + 1349, lines + 537, 1, 1, 0},
+    {"maxsize", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(maxsize[ \t]*)(\\(.*)$"}, rep740, segs + 1351, lines + 539, 1, 1, 0},
+    {"minsize", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(minsize[ \t]*)(\\(.*)$"}, rep741, segs + 1352, lines + 540, 1, 1, 0},
+    {"lampoff", 7, 7, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(lampoff[ \t]*)(\\(.*)$"}, rep744, segs + 1355, lines + 543, 1, 1, 0},
+    {"qdevice", 7, 7, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qdevice[ \t]*)(\\(.*)$"}, rep751, segs + 1362, lines + 550, 1, 1, 0},
+    {"TWOSIDE", 7, 7, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(TWOSIDE)([^a-zA-Z_0-9]+.*|)$"}, rep775, segs + 1386, lines + 566, 1, 1, 23},
+    {"DIFFUSE", 7, 7, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(DIFFUSE)([^a-zA-Z_0-9]+.*|)$"}, rep786, segs + 1397, lines + 576, 1, 1, 10},
+    {"AMBIENT", 7, 7, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(AMBIENT)([^a-zA-Z_0-9]+.*|)$"}, rep787, segs + 1398, lines + 577, 1, 3, 10},
+    {"bgntmesh", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgntmesh[ \t]*)(\\(.*)$"}, rep2, segs + 2, lines + 0, 1, 0, 26},
+    {"endtmesh", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endtmesh[ \t]*)(\\(.*)$"}, rep3, segs + 3, lines + 0, 1, 0, 7},
+    {"bgnpoint", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnpoint[ \t]*)(\\(.*)$"}, rep8, segs + 8, lines + 1, 1, 0, 18},
+    {"endpoint", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endpoint[ \t]*)(\\(.*)$"}, rep9, segs + 9, lines + 1, 1, 0, 7},
+    {"getshade", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getshade[ \t]*)(\\(.*)$"}, rep16, segs + 16, lines + 6, 1, 2, 49},
+    {"getcolor", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getcolor[ \t]*)(\\(.*)$"}, rep17, segs + 17, lines + 8, 1, 2, 48},
+    {"bgncurve", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgncurve[ \t]*)(\\(.*)$"}, rep18, segs + 18, lines + 10, 1, 1, 20},
+    {"closeobj", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(closeobj[ \t]*)(\\(.*)$"}, rep21, segs + 21, lines + 13, 1, 0, 11},
+    {"endcurve", 8, 8, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endcurve[ \t]*)(\\(.*)$"}, rep22, segs + 22, lines + 13, 1, 1, 18},
+    {"addtopup", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(addtopup[ \t]*)(\\(.*)$"}, rep37, segs + 37, lines + 19, 1, 1, 0},
+    {"subpixel", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(subpixel[ \t]*)(\\(.*)$"}, rep38, segs + 38, lines + 20, 1, 1, 0},
+    {"RGBrange", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBrange[ \t]*)(\\(.*)$"}, rep48, segs + 48, lines + 31, 1, 1, 0},
+    {"callfunc", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(callfunc[ \t]*)(\\(.*)$"}, rep52, segs + 52, lines + 35, 1, 1, 0},
+    {"defbasis", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(defbasis[ \t]*)(\\(.*)$"}, rep57, segs + 57, lines + 40, 1, 1, 0},
+    {"deflfont", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(deflfont[ \t]*)(\\(.*)$"}, rep58, segs + 58, lines + 41, 1, 1, 0},
+    {"depthcue", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(depthcue[ \t]*)(\\(.*)$"}, rep61, segs + 61, lines + 44, 1, 1, 0},
+    {"glcompat", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(glcompat[ \t]*)(\\(.*)$"}, rep78, segs + 78, lines + 62, 1, 1, 0},
+    {"gversion", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gversion[ \t]*)(\\(.*)$"}, rep80, segs + 80, lines + 64, 1, 1, 0},
+    {"lsbackup", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lsbackup[ \t]*)(\\(.*)$"}, rep82, segs + 82, lines + 66, 1, 1, 0},
+    {"strwidth", 8, 8, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(strwidth[ \t]*)(\\(.*)$"}, rep92, segs + 92, lines + 76, 1, 1, 0},
+    {"RGBcolor", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBcolor[ \t]*)(\\(.*)$"}, rep146, segs + 175, lines + 107, 4, 0, 16},
+    {"setshade", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setshade[ \t]*)(\\(.*)$"}, rep159, segs + 216, lines + 109, 2, 0, 10},
+    {"getdepth", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdepth[ \t]*)(\\(.*)$"}, rep163, segs + 226, lines + 110, 3, 1, 112},
+    {"drawmode", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(drawmode[ \t]*)(\\(.*)$"}, rep193, segs + 334, lines + 144, 1, 1, 46},
+    {"feedback", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(feedback[ \t]*)(\\(.*)$"}, rep196, segs + 337, lines + 149, 3, 0, 61},
+    {"backface", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(backface[ \t]*)(\\(.*)$"}, rep201, segs + 351, lines + 152, 3, 0, 89},
+    {"getgdesc", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getgdesc[ \t]*)(\\(.*)$"}, rep217, segs + 400, lines + 171, 2, 5, 32},
+    {"getmmode", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getmmode[ \t]*)(\\(.*)$"}, rep219, segs + 404, lines + 178, 1, 2, 46},
+    {"gRGBmask", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gRGBmask[ \t]*)(\\(.*)$"}, rep231, segs + 427, lines + 198, 4, 0, 92},
+    {"lcharstr", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lcharstr[ \t]*)(\\(.*)$"}, rep234, segs + 436, lines + 199, 4, 1, 26},
+    {"loadname", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(loadname[ \t]*)(\\(.*)$"}, rep240, segs + 449, lines + 206, 2, 0, 12},
+    {"rectread", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectread[ \t]*)(\\(.*)$"}, rep244, segs + 472, lines + 208, 8, 1, 62},
+    {"setdepth", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setdepth[ \t]*)(\\(.*)$"}, rep248, segs + 499, lines + 212, 3, 1, 16},
+    {"lsrepeat", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lsrepeat[ \t]*)(\\(.*)$"}, rep249, segs + 502, lines + 213, 2, 1, 24},
+    {"underlay", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(underlay[ \t]*)(\\(.*)$"}, rep263, segs + 550, lines + 226, 1, 1, 42},
+    {"picksize", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(picksize[ \t]*)(\\(.*)$"}, rep279, segs + 603, lines + 232, 3, 1, 33},
+    {"pixmodef", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pixmodef[ \t]*)(\\(.*)$"}, rep281, segs + 609, lines + 235, 3, 2, 19},
+    {"pntsizef", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pntsizef[ \t]*)(\\(.*)$"}, rep289, segs + 635, lines + 243, 2, 0, 24},
+    {"polymode", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polymode[ \t]*)(\\(.*)$"}, rep303, segs + 675, lines + 243, 2, 0, 34},
+    {"pushname", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pushname[ \t]*)(\\(.*)$"}, rep305, segs + 679, lines + 243, 2, 0, 12},
+    {"pwlcurve", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pwlcurve[ \t]*)(\\(.*)$"}, rep306, segs + 681, lines + 243, 5, 2, 26},
+    {"rectcopy", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectcopy[ \t]*)(\\(.*)$"}, rep329, segs + 782, lines + 272, 9, 0, 54},
+    {"rectzoom", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectzoom[ \t]*)(\\(.*)$"}, rep330, segs + 791, lines + 272, 3, 0, 15},
+    {"stensize", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(stensize[ \t]*)(\\(.*)$"}, rep365, segs + 922, lines + 297, 2, 0, 27},
+    {"viewport", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(viewport[ \t]*)(\\(.*)$"}, rep367, segs + 926, lines + 297, 13, 0, 65},
+    {"writeRGB", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(writeRGB[ \t]*)(\\(.*)$"}, rep372, segs + 956, lines + 298, 5, 2, 47},
+    {"texdef2d", 8, 8, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(texdef2d[ \t]*)(\\(.*)$"}, rep382, segs + 980, lines + 313, 6, 6, 99},
+    {"SRC_AUTO", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_AUTO)([^a-zA-Z_0-9]+.*|)$"}, rep386, segs + 997, lines + 321, 1, 1, 7},
+    {"SRC_BACK", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_BACK)([^a-zA-Z_0-9]+.*|)$"}, rep387, segs + 998, lines + 322, 1, 0, 7},
+    {"SRC_OVER", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_OVER)([^a-zA-Z_0-9]+.*|)$"}, rep391, segs + 1002, lines + 324, 1, 1, 7},
+    {"AF_NEVER", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_NEVER)([^a-zA-Z_0-9]+.*|)$"}, rep405, segs + 1016, lines + 327, 1, 0, 8},
+    {"AF_EQUAL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_EQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep407, segs + 1018, lines + 327, 1, 0, 8},
+    {"ZF_NEVER", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_NEVER)([^a-zA-Z_0-9]+.*|)$"}, rep413, segs + 1024, lines + 327, 1, 0, 8},
+    {"ZF_EQUAL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_EQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep415, segs + 1026, lines + 327, 1, 0, 8},
+    {"PYSM_OFF", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYSM_OFF)([^a-zA-Z_0-9]+.*|)$"}, rep428, segs + 1039, lines + 327, 1, 0, 1},
+    {"SF_NEVER", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_NEVER)([^a-zA-Z_0-9]+.*|)$"}, rep457, segs + 1068, lines + 328, 1, 0, 8},
+    {"SF_EQUAL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_EQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep459, segs + 1070, lines + 328, 1, 0, 8},
+    {"PYM_FILL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYM_FILL)([^a-zA-Z_0-9]+.*|)$"}, rep465, segs + 1076, lines + 328, 1, 0, 7},
+    {"PYM_LINE", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYM_LINE)([^a-zA-Z_0-9]+.*|)$"}, rep467, segs + 1078, lines + 328, 1, 0, 7},
+    {"PM_SHIFT", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_SHIFT)([^a-zA-Z_0-9]+.*|)$"}, rep479, segs + 1090, lines + 336, 1, 1, 9},
+    {"PM_ADD24", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_ADD24)([^a-zA-Z_0-9]+.*|)$"}, rep483, segs + 1094, lines + 340, 1, 1, 9},
+    {"PM_ZDATA", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_ZDATA)([^a-zA-Z_0-9]+.*|)$"}, rep489, segs + 1100, lines + 346, 1, 1, 9},
+    {"AC_CLEAR", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_CLEAR)([^a-zA-Z_0-9]+.*|)$"}, rep500, segs + 1111, lines + 355, 1, 3, 9},
+    {"GD_XPMAX", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_XPMAX)([^a-zA-Z_0-9]+.*|)$"}, rep509, segs + 1120, lines + 358, 1, 1, 9},
+    {"GD_YPMAX", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_YPMAX)([^a-zA-Z_0-9]+.*|)$"}, rep510, segs + 1121, lines + 359, 1, 1, 9},
+    {"GD_XMMAX", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_XMMAX)([^a-zA-Z_0-9]+.*|)$"}, rep511, segs + 1122, lines + 360, 1, 1, 9},
+    {"GD_YMMAX", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_YMMAX)([^a-zA-Z_0-9]+.*|)$"}, rep512, segs + 1123, lines + 361, 1, 1, 9},
+    {"GD_BLEND", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BLEND)([^a-zA-Z_0-9]+.*|)$"}, rep533, segs + 1144, lines + 371, 1, 2, 8},
+    {"GD_DBBOX", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_DBBOX)([^a-zA-Z_0-9]+.*|)$"}, rep563, segs + 1174, lines + 408, 1, 1, 9},
+    {"MVIEWING", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(MVIEWING)([^a-zA-Z_0-9]+.*|)$"}, rep581, segs + 1192, lines + 431, 1, 0, 12},
+    {"MTEXTURE", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(MTEXTURE)([^a-zA-Z_0-9]+.*|)$"}, rep582, segs + 1193, lines + 431, 1, 0, 10},
+    {"LMC_NULL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_NULL)([^a-zA-Z_0-9]+.*|)$"}, rep595, segs + 1206, lines + 432, 1, 1, 12},
+    {"TX_POINT", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_POINT)([^a-zA-Z_0-9]+.*|)$"}, rep605, segs + 1216, lines + 436, 1, 0, 10},
+    {"TV_BLEND", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_BLEND)([^a-zA-Z_0-9]+.*|)$"}, rep613, segs + 1224, lines + 436, 1, 1, 8},
+    {"TV_DECAL", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_DECAL)([^a-zA-Z_0-9]+.*|)$"}, rep614, segs + 1225, lines + 437, 1, 0, 8},
+    {"TV_COLOR", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_COLOR)([^a-zA-Z_0-9]+.*|)$"}, rep615, segs + 1226, lines + 437, 1, 1, 20},
+    {"TX_CLAMP", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_CLAMP)([^a-zA-Z_0-9]+.*|)$"}, rep619, segs + 1230, lines + 438, 1, 0, 8},
+    {"RGBvalue", 8, 8, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBvalue)([^a-zA-Z_0-9]+.*|)$"}, rep656, segs + 1267, lines + 456, 1, 0, 6},
+    {"wintitle", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(wintitle[ \t]*)(\\(.*)$"}, rep662, segs + 1273, lines + 460, 1, 1, 0},
+    {"windepth", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(windepth[ \t]*)(\\(.*)$"}, rep670, segs + 1281, lines + 468, 1, 1, 0},
+    {"winclose", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winclose[ \t]*)(\\(.*)$"}, rep672, segs + 1283, lines + 470, 1, 1, 0},
+    {"videocmd", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(videocmd[ \t]*)(\\(.*)$"}, rep673, segs + 1284, lines + 471, 1, 1, 0},
+    {"textport", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(textport[ \t]*)(\\(.*)$"}, rep676, segs + 1287, lines + 474, 1, 1, 0},
+    {"textinit", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(textinit[ \t]*)(\\(.*)$"}, rep677, segs + 1288, lines + 475, 1, 1, 0},
+    {"swinopen", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(swinopen[ \t]*)(\\(.*)$"}, rep679, segs + 1290, lines + 477, 1, 1, 0},
+    {"stepunit", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(stepunit[ \t]*)(\\(.*)$"}, rep680, segs + 1291, lines + 478, 1, 1, 0},
+    {"setvideo", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setvideo[ \t]*)(\\(.*)$"}, rep681, segs + 1292, lines + 479, 1, 1, 0},
+    {"ringbell", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(ringbell[ \t]*)(\\(.*)$"}, rep689, segs + 1300, lines + 487, 1, 1, 0},
+    {"prefsize", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(prefsize[ \t]*)(\\(.*)$"}, rep692, segs + 1303, lines + 490, 1, 1, 0},
+    {"noborder", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(noborder[ \t]*)(\\(.*)$"}, rep694, segs + 1305, lines + 492, 1, 1, 0},
+    {"multimap", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(multimap[ \t]*)(\\(.*)$"}, rep695, segs + 1306, lines + 493, 1, 1, 0},
+    {"mapcolor", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(mapcolor[ \t]*)(\\(.*)$"}, rep697, segs + 1308, lines + 495, 1, 1, 0},
+    {"iconsize", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(iconsize[ \t]*)(\\(.*)$"}, rep700, segs + 1311, lines + 498, 1, 1, 0},
+    {"getwscrn", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getwscrn[ \t]*)(\\(.*)$"}, rep704, segs + 1315, lines + 503, 1, 1, 0},
+    {"getvideo", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getvideo[ \t]*)(\\(.*)$"}, rep705, segs + 1316, lines + 504, 1, 1, 0},
+    {"fullscrn", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(fullscrn[ \t]*)(\\(.*)$"}, rep713, segs + 1324, lines + 512, 1, 1, 0},
+    {"dglclose", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(dglclose[ \t]*)(\\(.*)$"}, rep717, segs + 1328, lines + 516, 1, 1, 0},
+    {"cyclemap", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(cyclemap[ \t]*)(\\(.*)$"}, rep720, segs + 1331, lines + 519, 1, 1, 0},
+    {"curstype", 8, 8, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(curstype[ \t]*)(\\(.*)$"}, rep721, segs + 1332, lines + 520, 1, 1, 0},
+    {"blkqread", 8, 8, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(blkqread[ \t]*)(\\(.*)$"}, rep747, segs + 1358, lines + 546, 1, 1, 0},
+    {"isqueued", 8, 8, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(isqueued[ \t]*)(\\(.*)$"}, rep749, segs + 1360, lines + 548, 1, 1, 0},
+    {"qcontrol", 8, 8, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(qcontrol[ \t]*)(\\(.*)$"}, rep762, segs + 1373, lines + 561, 1, 1, 0},
+    {"MATERIAL", 8, 8, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(MATERIAL)([^a-zA-Z_0-9]+.*|)$"}, rep764, segs + 1375, lines + 564, 1, 1, 8},
+    {"POSITION", 8, 8, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(POSITION)([^a-zA-Z_0-9]+.*|)$"}, rep780, segs + 1391, lines + 572, 1, 0, 11},
+    {"SPECULAR", 8, 8, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(SPECULAR)([^a-zA-Z_0-9]+.*|)$"}, rep785, segs + 1396, lines + 575, 1, 1, 11},
+    {"EMISSION", 8, 8, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(EMISSION)([^a-zA-Z_0-9]+.*|)$"}, rep788, segs + 1399, lines + 580, 1, 1, 11},
+    {"bgnqstrip", 9, 9, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnqstrip[ \t]*)(\\(.*)$"}, rep0, segs + 0, lines + 0, 1, 0, 22},
+    {"endqstrip", 9, 9, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endqstrip[ \t]*)(\\(.*)$"}, rep1, segs + 1, lines + 0, 1, 0, 7},
+    {"popmatrix", 9, 9, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(popmatrix[ \t]*)(\\(.*)$"}, rep13, segs + 13, lines + 4, 1, 0, 13},
+    {"endselect", 9, 9, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endselect[ \t]*)(\\(.*)$"}, rep24, segs + 24, lines + 14, 1, 0, 23},
+    {"initnames", 9, 9, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(initnames[ \t]*)(\\(.*)$"}, rep30, segs + 30, lines + 18, 1, 0, 13},
+    {"swaptmesh", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(swaptmesh[ \t]*)(\\(.*)$"}, rep47, segs + 47, lines + 30, 1, 1, 0},
+    {"lRGBrange", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lRGBrange[ \t]*)(\\(.*)$"}, rep49, segs + 49, lines + 32, 1, 1, 0},
+    {"chunksize", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(chunksize[ \t]*)(\\(.*)$"}, rep53, segs + 53, lines + 36, 1, 1, 0},
+    {"getheight", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getheight[ \t]*)(\\(.*)$"}, rep72, segs + 72, lines + 56, 1, 1, 0},
+    {"getlstyle", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getlstyle[ \t]*)(\\(.*)$"}, rep75, segs + 75, lines + 59, 1, 1, 0},
+    {"getscrbox", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getscrbox[ \t]*)(\\(.*)$"}, rep77, segs + 77, lines + 61, 1, 1, 0},
+    {"objinsert", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(objinsert[ \t]*)(\\(.*)$"}, rep86, segs + 86, lines + 70, 1, 1, 0},
+    {"pagecolor", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pagecolor[ \t]*)(\\(.*)$"}, rep88, segs + 88, lines + 72, 1, 1, 0},
+    {"lstrwidth", 9, 9, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lstrwidth[ \t]*)(\\(.*)$"}, rep93, segs + 93, lines + 77, 1, 1, 0},
+    {"translate", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(translate[ \t]*)(\\(.*)$"}, rep143, segs + 167, lines + 107, 4, 0, 18},
+    {"afunction", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(afunction[ \t]*)(\\(.*)$"}, rep161, segs + 219, lines + 110, 4, 0, 95},
+    {"clipplane", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(clipplane[ \t]*)(\\(.*)$"}, rep180, segs + 303, lines + 124, 5, 1, 110},
+    {"fogvertex", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(fogvertex[ \t]*)(\\(.*)$"}, rep197, segs + 340, lines + 149, 4, 1, 58},
+    {"frontface", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(frontface[ \t]*)(\\(.*)$"}, rep200, segs + 348, lines + 152, 3, 0, 88},
+    {"getmatrix", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getmatrix[ \t]*)(\\(.*)$"}, rep218, segs + 402, lines + 176, 2, 2, 34},
+    {"getplanes", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getplanes[ \t]*)(\\(.*)$"}, rep223, segs + 408, lines + 187, 1, 2, 42},
+    {"gRGBcolor", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gRGBcolor[ \t]*)(\\(.*)$"}, rep230, segs + 423, lines + 197, 4, 1, 84},
+    {"linewidth", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(linewidth[ \t]*)(\\(.*)$"}, rep236, segs + 442, lines + 200, 2, 0, 24},
+    {"getlwidth", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getlwidth[ \t]*)(\\(.*)$"}, rep237, segs + 444, lines + 200, 1, 4, 41},
+    {"lrectread", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lrectread[ \t]*)(\\(.*)$"}, rep243, segs + 464, lines + 207, 8, 1, 54},
+    {"rectwrite", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(rectwrite[ \t]*)(\\(.*)$"}, rep246, segs + 488, lines + 210, 8, 1, 76},
+    {"lsetdepth", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lsetdepth[ \t]*)(\\(.*)$"}, rep247, segs + 496, lines + 211, 3, 1, 16},
+    {"objdelete", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(objdelete[ \t]*)(\\(.*)$"}, rep259, segs + 532, lines + 223, 5, 2, 34},
+    {"pntsmooth", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pntsmooth[ \t]*)(\\(.*)$"}, rep290, segs + 637, lines + 243, 2, 0, 65},
+    {"polymooth", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polymooth[ \t]*)(\\(.*)$"}, rep304, segs + 677, lines + 243, 2, 0, 69},
+    {"writemask", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(writemask[ \t]*)(\\(.*)$"}, rep370, segs + 951, lines + 297, 2, 0, 13},
+    {"zfunction", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zfunction[ \t]*)(\\(.*)$"}, rep374, segs + 963, lines + 300, 2, 0, 13},
+    {"getbuffer", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getbuffer[ \t]*)(\\(.*)$"}, rep377, segs + 968, lines + 303, 1, 2, 44},
+    {"getcmmode", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getcmmode[ \t]*)(\\(.*)$"}, rep378, segs + 969, lines + 305, 1, 2, 41},
+    {"polarview", 9, 9, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polarview[ \t]*)(\\(.*)$"}, rep385, segs + 992, lines + 321, 5, 0, 124},
+    {"SRC_FRONT", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_FRONT)([^a-zA-Z_0-9]+.*|)$"}, rep388, segs + 999, lines + 322, 1, 0, 8},
+    {"SRC_UNDER", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_UNDER)([^a-zA-Z_0-9]+.*|)$"}, rep392, segs + 1003, lines + 325, 1, 1, 7},
+    {"AF_LEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_LEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep408, segs + 1019, lines + 327, 1, 0, 9},
+    {"AF_GEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_GEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep411, segs + 1022, lines + 327, 1, 0, 9},
+    {"AF_ALWAYS", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_ALWAYS)([^a-zA-Z_0-9]+.*|)$"}, rep412, segs + 1023, lines + 327, 1, 0, 9},
+    {"ZF_LEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_LEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep416, segs + 1027, lines + 327, 1, 0, 9},
+    {"ZF_GEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_GEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep419, segs + 1030, lines + 327, 1, 0, 9},
+    {"ZF_ALWAYS", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_ALWAYS)([^a-zA-Z_0-9]+.*|)$"}, rep420, segs + 1031, lines + 327, 1, 0, 9},
+    {"ST_INVERT", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_INVERT)([^a-zA-Z_0-9]+.*|)$"}, rep456, segs + 1067, lines + 328, 1, 0, 9},
+    {"SF_LEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_LEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep460, segs + 1071, lines + 328, 1, 0, 9},
+    {"SF_GEQUAL", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_GEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep463, segs + 1074, lines + 328, 1, 0, 9},
+    {"SF_ALWAYS", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_ALWAYS)([^a-zA-Z_0-9]+.*|)$"}, rep464, segs + 1075, lines + 328, 1, 0, 9},
+    {"PYM_POINT", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYM_POINT)([^a-zA-Z_0-9]+.*|)$"}, rep466, segs + 1077, lines + 328, 1, 0, 8},
+    {"FG_DEFINE", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_DEFINE)([^a-zA-Z_0-9]+.*|)$"}, rep472, segs + 1083, lines + 329, 1, 1, 13},
+    {"PM_EXPAND", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_EXPAND)([^a-zA-Z_0-9]+.*|)$"}, rep480, segs + 1091, lines + 337, 1, 1, 10},
+    {"PM_OFFSET", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_OFFSET)([^a-zA-Z_0-9]+.*|)$"}, rep485, segs + 1096, lines + 342, 1, 1, 10},
+    {"PM_STRIDE", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_STRIDE)([^a-zA-Z_0-9]+.*|)$"}, rep486, segs + 1097, lines + 343, 1, 1, 10},
+    {"PM_XSTART", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_XSTART)([^a-zA-Z_0-9]+.*|)$"}, rep495, segs + 1106, lines + 352, 1, 1, 10},
+    {"PM_YSTART", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PM_YSTART)([^a-zA-Z_0-9]+.*|)$"}, rep496, segs + 1107, lines + 353, 1, 1, 10},
+    {"AC_RETURN", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_RETURN)([^a-zA-Z_0-9]+.*|)$"}, rep503, segs + 1114, lines + 358, 1, 0, 9},
+    {"CP_DEFINE", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(CP_DEFINE)([^a-zA-Z_0-9]+.*|)$"}, rep508, segs + 1119, lines + 358, 1, 0, 1},
+    {"GD_DITHER", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_DITHER)([^a-zA-Z_0-9]+.*|)$"}, rep536, segs + 1147, lines + 375, 1, 2, 9},
+    {"GD_NSCRNS", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_NSCRNS)([^a-zA-Z_0-9]+.*|)$"}, rep540, segs + 1151, lines + 383, 1, 1, 10},
+    {"GD_STEREO", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_STEREO)([^a-zA-Z_0-9]+.*|)$"}, rep550, segs + 1161, lines + 396, 1, 0, 9},
+    {"GD_NMMAPS", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_NMMAPS)([^a-zA-Z_0-9]+.*|)$"}, rep560, segs + 1171, lines + 405, 1, 1, 10},
+    {"GD_SCRBOX", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_SCRBOX)([^a-zA-Z_0-9]+.*|)$"}, rep574, segs + 1185, lines + 422, 1, 1, 10},
+    {"LMC_COLOR", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_COLOR)([^a-zA-Z_0-9]+.*|)$"}, rep589, segs + 1200, lines + 431, 1, 1, 13},
+    {"TX_WRAP_S", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_WRAP_S)([^a-zA-Z_0-9]+.*|)$"}, rep599, segs + 1210, lines + 434, 1, 0, 17},
+    {"TX_WRAP_T", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_WRAP_T)([^a-zA-Z_0-9]+.*|)$"}, rep600, segs + 1211, lines + 434, 1, 0, 17},
+    {"TX_BORDER", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_BORDER)([^a-zA-Z_0-9]+.*|)$"}, rep602, segs + 1213, lines + 435, 1, 1, 13},
+    {"TX_MIPMAP", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MIPMAP)([^a-zA-Z_0-9]+.*|)$"}, rep607, segs + 1218, lines + 436, 1, 0, 24},
+    {"TX_REPEAT", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_REPEAT)([^a-zA-Z_0-9]+.*|)$"}, rep618, segs + 1229, lines + 438, 1, 0, 9},
+    {"TX_SELECT", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_SELECT)([^a-zA-Z_0-9]+.*|)$"}, rep620, segs + 1231, lines + 438, 1, 1, 10},
+    {"TG_LINEAR", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TG_LINEAR)([^a-zA-Z_0-9]+.*|)$"}, rep624, segs + 1235, lines + 445, 1, 0, 13},
+    {"GC_STEREO", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_STEREO)([^a-zA-Z_0-9]+.*|)$"}, rep643, segs + 1254, lines + 455, 1, 0, 9},
+    {"GC_DOUBLE", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_DOUBLE)([^a-zA-Z_0-9]+.*|)$"}, rep644, segs + 1255, lines + 455, 1, 0, 15},
+    {"Pattern16", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Pattern16)([^a-zA-Z_0-9]+.*|)$"}, rep657, segs + 1268, lines + 456, 1, 1, 8},
+    {"Pattern32", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Pattern32)([^a-zA-Z_0-9]+.*|)$"}, rep658, segs + 1269, lines + 457, 1, 1, 8},
+    {"Pattern64", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Pattern64)([^a-zA-Z_0-9]+.*|)$"}, rep659, segs + 1270, lines + 458, 1, 1, 8},
+    {"Linestyle", 9, 9, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Linestyle)([^a-zA-Z_0-9]+.*|)$"}, rep660, segs + 1271, lines + 459, 1, 1, 8},
+    {"textcolor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(textcolor[ \t]*)(\\(.*)$"}, rep678, segs + 1289, lines + 476, 1, 1, 0},
+    {"icontitle", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(icontitle[ \t]*)(\\(.*)$"}, rep699, segs + 1310, lines + 497, 1, 1, 0},
+    {"getorigin", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getorigin[ \t]*)(\\(.*)$"}, rep707, segs + 1318, lines + 506, 1, 1, 0},
+    {"getmcolor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getmcolor[ \t]*)(\\(.*)$"}, rep708, segs + 1319, lines + 507, 1, 1, 0},
+    {"getbutton", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getbutton[ \t]*)(\\(.*)$"}, rep711, segs + 1322, lines + 510, 1, 1, 0},
+    {"gammaramp", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(gammaramp[ \t]*)(\\(.*)$"}, rep712, segs + 1323, lines + 511, 1, 1, 0},
+    {"defcursor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(defcursor[ \t]*)(\\(.*)$"}, rep719, segs + 1330, lines + 518, 1, 1, 0},
+    {"curorigin", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(curorigin[ \t]*)(\\(.*)$"}, rep724, segs + 1335, lines + 523, 1, 1, 0},
+    {"blanktime", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(blanktime[ \t]*)(\\(.*)$"}, rep726, segs + 1337, lines + 525, 1, 1, 0},
+    {"winattach", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winattach[ \t]*)(\\(.*)$"}, rep728, segs + 1339, lines + 527, 1, 1, 0},
+    {"setcursor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setcursor[ \t]*)(\\(.*)$"}, rep729, segs + 1340, lines + 528, 1, 1, 0},
+    {"RGBcursor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBcursor[ \t]*)(\\(.*)$"}, rep730, segs + 1341, lines + 529, 1, 1, 0},
+    {"getcursor", 9, 9, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getcursor[ \t]*)(\\(.*)$"}, rep731, segs + 1342, lines + 530, 1, 1, 0},
+    {"unqdevice", 9, 9, Rule::deleted, Rule::queue, 578, {"^(.*[^a-zA-Z_0-9]+|)(unqdevice[ \t]*)(\\(.*)$"}, rep759, segs + 1370, lines + 558, 1, 1, 0},
+    {"unqdevice", 9, 9, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(unqdevice[ \t]*)(\\(.*)$"}, rep760, segs + 1371, lines + 559, 1, 1, 0},
+    {"MAXLIGHTS", 9, 9, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(MAXLIGHTS)([^a-zA-Z_0-9]+.*|)$"}, rep763, segs + 1374, lines + 562, 1, 2, 41},
+    {"SPOTLIGHT", 9, 9, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(SPOTLIGHT)([^a-zA-Z_0-9]+.*|)$"}, rep779, segs + 1390, lines + 570, 1, 2, 13},
+    {"SHININESS", 9, 9, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(SHININESS)([^a-zA-Z_0-9]+.*|)$"}, rep784, segs + 1395, lines + 575, 1, 0, 12},
+    {"bgnpolygon", 10, 10, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnpolygon[ \t]*)(\\(.*)$"}, rep10, segs + 10, lines + 1, 1, 3, 19},
+    {"endpolygon", 10, 10, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endpolygon[ \t]*)(\\(.*)$"}, rep11, segs + 11, lines + 4, 1, 0, 7},
+    {"pushmatrix", 10, 10, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pushmatrix[ \t]*)(\\(.*)$"}, rep12, segs + 12, lines + 4, 1, 0, 14},
+    {"bgnsurface", 10, 10, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnsurface[ \t]*)(\\(.*)$"}, rep19, segs + 19, lines + 11, 1, 1, 22},
+    {"endsurface", 10, 10, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endsurface[ \t]*)(\\(.*)$"}, rep25, segs + 25, lines + 14, 1, 1, 20},
+    {"endpupmode", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endpupmode[ \t]*)(\\(.*)$"}, rep41, segs + 41, lines + 24, 1, 1, 0},
+    {"gRGBcursor", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gRGBcursor[ \t]*)(\\(.*)$"}, rep43, segs + 43, lines + 26, 1, 1, 0},
+    {"shaderange", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(shaderange[ \t]*)(\\(.*)$"}, rep50, segs + 50, lines + 33, 1, 1, 0},
+    {"compactify", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(compactify[ \t]*)(\\(.*)$"}, rep55, segs + 55, lines + 38, 1, 1, 0},
+    {"foreground", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(foreground[ \t]*)(\\(.*)$"}, rep64, segs + 64, lines + 48, 1, 1, 0},
+    {"gethitcode", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(gethitcode[ \t]*)(\\(.*)$"}, rep73, segs + 73, lines + 57, 1, 1, 0},
+    {"getresetls", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getresetls[ \t]*)(\\(.*)$"}, rep76, segs + 76, lines + 60, 1, 1, 0},
+    {"objreplace", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(objreplace[ \t]*)(\\(.*)$"}, rep87, segs + 87, lines + 71, 1, 1, 0},
+    {"patchbasis", 10, 10, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(patchbasis[ \t]*)(\\(.*)$"}, rep100, segs + 100, lines + 84, 1, 1, 0},
+    {"loadmatrix", 10, 10, Rule::args, Rule::always, 610, {"^(.*[^a-zA-Z_0-9]+|)(loadmatrix[ \t]*)(\\(.*)$"}, rep144, segs + 171, lines + 107, 2, 0, 15},
+    {"multmatrix", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(multmatrix[ \t]*)(\\(.*)$"}, rep145, segs + 173, lines + 107, 2, 0, 15},
+    {"smoothline", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(smoothline[ \t]*)(\\(.*)$"}, rep164, segs + 229, lines + 111, 2, 0, 61},
+    {"linesmooth", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(linesmooth[ \t]*)(\\(.*)$"}, rep165, segs + 231, lines + 111, 2, 0, 61},
+    {"polysmooth", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(polysmooth[ \t]*)(\\(.*)$"}, rep166, segs + 233, lines + 111, 2, 0, 67},
+    {"curvebasis", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(curvebasis[ \t]*)(\\(.*)$"}, rep184, segs + 312, lines + 130, 1, 1, 29},
+    {"defpattern", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(defpattern[ \t]*)(\\(.*)$"}, rep189, segs + 326, lines + 138, 3, 4, 62},
+    {"backbuffer", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(backbuffer[ \t]*)(\\(.*)$"}, rep199, segs + 346, lines + 151, 2, 1, 37},
+    {"getgconfig", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getgconfig[ \t]*)(\\(.*)$"}, rep216, segs + 398, lines + 169, 2, 2, 32},
+    {"getopenobj", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getopenobj[ \t]*)(\\(.*)$"}, rep221, segs + 406, lines + 182, 1, 2, 42},
+    {"getpattern", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getpattern[ \t]*)(\\(.*)$"}, rep222, segs + 407, lines + 184, 1, 3, 25},
+    {"getscrmask", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getscrmask[ \t]*)(\\(.*)$"}, rep224, segs + 409, lines + 189, 5, 2, 115},
+    {"getzbuffer", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getzbuffer[ \t]*)(\\(.*)$"}, rep228, segs + 421, lines + 197, 1, 0, 26},
+    {"linewidthf", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(linewidthf[ \t]*)(\\(.*)$"}, rep235, segs + 440, lines + 200, 2, 0, 13},
+    {"loadmatrix", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(loadmatrix[ \t]*)(\\(.*)$"}, rep239, segs + 447, lines + 206, 2, 0, 14},
+    {"lrectwrite", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lrectwrite[ \t]*)(\\(.*)$"}, rep245, segs + 480, lines + 209, 8, 1, 68},
+    {"nurbscurve", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(nurbscurve[ \t]*)(\\(.*)$"}, rep257, segs + 514, lines + 219, 7, 2, 32},
+    {"readpixels", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(readpixels[ \t]*)(\\(.*)$"}, rep315, segs + 717, lines + 259, 3, 1, 116},
+    {"readsource", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(readsource[ \t]*)(\\(.*)$"}, rep316, segs + 720, lines + 260, 2, 0, 14},
+    {"setpattern", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setpattern[ \t]*)(\\(.*)$"}, rep356, segs + 891, lines + 294, 3, 3, 85},
+    {"shademodel", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(shademodel[ \t]*)(\\(.*)$"}, rep357, segs + 894, lines + 297, 2, 0, 14},
+    {"swritemask", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(swritemask[ \t]*)(\\(.*)$"}, rep366, segs + 924, lines + 297, 2, 0, 15},
+    {"zwritemask", 10, 10, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(zwritemask[ \t]*)(\\(.*)$"}, rep375, segs + 965, lines + 300, 2, 1, 26},
+    {"AF_GREATER", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_GREATER)([^a-zA-Z_0-9]+.*|)$"}, rep409, segs + 1020, lines + 327, 1, 0, 10},
+    {"ZF_GREATER", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_GREATER)([^a-zA-Z_0-9]+.*|)$"}, rep417, segs + 1028, lines + 327, 1, 0, 10},
+    {"ST_REPLACE", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ST_REPLACE)([^a-zA-Z_0-9]+.*|)$"}, rep453, segs + 1064, lines + 328, 1, 0, 10},
+    {"SF_GREATER", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_GREATER)([^a-zA-Z_0-9]+.*|)$"}, rep461, segs + 1072, lines + 328, 1, 0, 10},
+    {"PYM_HOLLOW", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYM_HOLLOW)([^a-zA-Z_0-9]+.*|)$"}, rep468, segs + 1079, lines + 328, 1, 1, 7},
+    {"FG_VTX_EXP", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_VTX_EXP)([^a-zA-Z_0-9]+.*|)$"}, rep473, segs + 1084, lines + 330, 1, 1, 10},
+    {"FG_VTX_LIN", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_VTX_LIN)([^a-zA-Z_0-9]+.*|)$"}, rep474, segs + 1085, lines + 331, 1, 1, 9},
+    {"FG_PIX_EXP", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_PIX_EXP)([^a-zA-Z_0-9]+.*|)$"}, rep475, segs + 1086, lines + 332, 1, 1, 6},
+    {"FG_PIX_LIN", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_PIX_LIN)([^a-zA-Z_0-9]+.*|)$"}, rep476, segs + 1087, lines + 333, 1, 1, 9},
+    {"NNORMALIZE", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(NNORMALIZE)([^a-zA-Z_0-9]+.*|)$"}, rep499, segs + 1110, lines + 355, 1, 0, 1},
+    {"GD_CIFRACT", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_CIFRACT)([^a-zA-Z_0-9]+.*|)$"}, rep534, segs + 1145, lines + 373, 1, 1, 11},
+    {"GD_LOGICOP", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_LOGICOP)([^a-zA-Z_0-9]+.*|)$"}, rep539, segs + 1150, lines + 381, 1, 2, 10},
+    {"GD_NBLINKS", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_NBLINKS)([^a-zA-Z_0-9]+.*|)$"}, rep542, segs + 1153, lines + 384, 1, 1, 11},
+    {"GD_TIMERHZ", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_TIMERHZ)([^a-zA-Z_0-9]+.*|)$"}, rep562, segs + 1173, lines + 407, 1, 1, 11},
+    {"GD_TEXTURE", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_TEXTURE)([^a-zA-Z_0-9]+.*|)$"}, rep575, segs + 1186, lines + 423, 1, 2, 13},
+    {"TG_CONTOUR", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TG_CONTOUR)([^a-zA-Z_0-9]+.*|)$"}, rep623, segs + 1234, lines + 445, 1, 0, 13},
+    {"GC_MS_ZMIN", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_MS_ZMIN)([^a-zA-Z_0-9]+.*|)$"}, rep640, segs + 1251, lines + 450, 1, 2, 11},
+    {"GC_MS_ZMAX", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_MS_ZMAX)([^a-zA-Z_0-9]+.*|)$"}, rep641, segs + 1252, lines + 452, 1, 2, 11},
+    {"Colorindex", 10, 10, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Colorindex)([^a-zA-Z_0-9]+.*|)$"}, rep655, segs + 1266, lines + 456, 1, 0, 7},
+    {"setmonitor", 10, 10, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setmonitor[ \t]*)(\\(.*)$"}, rep682, segs + 1293, lines + 480, 1, 1, 0},
+    {"scrnselect", 10, 10, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(scrnselect[ \t]*)(\\(.*)$"}, rep686, segs + 1297, lines + 484, 1, 1, 0},
+    {"scrnattach", 10, 10, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(scrnattach[ \t]*)(\\(.*)$"}, rep687, segs + 1298, lines + 485, 1, 1, 0},
+    {"getmonitor", 10, 10, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(getmonitor[ \t]*)(\\(.*)$"}, rep709, segs + 1320, lines + 508, 1, 1, 0},
+    {"keepaspect", 10, 10, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(keepaspect[ \t]*)(\\(.*)$"}, rep739, segs + 1350, lines + 538, 1, 1, 0},
+    {"endfeedback", 11, 11, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endfeedback[ \t]*)(\\(.*)$"}, rep23, segs + 23, lines + 14, 1, 0, 23},
+    {"popviewport", 11, 11, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(popviewport[ \t]*)(\\(.*)$"}, rep34, segs + 34, lines + 18, 1, 1, 13},
+    {"lshaderange", 11, 11, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(lshaderange[ \t]*)(\\(.*)$"}, rep51, segs + 51, lines + 34, 1, 1, 0},
+    {"getlsbackup", 11, 11, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getlsbackup[ \t]*)(\\(.*)$"}, rep74, segs + 74, lines + 58, 1, 1, 0},
+    {"patchcurves", 11, 11, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(patchcurves[ \t]*)(\\(.*)$"}, rep101, segs + 101, lines + 85, 1, 1, 0},
+    {"frontbuffer", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(frontbuffer[ \t]*)(\\(.*)$"}, rep198, segs + 344, lines + 150, 2, 1, 37},
+    {"getdrawmode", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdrawmode[ \t]*)(\\(.*)$"}, rep215, segs + 397, lines + 168, 1, 1, 22},
+    {"getviewport", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getviewport[ \t]*)(\\(.*)$"}, rep226, segs + 415, lines + 193, 5, 2, 110},
+    {"getlsrepeat", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getlsrepeat[ \t]*)(\\(.*)$"}, rep250, segs + 504, lines + 214, 1, 1, 43},
+    {"passthrough", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(passthrough[ \t]*)(\\(.*)$"}, rep264, segs + 551, lines + 227, 2, 0, 15},
+    {"perspective", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(perspective[ \t]*)(\\(.*)$"}, rep277, segs + 595, lines + 227, 5, 0, 136},
+    {"readdisplay", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(readdisplay[ \t]*)(\\(.*)$"}, rep313, segs + 707, lines + 257, 8, 1, 54},
+    {"writepixels", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(writepixels[ \t]*)(\\(.*)$"}, rep371, segs + 953, lines + 297, 3, 1, 45},
+    {"getbackface", 11, 11, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getbackface[ \t]*)(\\(.*)$"}, rep376, segs + 967, lines + 301, 1, 2, 89},
+    {"SRC_ZBUFFER", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_ZBUFFER)([^a-zA-Z_0-9]+.*|)$"}, rep389, segs + 1000, lines + 322, 1, 1, 3},
+    {"AF_NOTEQUAL", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AF_NOTEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep410, segs + 1021, lines + 327, 1, 0, 11},
+    {"ZF_NOTEQUAL", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(ZF_NOTEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep418, segs + 1029, lines + 327, 1, 0, 11},
+    {"PYSM_SHRINK", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYSM_SHRINK)([^a-zA-Z_0-9]+.*|)$"}, rep430, segs + 1041, lines + 327, 1, 1, 1},
+    {"SF_NOTEQUAL", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SF_NOTEQUAL)([^a-zA-Z_0-9]+.*|)$"}, rep462, segs + 1073, lines + 328, 1, 0, 11},
+    {"FG_VTX_EXP2", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_VTX_EXP2)([^a-zA-Z_0-9]+.*|)$"}, rep477, segs + 1088, lines + 334, 1, 1, 7},
+    {"FG_PIX_EXP2", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(FG_PIX_EXP2)([^a-zA-Z_0-9]+.*|)$"}, rep478, segs + 1089, lines + 335, 1, 1, 7},
+    {"GD_SCRNTYPE", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_SCRNTYPE)([^a-zA-Z_0-9]+.*|)$"}, rep558, segs + 1169, lines + 403, 1, 1, 12},
+    {"GD_TEXTPORT", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_TEXTPORT)([^a-zA-Z_0-9]+.*|)$"}, rep559, segs + 1170, lines + 404, 1, 1, 12},
+    {"GD_POLYMODE", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_POLYMODE)([^a-zA-Z_0-9]+.*|)$"}, rep572, segs + 1183, lines + 418, 1, 2, 15},
+    {"GD_FOGPIXEL", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_FOGPIXEL)([^a-zA-Z_0-9]+.*|)$"}, rep576, segs + 1187, lines + 425, 1, 2, 6},
+    {"GD_MUXPIPES", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_MUXPIPES)([^a-zA-Z_0-9]+.*|)$"}, rep578, segs + 1189, lines + 429, 1, 1, 12},
+    {"MPROJECTION", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(MPROJECTION)([^a-zA-Z_0-9]+.*|)$"}, rep580, segs + 1191, lines + 431, 1, 0, 13},
+    {"LMC_AMBIENT", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_AMBIENT)([^a-zA-Z_0-9]+.*|)$"}, rep591, segs + 1202, lines + 432, 1, 0, 10},
+    {"LMC_DIFFUSE", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_DIFFUSE)([^a-zA-Z_0-9]+.*|)$"}, rep592, segs + 1203, lines + 432, 1, 0, 10},
+    {"TX_BILINEAR", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_BILINEAR)([^a-zA-Z_0-9]+.*|)$"}, rep606, segs + 1217, lines + 436, 1, 0, 9},
+    {"TV_MODULATE", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TV_MODULATE)([^a-zA-Z_0-9]+.*|)$"}, rep612, segs + 1223, lines + 436, 1, 0, 11},
+    {"GC_BITS_RED", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_RED)([^a-zA-Z_0-9]+.*|)$"}, rep629, segs + 1240, lines + 445, 1, 0, 11},
+    {"Screencoord", 11, 11, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(Screencoord)([^a-zA-Z_0-9]+.*|)$"}, rep650, segs + 1261, lines + 455, 1, 0, 6},
+    {"winposition", 11, 11, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winposition[ \t]*)(\\(.*)$"}, rep665, segs + 1276, lines + 463, 1, 1, 0},
+    {"setdblights", 11, 11, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(setdblights[ \t]*)(\\(.*)$"}, rep684, segs + 1295, lines + 482, 1, 1, 0},
+    {"screenspace", 11, 11, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(screenspace[ \t]*)(\\(.*)$"}, rep688, segs + 1299, lines + 486, 1, 1, 0},
+    {"endfullscrn", 11, 11, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(endfullscrn[ \t]*)(\\(.*)$"}, rep715, segs + 1326, lines + 514, 1, 1, 0},
+    {"blankscreen", 11, 11, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(blankscreen[ \t]*)(\\(.*)$"}, rep727, segs + 1338, lines + 526, 1, 1, 0},
+    {"swapbuffers", 11, 11, Rule::simple, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(swapbuffers[ \t]*)(\\(.*)$"}, rep732, segs + 1343, lines + 531, 1, 1, 32},
+    {"getvaluator", 11, 11, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(getvaluator[ \t]*)(\\(.*)$"}, rep748, segs + 1359, lines + 547, 1, 1, 0},
+    {"setvaluator", 11, 11, Rule::deleted, Rule::queue, -1, {"^(.*[^a-zA-Z_0-9]+|)(setvaluator[ \t]*)(\\(.*)$"}, rep757, segs + 1368, lines + 556, 1, 1, 0},
+    {"ATTENUATION", 11, 11, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(ATTENUATION)([^a-zA-Z_0-9]+.*|)$"}, rep777, segs + 1388, lines + 567, 1, 2, 23},
+    {"LOCALVIEWER", 11, 11, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(LOCALVIEWER)([^a-zA-Z_0-9]+.*|)$"}, rep778, segs + 1389, lines + 569, 1, 1, 27},
+    {"pushviewport", 12, 12, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pushviewport[ \t]*)(\\(.*)$"}, rep36, segs + 36, lines + 19, 1, 0, 29},
+    {"clearhitcode", 12, 12, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(clearhitcode[ \t]*)(\\(.*)$"}, rep54, segs + 54, lines + 37, 1, 1, 0},
+    {"getdescender", 12, 12, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdescender[ \t]*)(\\(.*)$"}, rep70, segs + 70, lines + 54, 1, 1, 0},
+    {"swapinterval", 12, 12, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(swapinterval[ \t]*)(\\(.*)$"}, rep94, segs + 94, lines + 78, 1, 1, 0},
+    {"scrsubdivide", 12, 12, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(scrsubdivide[ \t]*)(\\(.*)$"}, rep114, segs + 114, lines + 98, 1, 1, 0},
+    {"deflinestyle", 12, 12, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(deflinestyle[ \t]*)(\\(.*)$"}, rep187, segs + 320, lines + 133, 3, 4, 60},
+    {"setlinestyle", 12, 12, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setlinestyle[ \t]*)(\\(.*)$"}, rep188, segs + 323, lines + 137, 3, 1, 79},
+    {"getwritemask", 12, 12, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getwritemask[ \t]*)(\\(.*)$"}, rep227, segs + 420, lines + 195, 1, 2, 107},
+    {"nurbssurface", 12, 12, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(nurbssurface[ \t]*)(\\(.*)$"}, rep258, segs + 521, lines + 221, 11, 2, 42},
+    {"RGBwritemask", 12, 12, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(RGBwritemask[ \t]*)(\\(.*)$"}, rep331, segs + 794, lines + 272, 4, 1, 26},
+    {"SMP_SMOOTHER", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SMP_SMOOTHER)([^a-zA-Z_0-9]+.*|)$"}, rep423, segs + 1034, lines + 327, 1, 0, 1},
+    {"SML_SMOOTHER", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SML_SMOOTHER)([^a-zA-Z_0-9]+.*|)$"}, rep426, segs + 1037, lines + 327, 1, 0, 1},
+    {"GD_AFUNCTION", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_AFUNCTION)([^a-zA-Z_0-9]+.*|)$"}, rep564, segs + 1175, lines + 409, 1, 2, 13},
+    {"GD_FOGVERTEX", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_FOGVERTEX)([^a-zA-Z_0-9]+.*|)$"}, rep570, segs + 1181, lines + 414, 1, 2, 6},
+    {"LMC_EMISSION", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_EMISSION)([^a-zA-Z_0-9]+.*|)$"}, rep590, segs + 1201, lines + 432, 1, 0, 11},
+    {"LMC_SPECULAR", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(LMC_SPECULAR)([^a-zA-Z_0-9]+.*|)$"}, rep593, segs + 1204, lines + 432, 1, 0, 11},
+    {"TX_MINFILTER", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MINFILTER)([^a-zA-Z_0-9]+.*|)$"}, rep596, segs + 1207, lines + 433, 1, 0, 21},
+    {"TX_MAGFILTER", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MAGFILTER)([^a-zA-Z_0-9]+.*|)$"}, rep597, segs + 1208, lines + 433, 1, 0, 21},
+    {"TG_SPHEREMAP", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TG_SPHEREMAP)([^a-zA-Z_0-9]+.*|)$"}, rep625, segs + 1236, lines + 445, 1, 0, 13},
+    {"TX_TEXTURE_0", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_TEXTURE_0)([^a-zA-Z_0-9]+.*|)$"}, rep627, segs + 1238, lines + 445, 1, 0, 13},
+    {"GC_BITS_BLUE", 12, 12, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_BLUE)([^a-zA-Z_0-9]+.*|)$"}, rep631, segs + 1242, lines + 445, 1, 0, 12},
+    {"prefposition", 12, 12, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(prefposition[ \t]*)(\\(.*)$"}, rep691, segs + 1302, lines + 489, 1, 1, 0},
+    {"mswapbuffers", 12, 12, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(mswapbuffers[ \t]*)(\\(.*)$"}, rep696, segs + 1307, lines + 494, 1, 1, 0},
+    {"singlebuffer", 12, 12, Rule::simple, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(singlebuffer[ \t]*)(\\(.*)$"}, rep733, segs + 1344, lines + 532, 1, 1, 42},
+    {"doublebuffer", 12, 12, Rule::simple, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(doublebuffer[ \t]*)(\\(.*)$"}, rep734, segs + 1345, lines + 533, 1, 1, 42},
+    {"attachcursor", 12, 12, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(attachcursor[ \t]*)(\\(.*)$"}, rep746, segs + 1357, lines + 545, 1, 1, 0},
+    {"BACKMATERIAL", 12, 12, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(BACKMATERIAL)([^a-zA-Z_0-9]+.*|)$"}, rep765, segs + 1376, lines + 565, 1, 1, 7},
+    {"ATTENUATION2", 12, 12, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(ATTENUATION2)([^a-zA-Z_0-9]+.*|)$"}, rep776, segs + 1387, lines + 567, 1, 0, 24},
+    {"COLORINDEXES", 12, 12, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(COLORINDEXES)([^a-zA-Z_0-9]+.*|)$"}, rep782, segs + 1393, lines + 574, 1, 0, 16},
+    {"bgnclosedline", 13, 13, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(bgnclosedline[ \t]*)(\\(.*)$"}, rep6, segs + 6, lines + 1, 1, 0, 21},
+    {"endclosedline", 13, 13, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(endclosedline[ \t]*)(\\(.*)$"}, rep7, segs + 7, lines + 1, 1, 0, 7},
+    {"popattributes", 13, 13, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(popattributes[ \t]*)(\\(.*)$"}, rep32, segs + 32, lines + 18, 1, 0, 13},
+    {"blendfunction", 13, 13, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(blendfunction[ \t]*)(\\(.*)$"}, rep148, segs + 181, lines + 107, 5, 0, 94},
+    {"defrasterfont", 13, 13, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(defrasterfont[ \t]*)(\\(.*)$"}, rep190, segs + 329, lines + 142, 1, 1, 42},
+    {"BF_MIN_SA_MDA", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(BF_MIN_SA_MDA)([^a-zA-Z_0-9]+.*|)$"}, rep404, segs + 1015, lines + 327, 1, 0, 21},
+    {"PYM_LINE_FAST", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(PYM_LINE_FAST)([^a-zA-Z_0-9]+.*|)$"}, rep469, segs + 1080, lines + 329, 1, 0, 7},
+    {"AC_ACCUMULATE", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_ACCUMULATE)([^a-zA-Z_0-9]+.*|)$"}, rep501, segs + 1112, lines + 358, 1, 0, 8},
+    {"GD_PATSIZE_64", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_PATSIZE_64)([^a-zA-Z_0-9]+.*|)$"}, rep544, segs + 1155, lines + 386, 1, 1, 14},
+    {"GD_READSOURCE", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_READSOURCE)([^a-zA-Z_0-9]+.*|)$"}, rep548, segs + 1159, lines + 392, 1, 2, 14},
+    {"GD_ZDRAW_GEOM", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_ZDRAW_GEOM)([^a-zA-Z_0-9]+.*|)$"}, rep556, segs + 1167, lines + 401, 1, 1, 14},
+    {"GD_BITS_ACBUF", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_ACBUF)([^a-zA-Z_0-9]+.*|)$"}, rep566, segs + 1177, lines + 412, 1, 1, 17},
+    {"GD_CLIPPLANES", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_CLIPPLANES)([^a-zA-Z_0-9]+.*|)$"}, rep569, segs + 1180, lines + 414, 1, 0, 18},
+    {"GD_POLYSMOOTH", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_POLYSMOOTH)([^a-zA-Z_0-9]+.*|)$"}, rep573, segs + 1184, lines + 420, 1, 2, 17},
+    {"GC_BITS_CMODE", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep628, segs + 1239, lines + 445, 1, 0, 13},
+    {"GC_BITS_GREEN", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_GREEN)([^a-zA-Z_0-9]+.*|)$"}, rep630, segs + 1241, lines + 445, 1, 0, 13},
+    {"GC_BITS_ALPHA", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_ALPHA)([^a-zA-Z_0-9]+.*|)$"}, rep632, segs + 1243, lines + 445, 1, 0, 13},
+    {"GC_BITS_ACBUF", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_ACBUF)([^a-zA-Z_0-9]+.*|)$"}, rep637, segs + 1248, lines + 447, 1, 1, 17},
+    {"GC_MS_SAMPLES", 13, 13, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_MS_SAMPLES)([^a-zA-Z_0-9]+.*|)$"}, rep638, segs + 1249, lines + 448, 1, 1, 14},
+    {"SPOTDIRECTION", 13, 13, Rule::define, Rule::lighting, -1, {"^(.*[^a-zA-Z_0-9]+|)(SPOTDIRECTION)([^a-zA-Z_0-9]+.*|)$"}, rep789, segs + 1400, lines + 581, 1, 0, 17},
+    {"pushattributes", 14, 14, Rule::simple, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(pushattributes[ \t]*)(\\(.*)$"}, rep35, segs + 35, lines + 19, 1, 0, 32},
+    {"patchprecision", 14, 14, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(patchprecision[ \t]*)(\\(.*)$"}, rep102, segs + 102, lines + 86, 1, 1, 0},
+    {"curveprecision", 14, 14, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(curveprecision[ \t]*)(\\(.*)$"}, rep185, segs + 313, lines + 131, 1, 1, 29},
+    {"getdisplaymode", 14, 14, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getdisplaymode[ \t]*)(\\(.*)$"}, rep214, segs + 396, lines + 164, 1, 4, 45},
+    {"GD_BITS_CURSOR", 14, 14, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_CURSOR)([^a-zA-Z_0-9]+.*|)$"}, rep531, segs + 1142, lines + 369, 1, 1, 15},
+    {"GD_NURBS_ORDER", 14, 14, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_NURBS_ORDER)([^a-zA-Z_0-9]+.*|)$"}, rep541, segs + 1152, lines + 384, 1, 0, 17},
+    {"winconstraints", 14, 14, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(winconstraints[ \t]*)(\\(.*)$"}, rep671, segs + 1282, lines + 469, 1, 1, 0},
+    {"getothermonitor", 15, 15, Rule::deleted, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getothermonitor[ \t]*)(\\(.*)$"}, rep42, segs + 42, lines + 25, 1, 1, 0},
+    {"SML_END_CORRECT", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SML_END_CORRECT)([^a-zA-Z_0-9]+.*|)$"}, rep427, segs + 1038, lines + 327, 1, 0, 1},
+    {"GD_NVERTEX_POLY", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_NVERTEX_POLY)([^a-zA-Z_0-9]+.*|)$"}, rep543, segs + 1154, lines + 385, 1, 1, 16},
+    {"GD_SUBPIXEL_PNT", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_SUBPIXEL_PNT)([^a-zA-Z_0-9]+.*|)$"}, rep552, segs + 1163, lines + 397, 1, 1, 15},
+    {"GD_ZDRAW_PIXELS", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_ZDRAW_PIXELS)([^a-zA-Z_0-9]+.*|)$"}, rep557, segs + 1168, lines + 402, 1, 1, 16},
+    {"GD_FRAMEGRABBER", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_FRAMEGRABBER)([^a-zA-Z_0-9]+.*|)$"}, rep561, segs + 1172, lines + 406, 1, 1, 16},
+    {"GD_BITS_STENCIL", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_STENCIL)([^a-zA-Z_0-9]+.*|)$"}, rep568, segs + 1179, lines + 414, 1, 0, 15},
+    {"TX_MIPMAP_POINT", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MIPMAP_POINT)([^a-zA-Z_0-9]+.*|)$"}, rep608, segs + 1219, lines + 436, 1, 0, 25},
+    {"GC_BITS_ZBUFFER", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_ZBUFFER)([^a-zA-Z_0-9]+.*|)$"}, rep633, segs + 1244, lines + 445, 1, 0, 13},
+    {"GC_BITS_STENCIL", 15, 15, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_STENCIL)([^a-zA-Z_0-9]+.*|)$"}, rep636, segs + 1247, lines + 447, 1, 0, 15},
+    {"reshapeviewport", 15, 15, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(reshapeviewport[ \t]*)(\\(.*)$"}, rep690, segs + 1301, lines + 488, 1, 1, 0},
+    {"imakebackground", 15, 15, Rule::deleted, Rule::window, -1, {"^(.*[^a-zA-Z_0-9]+|)(imakebackground[ \t]*)(\\(.*)$"}, rep698, segs + 1309, lines + 496, 1, 1, 0},
+    {"getnurbsproperty", 16, 16, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(getnurbsproperty[ \t]*)(\\(.*)$"}, rep220, segs + 405, lines + 180, 1, 2, 41},
+    {"setnurbsproperty", 16, 16, Rule::args, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(setnurbsproperty[ \t]*)(\\(.*)$"}, rep355, segs + 888, lines + 293, 3, 1, 27},
+    {"SRC_FRAMEGRABBER", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(SRC_FRAMEGRABBER)([^a-zA-Z_0-9]+.*|)$"}, rep393, segs + 1004, lines + 326, 1, 1, 3},
+    {"GD_PNTSMOOTH_RGB", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_PNTSMOOTH_RGB)([^a-zA-Z_0-9]+.*|)$"}, rep546, segs + 1157, lines + 389, 1, 2, 15},
+    {"GD_SUBPIXEL_LINE", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_SUBPIXEL_LINE)([^a-zA-Z_0-9]+.*|)$"}, rep551, segs + 1162, lines + 396, 1, 1, 17},
+    {"GD_SUBPIXEL_POLY", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_SUBPIXEL_POLY)([^a-zA-Z_0-9]+.*|)$"}, rep553, segs + 1164, lines + 398, 1, 1, 16},
+    {"GD_BITS_ACBUF_HW", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_ACBUF_HW)([^a-zA-Z_0-9]+.*|)$"}, rep567, segs + 1178, lines + 413, 1, 1, 17},
+    {"GD_TEXTURE_PERSP", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_TEXTURE_PERSP)([^a-zA-Z_0-9]+.*|)$"}, rep577, segs + 1188, lines + 427, 1, 2, 13},
+    {"TX_MIPMAP_LINEAR", 16, 16, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MIPMAP_LINEAR)([^a-zA-Z_0-9]+.*|)$"}, rep609, segs + 1220, lines + 436, 1, 0, 24},
+    {"GD_LINESMOOTH_RGB", 17, 17, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_LINESMOOTH_RGB)([^a-zA-Z_0-9]+.*|)$"}, rep538, segs + 1149, lines + 379, 1, 2, 14},
+    {"GD_PNTSMOOTH_CMODE", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_PNTSMOOTH_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep545, segs + 1156, lines + 387, 1, 2, 15},
+    {"GD_TRIMCURVE_ORDER", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_TRIMCURVE_ORDER)([^a-zA-Z_0-9]+.*|)$"}, rep554, segs + 1165, lines + 399, 1, 1, 17},
+    {"GD_ALPHA_OVERUNDER", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_ALPHA_OVERUNDER)([^a-zA-Z_0-9]+.*|)$"}, rep565, segs + 1176, lines + 411, 1, 1, 19},
+    {"TX_MIPMAP_BILINEAR", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MIPMAP_BILINEAR)([^a-zA-Z_0-9]+.*|)$"}, rep610, segs + 1221, lines + 436, 1, 0, 24},
+    {"GC_BITS_MS_ZBUFFER", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_MS_ZBUFFER)([^a-zA-Z_0-9]+.*|)$"}, rep639, segs + 1250, lines + 449, 1, 1, 14},
+    {"GC_BITS_MS_STENCIL", 18, 18, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GC_BITS_MS_STENCIL)([^a-zA-Z_0-9]+.*|)$"}, rep642, segs + 1253, lines + 454, 1, 1, 15},
+    {"AC_CLEAR_ACCUMULATE", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(AC_CLEAR_ACCUMULATE)([^a-zA-Z_0-9]+.*|)$"}, rep502, segs + 1113, lines + 358, 1, 0, 7},
+    {"GD_OVERUNDER_SHARED", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_OVERUNDER_SHARED)([^a-zA-Z_0-9]+.*|)$"}, rep532, segs + 1143, lines + 370, 1, 1, 20},
+    {"GD_CROSSHAIR_CINDEX", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_CROSSHAIR_CINDEX)([^a-zA-Z_0-9]+.*|)$"}, rep535, segs + 1146, lines + 374, 1, 1, 20},
+    {"GD_LINESMOOTH_CMODE", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_LINESMOOTH_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep537, segs + 1148, lines + 377, 1, 2, 14},
+    {"GD_PUP_TO_OVERUNDER", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_PUP_TO_OVERUNDER)([^a-zA-Z_0-9]+.*|)$"}, rep547, segs + 1158, lines + 391, 1, 1, 20},
+    {"GD_LIGHTING_TWOSIDE", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_LIGHTING_TWOSIDE)([^a-zA-Z_0-9]+.*|)$"}, rep571, segs + 1182, lines + 416, 1, 2, 20},
+    {"TX_MIPMAP_TRILINEAR", 19, 19, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(TX_MIPMAP_TRILINEAR)([^a-zA-Z_0-9]+.*|)$"}, rep611, segs + 1222, lines + 436, 1, 0, 23},
+    {"GD_BITS_NORM_SNG_RED", 20, 20, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_RED)([^a-zA-Z_0-9]+.*|)$"}, rep515, segs + 1126, lines + 364, 1, 0, 11},
+    {"GD_BITS_NORM_DBL_RED", 20, 20, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_RED)([^a-zA-Z_0-9]+.*|)$"}, rep518, segs + 1129, lines + 364, 1, 0, 11},
+    {"GD_BITS_NORM_ZBUFFER", 20, 20, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_ZBUFFER)([^a-zA-Z_0-9]+.*|)$"}, rep525, segs + 1136, lines + 366, 1, 0, 13},
+    {"GD_BITS_NORM_SNG_BLUE", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_BLUE)([^a-zA-Z_0-9]+.*|)$"}, rep517, segs + 1128, lines + 364, 1, 0, 12},
+    {"GD_BITS_NORM_DBL_BLUE", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_BLUE)([^a-zA-Z_0-9]+.*|)$"}, rep520, segs + 1131, lines + 364, 1, 0, 12},
+    {"GD_BITS_NORM_SNG_MMAP", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_MMAP)([^a-zA-Z_0-9]+.*|)$"}, rep523, segs + 1134, lines + 364, 1, 1, 13},
+    {"GD_BITS_NORM_DBL_MMAP", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_MMAP)([^a-zA-Z_0-9]+.*|)$"}, rep524, segs + 1135, lines + 365, 1, 1, 13},
+    {"GD_BITS_PUP_SNG_CMODE", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_PUP_SNG_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep528, segs + 1139, lines + 368, 1, 1, 22},
+    {"GD_READSOURCE_ZBUFFER", 21, 21, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_READSOURCE_ZBUFFER)([^a-zA-Z_0-9]+.*|)$"}, rep549, segs + 1160, lines + 394, 1, 2, 14},
+    {"GD_BITS_NORM_SNG_GREEN", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_GREEN)([^a-zA-Z_0-9]+.*|)$"}, rep516, segs + 1127, lines + 364, 1, 0, 13},
+    {"GD_BITS_NORM_DBL_GREEN", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_GREEN)([^a-zA-Z_0-9]+.*|)$"}, rep519, segs + 1130, lines + 364, 1, 0, 13},
+    {"GD_BITS_NORM_SNG_CMODE", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep521, segs + 1132, lines + 364, 1, 0, 13},
+    {"GD_BITS_NORM_DBL_CMODE", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep522, segs + 1133, lines + 364, 1, 0, 13},
+    {"GD_BITS_OVER_SNG_CMODE", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_OVER_SNG_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep526, segs + 1137, lines + 366, 1, 1, 23},
+    {"GD_BITS_UNDR_SNG_CMODE", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_UNDR_SNG_CMODE)([^a-zA-Z_0-9]+.*|)$"}, rep527, segs + 1138, lines + 367, 1, 1, 23},
+    {"GD_BITS_NORM_SNG_ALPHA", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_SNG_ALPHA)([^a-zA-Z_0-9]+.*|)$"}, rep529, segs + 1140, lines + 369, 1, 0, 13},
+    {"GD_BITS_NORM_DBL_ALPHA", 22, 22, Rule::define, Rule::always, -1, {"^(.*[^a-zA-Z_0-9]+|)(GD_BITS_NORM_DBL_ALPHA)([^a-zA-Z_0-9]+.*|)$"}, rep530, segs + 1141, lines + 369, 1, 0, 13},
+};
+
+const int nrules = 794;
+const unsigned long long rules_version = 0xce6230cfab5dc16dull;
+
+static const int bucket_d[512] = {
+    1, 1, 1, 1, 1, 1, 0, 2, 1, 0, 1, 1, 0, 1, 1, 1,
+    2, 1, 0, 0, 1, 1, 1, 1, 0, 2, 2, 1, 1, 1, 2, 0,
+    0, 1, 1, 1, 2, 1, 0, 2, 1, 1, 2, 1, 0, 1, 2, 0,
+    1, 1, 1, 1, 1, 0, 1, 2, 1, 0, 0, 1, 1, 0, 1, 0,
+    1, 4, 1, 0, 2, 1, 0, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+    2, 1, 0, 1, 3, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 0,
+    3, 1, 2, 1, 1, 2, 2, 1, 0, 2, 0, 1, 2, 1, 1, 1,
+    1, 1, 1, 1, 5, 1, 2, 0, 0, 1, 1, 1, 0, 1, 1, 1,
+    0, 1, 2, 1, 0, 0, 1, 0, 1, 1, 1, 1, 2, 2, 1, 1,
+    3, 1, 0, 1, 2, 1, 1, 1, 1, 0, 0, 2, 1, 0, 0, 1,
+    0, 1, 0, 1, 1, 4, 1, 0, 1, 1, 3, 0, 1, 1, 1, 0,
+    1, 1, 1, 0, 3, 0, 1, 1, 1, 3, 2, 0, 2, 1, 1, 0,
+    1, 0, 1, 0, 1, 1, 1, 2, 4, 2, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 2, 2, 0, 1, 2, 0, 1, 1, 1, 1, 2, 2, 3,
+    0, 1, 1, 0, 1, 1, 1, 2, 2, 0, 0, 1, 2, 5, 4, 1,
+    1, 4, 1, 2, 3, 1, 1, 1, 5, 2, 1, 2, 3, 1, 1, 1,
+    4, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3, 1, 0, 1, 1, 3,
+    1, 1, 2, 1, 1, 0, 1, 1, 1, 1, 3, 1, 1, 1, 0, 1,
+    1, 1, 2, 2, 4, 0, 0, 0, 1, 0, 1, 2, 3, 2, 1, 3,
+    0, 4, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2, 0, 0, 6,
+    0, 2, 1, 1, 0, 2, 0, 3, 0, 8, 0, 0, 2, 0, 0, 1,
+    1, 1, 1, 0, 1, 2, 6, 2, 1, 1, 1, 2, 2, 1, 2, 0,
+    0, 1, 1, 1, 4, 2, 0, 0, 3, 1, 1, 2, 3, 0, 1, 1,
+    1, 1, 1, 0, 0, 1, 2, 1, 1, 2, 2, 1, 1, 0, 5, 0,
+    3, 1, 0, 7, 3, 1, 2, 0, 2, 0, 1, 1, 1, 1, 1, 1,
+    1, 4, 1, 1, 2, 2, 1, 1, 1, 4, 1, 1, 3, 4, 0, 3,
+    1, 3, 0, 2, 0, 1, 3, 1, 1, 2, 0, 0, 1, 0, 2, 1,
+    1, 0, 0, 0, 1, 0, 1, 1, 5, 1, 1, 2, 1, 1, 1, 2,
+    2, 1, 0, 0, 1, 1, 1, 1, 0, 1, 2, 2, 1, 1, 1, 4,
+    5, 1, 0, 1, 1, 0, 1, 3, 1, 1, 0, 1, 1, 1, 2, 1,
+    1, 2, 1, 1, 0, 0, 1, 1, 0, 2, 1, 2, 2, 4, 1, 5,
+    0, 2, 1, 1, 1, 3, 0, 0, 1, 3, 2, 2, 2, 2, 1, 6
+};
+
+static const short slot_rule[2048] = {
+    -1, -1, 34, -1, -1, -1, 464, 770, -1, -1, 680, 634, -1, -1, 690, -1,
+    -1, -1, -1, 102, -1, 367, -1, -1, -1, -1, 240, 533, 277, 513, -1, 385,
+    -1, -1, 729, -1, 83, 543, -1, -1, 468, -1, -1, 444, -1, -1, 522, -1,
+    503, 410, -1, -1, 376, 661, -1, -1, -1, 100, 761, 703, -1, 565, 442, -1,
+    -1, 471, -1, 567, 452, -1, -1, 550, -1, 310, -1, -1, 683, 742, 308, -1,
+    210, -1, 298, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, 486, 655,
+    -1, 775, -1, -1, 230, -1, 366, -1, -1, 712, -1, -1, 527, 140, 596, -1,
+    -1, 788, 344, 93, 224, 192, -1, 629, -1, 603, -1, -1, 484, -1, -1, -1,
+    759, 414, -1, -1, -1, 266, 200, -1, 121, -1, -1, -1, 440, -1, 115, -1,
+    -1, -1, -1, -1, -1, -1, -1, 327, -1, 319, -1, -1, 311, -1, 777, -1,
+    579, -1, 737, -1, 666, -1, -1, -1, -1, -1, -1, -1, 461, -1, -1, -1,
+    -1, -1, -1, 56, 593, -1, 554, 336, 384, -1, 172, 728, 359, 362, 68, 663,
+    -1, -1, -1, -1, -1, -1, -1, 202, -1, 246, -1, -1, -1, -1, -1, -1,
+    187, -1, 395, -1, 18, -1, 757, 21, -1, -1, -1, -1, 612, -1, 514, -1,
+    235, 546, -1, -1, 306, 551, -1, 791, -1, 422, 149, 454, 564, -1, -1, 243,
+    -1, 126, -1, -1, -1, -1, -1, -1, 753, -1, -1, -1, -1, -1, 3, -1,
+    223, -1, -1, -1, 592, -1, -1, 474, -1, -1, 74, 258, -1, 281, 616, -1,
+    105, -1, 127, -1, -1, 668, -1, -1, 396, -1, -1, 643, -1, 91, -1, -1,
+    -1, -1, 698, 676, 292, -1, -1, -1, 741, 705, -1, -1, -1, -1, -1, 25,
+    -1, 372, -1, -1, 457, -1, 370, -1, -1, 106, -1, 217, -1, -1, -1, -1,
+    -1, -1, -1, 482, 162, 108, 427, -1, -1, -1, -1, 390, -1, 62, -1, -1,
+    275, -1, 179, -1, -1, -1, 635, -1, -1, -1, 265, 76, -1, -1, 90, 377,
+    487, 332, 453, -1, 42, -1, -1, 111, -1, -1, 363, 441, 169, -1, 84, -1,
+    -1, -1, -1, 637, -1, -1, 98, -1, -1, 97, 232, 348, -1, -1, -1, -1,
+    -1, -1, 709, -1, -1, -1, 208, -1, 590, -1, 284, -1, 431, -1, -1, 326,
+    -1, 575, -1, -1, -1, -1, 722, -1, -1, -1, 67, -1, -1, -1, 458, 167,
+    -1, -1, 645, 255, -1, -1, 577, 309, -1, 163, -1, -1, -1, -1, 304, -1,
+    630, 771, -1, 483, 273, -1, -1, -1, -1, -1, -1, 153, -1, -1, -1, 766,
+    -1, -1, 171, 504, -1, 233, 689, 615, -1, -1, 727, 459, -1, 392, -1, -1,
+    -1, -1, -1, 424, 120, -1, 773, -1, -1, -1, 338, -1, 393, -1, 28, -1,
+    -1, -1, 214, -1, 282, -1, -1, -1, -1, 321, -1, -1, -1, -1, -1, 491,
+    -1, -1, -1, -1, -1, 5, 164, -1, -1, -1, 213, -1, 335, -1, -1, -1,
+    314, 760, -1, 129, 606, 478, -1, -1, 597, -1, -1, 196, -1, -1, 738, 498,
+    -1, 168, -1, -1, -1, -1, -1, -1, -1, 747, -1, 751, -1, 512, -1, -1,
+    -1, -1, -1, 209, -1, 244, -1, 29, -1, -1, -1, -1, -1, -1, 1, 679,
+    -1, -1, 472, 493, -1, 636, 161, -1, -1, -1, -1, -1, 573, -1, 89, -1,
+    750, 477, -1, -1, 350, -1, -1, -1, -1, -1, 253, -1, 154, -1, 540, 463,
+    -1, -1, -1, 599, -1, -1, 175, -1, 660, -1, -1, -1, 156, 740, -1, 31,
+    -1, -1, 11, -1, 723, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    733, -1, -1, -1, -1, -1, 261, -1, -1, -1, 147, -1, -1, 260, 43, 87,
+    -1, 402, -1, -1, -1, -1, -1, 619, -1, 148, -1, -1, 51, 710, 143, -1,
+    26, -1, -1, 524, 673, 475, -1, -1, -1, -1, -1, 768, 398, -1, 624, -1,
+    -1, -1, -1, 136, -1, 323, 792, 307, -1, -1, -1, -1, -1, 288, -1, 248,
+    225, -1, 448, -1, -1, 82, -1, -1, -1, -1, -1, 109, 604, -1, -1, 10,
+    618, 96, 692, 651, 511, -1, -1, -1, -1, 222, -1, -1, -1, -1, 75, -1,
+    -1, -1, -1, -1, 561, -1, 203, 305, 85, 700, -1, -1, 782, -1, -1, -1,
+    -1, 117, 671, -1, 434, -1, -1, -1, -1, 601, -1, -1, 767, -1, 783, -1,
+    -1, -1, 349, 719, 646, 732, -1, 639, -1, -1, -1, -1, 159, -1, -1, 207,
+    -1, 276, 328, -1, 746, -1, -1, -1, 119, 563, 772, 763, -1, -1, -1, 178,
+    -1, -1, -1, -1, 570, -1, 669, -1, 57, 762, -1, 449, -1, -1, -1, -1,
+    -1, 48, -1, -1, -1, 681, -1, -1, 27, -1, -1, -1, 462, 177, -1, -1,
+    451, 2, -1, 711, -1, -1, -1, -1, 656, -1, 558, -1, 331, 399, -1, -1,
+    95, 545, -1, 55, 236, -1, -1, 78, -1, -1, 687, 623, -1, -1, -1, -1,
+    151, 274, -1, -1, -1, -1, 30, -1, -1, 736, -1, 340, -1, -1, 716, 562,
+    -1, -1, -1, -1, 320, -1, 388, 333, -1, -1, -1, -1, -1, -1, 790, -1,
+    19, -1, -1, -1, -1, -1, 613, -1, -1, -1, 642, -1, -1, -1, -1, 66,
+    268, -1, -1, -1, 528, 744, -1, -1, 183, -1, -1, -1, 789, 343, -1, -1,
+    -1, -1, -1, -1, -1, 425, 110, -1, 226, -1, -1, 536, -1, 490, -1, -1,
+    216, -1, 239, 523, 176, 674, -1, -1, 418, -1, -1, -1, 662, -1, -1, -1,
+    598, -1, -1, 699, -1, -1, -1, 516, 460, -1, 625, 589, -1, 365, 228, -1,
+    -1, -1, 252, -1, -1, 447, -1, 547, -1, -1, -1, -1, -1, -1, 691, 739,
+    -1, 364, 548, -1, -1, -1, -1, 197, 160, 52, -1, 754, -1, -1, -1, -1,
+    -1, 157, -1, -1, 526, 86, 774, 501, 426, -1, -1, -1, 717, -1, -1, 137,
+    465, 198, 714, 49, -1, -1, -1, 264, -1, 337, 302, -1, -1, -1, -1, -1,
+    497, -1, -1, -1, -1, 455, 104, -1, 602, -1, -1, 155, 787, 430, 437, -1,
+    508, -1, -1, -1, -1, -1, 648, -1, -1, -1, 237, 519, -1, 580, -1, 706,
+    -1, 81, -1, -1, 537, -1, 35, 507, 324, -1, -1, -1, -1, -1, 628, -1,
+    -1, -1, -1, -1, 99, -1, -1, -1, -1, 748, -1, -1, -1, 583, 499, 70,
+    -1, 480, -1, -1, -1, -1, -1, -1, -1, 560, -1, -1, -1, 17, 329, -1,
+    53, 107, -1, -1, 58, -1, -1, 786, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 611, -1, 481, -1, -1, 587, -1, -1, -1, -1, 677, -1, -1, -1,
+    259, -1, 778, 769, -1, -1, 231, -1, 731, 195, -1, -1, -1, -1, -1, -1,
+    123, -1, 793, -1, -1, 467, -1, -1, -1, -1, -1, -1, -1, -1, 419, -1,
+    -1, 510, -1, -1, -1, -1, 734, -1, -1, 4, -1, -1, -1, -1, 780, -1,
+    -1, -1, -1, 150, -1, -1, -1, -1, 77, 9, -1, 15, 617, 291, -1, -1,
+    254, -1, -1, 36, 664, -1, -1, 568, -1, -1, 608, 401, 271, -1, 411, -1,
+    6, -1, -1, 318, 330, -1, 373, 204, 193, -1, -1, -1, -1, -1, -1, 571,
+    -1, 379, -1, 250, 433, 544, 572, -1, -1, -1, 621, 40, 502, -1, -1, 174,
+    518, 416, 553, 358, -1, -1, -1, -1, 72, -1, 532, 534, -1, -1, -1, -1,
+    684, -1, -1, -1, -1, 267, -1, 704, 278, 300, -1, -1, -1, -1, -1, -1,
+    184, -1, 652, -1, -1, -1, 92, 165, -1, -1, 290, -1, 60, 7, -1, -1,
+    -1, -1, -1, -1, 647, -1, -1, 181, 470, -1, -1, 182, -1, 301, -1, 44,
+    145, 694, 303, -1, -1, -1, -1, -1, 191, -1, -1, -1, -1, -1, 345, 368,
+    403, 397, -1, 697, -1, -1, -1, -1, -1, -1, -1, -1, -1, 65, -1, -1,
+    -1, -1, 607, -1, -1, 134, -1, -1, -1, -1, 693, 752, -1, 342, -1, -1,
+    112, -1, 627, 443, 355, -1, -1, 334, -1, 247, -1, -1, -1, -1, -1, 131,
+    -1, -1, 743, -1, -1, 649, 0, -1, -1, -1, -1, 517, -1, -1, 476, -1,
+    640, 784, -1, -1, -1, -1, 269, -1, 417, -1, 16, 47, -1, -1, 708, 659,
+    -1, -1, 670, -1, 257, 381, -1, -1, -1, -1, -1, 133, -1, -1, -1, 103,
+    488, -1, -1, 489, -1, 594, -1, -1, -1, 650, 144, -1, -1, -1, -1, 142,
+    234, -1, -1, 347, -1, -1, -1, -1, 317, -1, 211, -1, -1, -1, 13, 64,
+    -1, 653, 438, -1, 285, -1, -1, -1, -1, 538, -1, -1, -1, 360, 114, 173,
+    101, -1, -1, 124, 14, 322, -1, -1, -1, 289, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 574, 701, -1, -1, -1, -1, -1, 272, 672, -1, 221, 79,
+    -1, 283, -1, -1, -1, 492, 685, -1, 189, 387, -1, -1, -1, -1, -1, 726,
+    404, -1, 495, -1, 505, -1, -1, 466, 539, -1, -1, -1, -1, -1, -1, -1,
+    781, 61, -1, 585, -1, -1, -1, -1, 678, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 549, -1, -1, 713, 408, 428, 500, 582, 357, 386, -1, -1, 552, -1,
+    -1, -1, 429, 725, 715, -1, -1, 353, -1, -1, -1, 542, 371, 405, -1, 352,
+    588, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 294, -1, 279, -1, -1,
+    287, -1, 251, -1, 280, -1, -1, 557, -1, -1, -1, -1, -1, 756, -1, -1,
+    132, -1, -1, -1, -1, -1, -1, -1, 566, -1, -1, 586, -1, 776, 496, 626,
+    696, -1, 515, 688, -1, -1, 765, -1, 718, -1, 33, -1, 54, -1, -1, -1,
+    530, -1, -1, -1, 421, -1, -1, -1, -1, -1, -1, -1, -1, 212, 146, -1,
+    -1, 707, -1, -1, 262, 435, 263, 665, 71, -1, -1, 400, 46, 316, -1, 50,
+    -1, -1, -1, 614, -1, 23, -1, -1, -1, -1, 378, -1, -1, 758, 73, 238,
+    609, -1, -1, 576, -1, 215, -1, 351, -1, -1, -1, 633, 152, 341, 199, 531,
+    631, 584, 188, -1, -1, 128, 270, 439, 779, -1, 641, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 406, 735, -1, -1, 675, 749, 432, 339, -1, -1, -1, 520,
+    229, -1, -1, -1, -1, -1, 180, -1, 695, 391, 622, 206, -1, 185, 479, -1,
+    -1, -1, -1, 296, -1, 24, -1, 245, -1, -1, -1, -1, -1, -1, -1, 45,
+    122, -1, -1, -1, 346, -1, -1, 638, -1, -1, 242, 620, -1, 423, -1, 220,
+    141, -1, 369, -1, -1, -1, -1, -1, 682, -1, 569, -1, -1, -1, -1, -1,
+    644, -1, -1, -1, 657, -1, -1, -1, -1, 227, -1, -1, -1, -1, -1, -1,
+    -1, 186, 559, -1, 555, 632, -1, -1, -1, -1, -1, 201, -1, -1, -1, 667,
+    -1, -1, 509, -1, -1, -1, -1, -1, 8, 394, -1, -1, -1, -1, 94, 529,
+    473, -1, -1, -1, 286, -1, -1, -1, 299, -1, 654, 745, 383, 658, -1, -1,
+    686, 361, -1, -1, 295, 764, -1, -1, -1, -1, -1, 605, -1, 535, -1, -1,
+    -1, 241, -1, -1, 37, 785, 541, -1, -1, 450, 730, -1, 194, -1, 315, -1,
+    -1, -1, 485, -1, -1, 374, -1, -1, 139, 721, 720, -1, -1, -1, 38, -1,
+    39, -1, -1, -1, -1, -1, 41, -1, -1, -1, 325, -1, 456, -1, -1, 12,
+    -1, -1, 130, 407, -1, 249, -1, 412, 125, -1, -1, 135, -1, -1, -1, -1,
+    59, 525, 755, -1, 138, -1, 413, -1, 297, 313, -1, 521, -1, 190, -1, 702,
+    -1, 166, -1, -1, 420, -1, 375, 591, 380, 556, -1, 63, -1, 389, 415, -1,
+    356, 382, -1, 158, 88, -1, -1, -1, 118, -1, -1, 205, 354, -1, 436, 600,
+    -1, -1, 218, 469, 446, -1, -1, 494, -1, 595, 219, 445, 32, -1, -1, -1,
+    506, -1, -1, 409, 581, -1, 20, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 69, 256, 116, -1, -1, -1, 80, -1, -1, -1, -1, 113, -1, -1, 724
+};
+
+int
+rule_lookup(const char *name, int len)
+{
+    int d = bucket_d[rule_hash(name, len, 0) % 512];
+    int r = slot_rule[rule_hash(name, len, d) % 2048];
+
+    if(r < 0 || rules[r].namelen != len || memcmp(rules[r].name, name, len) != 0)
+	return -1;
+    return r;
+}
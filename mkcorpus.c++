@@ -0,0 +1,307 @@
+/*
+ * Makes up IRIS GL C for toogl to be timed on, writing it on stdout.
+ *
+ *	mkcorpus [-l lines] [-d density] [-s seed] [igl.h]
+ *
+ * The calls are to the functions rules.def has rules for, with as many
+ * args as their replacements want, and the constants are the rules'
+ * own and those #defined in igl.h.  density is the percent of
+ * statements with IRIS GL in them, the rest being plain C.  Some lines
+ * are long, holding many statements or one call with many args, some
+ * args are calls themselves, and some are string literals with commas,
+ * parens and quotes in, the things split_args() has to get right.  The
+ * same seed makes the same C.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "search.h"
+#include "rules.h"
+
+struct def {
+    int kind;
+    const char *name, *rep;
+};
+
+static const def defs[] = {
+#define SIMPLE(g, n, r, c) {Rule::simple, n, r},
+#define DELETE(g, n, c) {Rule::deleted, n, ""},
+#define ARGS(g, n, r, c) {Rule::args, n, r},
+#define DEFINE(g, n, r, c) {Rule::define, n, r},
+#include "rules.def"
+};
+static const int ndefs = sizeof defs / sizeof defs[0];
+
+// the calls most IRIS GL programs are made of, tried more often
+static const char *common[] = {
+    "v2f", "v2i", "v3f", "v3i", "n3f", "c3f", "c3i", "color", "cpack", "RGBcolor",
+    "bgnpolygon", "endpolygon", "bgnline", "endline", "bgntmesh", "endtmesh",
+    "move2i", "draw2i", "rectfi", "recti", "cmov2i", "charstr", "clear", "zclear",
+    "pushmatrix", "popmatrix", "translate", "rotate", "scale", "swapbuffers",
+    "winset", "lmbind", "lmdef", "qread", "qdevice", "getgdesc", "ortho2",
+};
+
+// plain C around the calls, and names a lot like theirs
+static const char *vars[] = {
+    "i", "j", "n", "x", "y", "z", "width", "height", "angle", "mode", "win",
+    "clearcolor", "myclear", "scale_factor", "vert", "norm", "colors", "line",
+};
+static const char *funcs[] = {
+    "printf", "fprintf", "strlen", "sqrt", "sin", "cos", "mycolor", "draw_it",
+    "colorx", "update_scale", "get_vertex", "translate_point",
+};
+static const char *words[] = {
+    "the", "window", "(x, y)", "polygon", "\\\"quoted\\\"", "done", "a, b",
+    "f(", ")", "colour", "%d", "%s", "\\n", "draw", "matrix", "'c'",
+};
+
+static int *fcalls, nfcalls;	// defs of function rules
+static int *fcommon, nfcommon;	// those in common[]
+static const char **consts;	// define rules' names, then igl.h's
+static int nconsts;
+static int *nargs;		// [def] args its replacement wants
+
+static unsigned long long seed = 88172645463325252ull;
+
+// xorshift64*, so the same seed makes the same C everywhere
+static unsigned
+rnd(unsigned n)
+{
+    seed ^= seed >> 12;
+    seed ^= seed << 25;
+    seed ^= seed >> 27;
+    return (unsigned)((seed * 2685821657736338717ull) >> 32) % n;
+}
+
+#define PICK(a) (a[rnd(sizeof a / sizeof a[0])])
+
+// the most args a replacement's "$n"s want, as mkrules reads them
+static int
+max_arg(const char *rep)
+{
+    int n = 0, a;
+
+    for(; (rep = strchr(rep, '$')) != 0; rep += 2) {
+	if(rep[1] >= '1' && rep[1] <= '9')
+	    a = rep[1] - '0';
+	else if(rep[1] >= 'a' && rep[1] <= 'f')
+	    a = rep[1] - 'a' + 10;
+	else
+	    break;
+	if(a > n)
+	    n = a;
+    }
+    return n;
+}
+
+// add igl.h's #defined constants to consts
+static void
+read_constants(const char *file)
+{
+    char line[512], name[128];
+    FILE *f = fopen(file, "r");
+
+    if(!f) {
+	fprintf(stderr, "mkcorpus: can't read %s\n", file);
+	exit(1);
+    }
+    while(fgets(line, sizeof line, f)) {
+	if(sscanf(line, "#define %127[A-Za-z0-9_] %*s", name) == 1 && name[0] != '_') {
+	    consts = (const char **)realloc(consts, (nconsts + 1) * sizeof consts[0]);
+	    consts[nconsts++] = strdup(name);
+	}
+    }
+    fclose(f);
+}
+
+static void expr(int depth);
+
+// a call to an IRIS GL function with the args it wants
+static void
+gl_call(int depth)
+{
+    int d = nfcommon && rnd(4) ? fcommon[rnd(nfcommon)] : fcalls[rnd(nfcalls)];
+    int i, n = defs[d].kind == Rule::args ? nargs[d] : rnd(3);
+
+    printf("%s%s(", defs[d].name, rnd(10) ? "" : " ");
+    for(i = 0; i < n; i++) {
+	if(i)
+	    printf(", ");
+	expr(depth + 1);
+    }
+    printf(")");
+}
+
+// a string literal, sometimes with the characters split_args() watches for
+static void
+quoted()
+{
+    int i, n = 1 + rnd(6);
+
+    printf("\"");
+    for(i = 0; i < n; i++)
+	printf("%s%s", i ? " " : "", PICK(words));
+    printf("\"");
+}
+
+// an arg: a number, variable or constant, or at depth, some arithmetic,
+// a string or a call, IRIS GL or not
+static void
+expr(int depth)
+{
+    switch(rnd(depth > 3 ? 3 : 9)) {
+    case 0:
+	printf("%d", (int)rnd(1024));
+	break;
+    case 1:
+	printf("%s", PICK(vars));
+	break;
+    case 2:
+	printf("%s", consts[rnd(nconsts)]);
+	break;
+    case 3:
+	printf("%d.%df", (int)rnd(10), (int)rnd(100));
+	break;
+    case 4:
+	printf("%s[%s]", PICK(vars), PICK(vars));
+	break;
+    case 5:
+	expr(depth + 1);
+	printf(" %s ", rnd(2) ? "+" : "*");
+	expr(depth + 1);
+	break;
+    case 6:
+	quoted();
+	break;
+    case 7:
+	gl_call(depth);
+	break;
+    case 8:
+	printf("%s(", PICK(funcs));
+	expr(depth + 1);
+	printf(")");
+	break;
+    }
+}
+
+// one statement, IRIS GL density percent of the time, with no newline
+static void
+statement(int density)
+{
+    if((int)rnd(100) < density) {
+	switch(rnd(8)) {
+	case 0:
+	    printf("%s = %s;", PICK(vars), consts[rnd(nconsts)]);
+	    break;
+	case 1:
+	    printf("if (%s == %s) ", PICK(vars), consts[rnd(nconsts)]);
+	    gl_call(0);
+	    printf(";");
+	    break;
+	default:
+	    gl_call(0);
+	    printf(";");
+	    break;
+	}
+    } else {
+	switch(rnd(6)) {
+	case 0:
+	    printf("%s = ", PICK(vars));
+	    expr(2);
+	    printf(";");
+	    break;
+	case 1:
+	    printf("printf(");
+	    quoted();
+	    printf(", %s);", PICK(vars));
+	    break;
+	case 2:
+	    printf("%s++;", PICK(vars));
+	    break;
+	case 3:
+	    printf("/* %s %s %s */", PICK(words), PICK(words), PICK(words));
+	    break;
+	default:
+	    printf("%s(%s, %s);", PICK(funcs), PICK(vars), PICK(vars));
+	    break;
+	}
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    int i, j, c, lines = 20000, density = 30, out = 0, nfunc = 0;
+
+    while((c = getopt(argc, argv, "l:d:s:")) != -1) {
+	switch(c) {
+	case 'l':
+	    lines = atoi(optarg);
+	    break;
+	case 'd':
+	    density = atoi(optarg);
+	    break;
+	case 's':
+	    seed = strtoull(optarg, 0, 0) | 1;
+	    break;
+	default:
+	    fprintf(stderr, "Usage: mkcorpus [-l lines] [-d density] [-s seed] [igl.h]\n");
+	    exit(1);
+	}
+    }
+
+    fcalls = new int[ndefs];
+    fcommon = new int[ndefs];
+    nargs = new int[ndefs];
+    for(i = 0; i < ndefs; i++) {
+	nargs[i] = max_arg(defs[i].rep);
+	if(defs[i].kind == Rule::define) {
+	    consts = (const char **)realloc(consts, (nconsts + 1) * sizeof consts[0]);
+	    consts[nconsts++] = defs[i].name;
+	    continue;
+	}
+	fcalls[nfcalls++] = i;
+	for(j = 0; j < (int)(sizeof common / sizeof common[0]); j++) {
+	    if(strcmp(common[j], defs[i].name) == 0)
+		fcommon[nfcommon++] = i;
+	}
+    }
+    read_constants(optind < argc ? argv[optind] : "igl.h");
+
+    printf("/* made by mkcorpus -l %d -d %d */\n", lines, density);
+    printf("#include <stdio.h>\n#include <math.h>\n#include <gl/gl.h>\n#include <gl/device.h>\n\n");
+    printf("static int i, j, n, mode, win, line, width, height;\n");
+    printf("static float x, y, z, angle, scale_factor, vert[3], norm[3], colors[256];\n\n");
+    out = 7;
+    while(out < lines) {
+	int n = 5 + rnd(40);
+
+	printf("void\nscene%d(int depth)\n{\n", nfunc++);
+	out += 3;
+	for(i = 0; i < n && out < lines; i++, out++) {
+	    printf("    ");
+	    if(rnd(20) == 0) {		// a long line
+		int m = 4 + rnd(12);
+		for(j = 0; j < m; j++) {
+		    if(j)
+			printf(" ");
+		    statement(density);
+		}
+	    } else if(rnd(10) == 0) {	// a block
+		printf("for (i = 0; i < %s; i++) {\n", PICK(vars));
+		printf("\t");
+		statement(density);
+		printf("\n    }");
+		out += 2;
+	    } else
+		statement(density);
+	    printf("\n");
+	}
+	printf("}\n\n");
+	out += 2;
+    }
+    return 0;
+}
@@ -0,0 +1,279 @@
+/*
+ * Makes the constant rule tables rules.h describes from rules.def,
+ * writing them as C++ on stdout.  Run when toogl is built.
+ *
+ * Each rule gets its name and length, the bucket process_line() tries
+ * it in, its kind and option group, its regexp, its replacement split at
+ * the "$n"s, its comment split into lines and the next rule with the
+ * same name.  rules[] is sorted into the order process_line() tries
+ * the rules in.  rule_lookup() finds the first rule with a name in one
+ * probe of a perfect hash made here.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "perlclass.h"
+#include "search.h"
+#include "rules.h"
+
+struct def {
+    int kind, group;
+    const char *name, *rep, *comments;
+};
+
+static const def defs[] = {
+#define SIMPLE(g, n, r, c) {Rule::simple, Rule::g, n, r, c},
+#define DELETE(g, n, c) {Rule::deleted, Rule::g, n, "", c},
+#define ARGS(g, n, r, c) {Rule::args, Rule::g, n, r, c},
+#define DEFINE(g, n, r, c) {Rule::define, Rule::g, n, r, c},
+#include "rules.def"
+};
+static const int ndefs = sizeof defs / sizeof defs[0];
+
+static const char *kinds[] = {"simple", "deleted", "args", "define"};
+static const char *groups[] = {"always", "window", "queue", "lighting", "emulation"};
+
+static unsigned long long version = 14695981039346656037ull;
+
+// add the n bytes at p to version, a 64 bit FNV-1a hash
+static void
+hash_in(const char *p, size_t n)
+{
+    while(n-- > 0)
+	version = (version ^ (unsigned char)*p++) * 1099511628211ull;
+}
+
+// s as a C string literal
+static PerlString
+literal(const char *s)
+{
+    PerlString l("\"");
+    char oct[8];
+
+    for(; *s; s++) {
+	if(*s == '"' || *s == '\\') {
+	    l += '\\';
+	    l += *s;
+	} else if(*s == '\t')
+	    l += "\\t";
+	else if(*s == '\n')
+	    l += "\\n";
+	else if((unsigned char)*s < ' ' || (unsigned char)*s >= 0177) {
+	    snprintf(oct, sizeof oct, "\\%03o", (unsigned char)*s);
+	    l += oct;
+	} else
+	    l += *s;
+    }
+    l += "\"";
+    return l;
+}
+
+/*
+ * Which arg the character after a '$' stands for, 1 based: $1 - $9, then
+ * $a - $f or $A - $F for 10 - 15.  0 if it isn't one of those.
+ */
+static int
+arg_number(int c)
+{
+    if(c >= '1' && c <= '9')
+	return c - '1' + 1;
+    else if(c >= 'a' && c <= 'f')
+	return c - 'a' + 10;
+    else if(c >= 'A' && c <= 'F')
+	return c - 'A' + 10;
+    return 0;
+}
+
+/*
+ * The perfect hash.  Names are put in NBUCKET buckets by rule_hash(name,
+ * 0); then, biggest buckets first, each bucket is given the first d for
+ * which rule_hash(name, d) takes all its names to slots, out of NSLOT,
+ * not yet taken.
+ */
+enum {NSLOT = 2048, NBUCKET = 512};
+
+static int slot_rule[NSLOT];	// first rule with the name in the slot, -1 if none
+static int bucket_d[NBUCKET];
+
+static void
+make_hash(const int *heads, int nheads)
+{
+    static int nin[NBUCKET], order[NBUCKET];
+    int i, j, k, b, d;
+
+    for(i = 0; i < NSLOT; i++)
+	slot_rule[i] = -1;
+    for(i = 0; i < nheads; i++)
+	nin[rule_hash(defs[heads[i]].name, strlen(defs[heads[i]].name), 0) % NBUCKET]++;
+    for(b = 0; b < NBUCKET; b++)
+	order[b] = b;
+    for(i = 1; i < NBUCKET; i++) {	// biggest first
+	for(j = i; j > 0 && nin[order[j]] > nin[order[j-1]]; j--) {
+	    k = order[j];
+	    order[j] = order[j-1];
+	    order[j-1] = k;
+	}
+    }
+
+    for(k = 0; k < NBUCKET && nin[order[k]]; k++) {
+	b = order[k];
+	for(d = 1; ; d++) {
+	    int ok = 1;
+	    if(d > 1000000) {
+		fprintf(stderr, "mkrules: can't make a perfect hash of the names\n");
+		exit(1);
+	    }
+	    for(i = 0; i < nheads && ok; i++) {
+		const char *name = defs[heads[i]].name;
+		int len = strlen(name);
+		if(rule_hash(name, len, 0) % NBUCKET != (unsigned)b)
+		    continue;
+		int s = rule_hash(name, len, d) % NSLOT;
+		if(slot_rule[s] != -1) {	// taken before, or by this bucket
+		    ok = 0;
+		    break;
+		}
+		slot_rule[s] = -2 - heads[i];	// taken, for now
+	    }
+	    for(i = 0; i < NSLOT; i++) {
+		if(slot_rule[i] <= -2)
+		    slot_rule[i] = ok ? -2 - slot_rule[i] : -1;
+	    }
+	    if(ok) {
+		bucket_d[b] = d;
+		break;
+	    }
+	}
+    }
+}
+
+int
+main()
+{
+    int i, j, k, b, nsegs = 0, nlines = 0, bad = 0;
+    int *same = new int[ndefs], *heads = new int[ndefs], nheads = 0;
+    int *seg_at = new int[ndefs], *nseg = new int[ndefs];
+    int *line_at = new int[ndefs], *nline = new int[ndefs], *replen = new int[ndefs];
+    int *order = new int[ndefs], *pos = new int[ndefs];
+
+    printf("// Made by mkrules from rules.def.  Don't edit.\n\n");
+    printf("#include <string.h>\n#include \"rules.h\"\n\n");
+
+    // rules[] holds the rules in the order process_line() tries them, by
+    // bucket and then as in rules.def; order[] is that order, pos[] the inverse
+    for(b = k = 0; b < MAXPATTERN; b++) {
+	for(i = 0; i < ndefs; i++) {
+	    int len = strlen(defs[i].name);
+	    if((len < MAXPATTERN - 1 ? len : MAXPATTERN - 1) == b) {
+		pos[i] = k;
+		order[k++] = i;
+	    }
+	}
+    }
+
+    // the same-name chains, which all keep to one bucket
+    for(i = 0; i < ndefs; i++) {
+	same[i] = -1;
+	for(j = 0; j < i && strcmp(defs[j].name, defs[i].name); j++)
+	    ;
+	if(j == i) {
+	    heads[nheads++] = i;
+	} else {
+	    while(same[j] >= 0)
+		j = same[j];
+	    same[j] = i;
+	}
+    }
+
+    // the replacements, to be pointed into by the segments
+    for(i = 0; i < ndefs; i++)
+	printf("static const char rep%d[] = %s;\n", i, (const char *)literal(defs[i].rep));
+
+    printf("\nstatic const RuleSegment segs[] = {\n");
+    for(i = 0; i < ndefs; i++) {
+	const char *rep = defs[i].rep, *p = rep, *dollar = 0;
+	seg_at[i] = nsegs;
+	nseg[i] = 0;
+	replen[i] = 0;
+	if(defs[i].kind == Rule::args) {
+	    while((dollar = strchr(p, '$')) != 0) {
+		int arg = arg_number((unsigned char)dollar[1]);
+		if(!arg) {
+		    fprintf(stderr, "mkrules: %s: \"$%.1s\" in \"%s\" isn't $1 - $9 or $a - $f\n",
+			defs[i].name, dollar + 1, rep);
+		    bad = 1;
+		    break;
+		}
+		printf("    {rep%d + %d, %d, %d},\n", i, (int)(p - rep), (int)(dollar - p), arg);
+		nseg[i]++;
+		replen[i] += dollar - p;
+		p = dollar + 2;
+	    }
+	}
+	printf("    {rep%d + %d, %d, 0},\n", i, (int)(p - rep), (int)strlen(p));
+	nseg[i]++;
+	replen[i] += strlen(p);
+	nsegs += nseg[i];
+    }
+    printf("};\n");
+    if(bad)
+	exit(1);
+
+    // comments split just as toogl always has
+    printf("\nstatic const char *const lines[] = {\n");
+    for(i = 0; i < ndefs; i++) {
+	PerlStringList l;
+	l = PerlString(defs[i].comments).split("#");
+	line_at[i] = nlines;
+	nline[i] = l.scalar();
+	for(j = 0; j < l.scalar(); j++)
+	    printf("    %s,\n", (const char *)literal(l[j]));
+	nlines += nline[i];
+    }
+    printf("    0\n};\n");
+
+    printf("\nRule rules[] = {\n");
+    for(k = 0; k < ndefs; k++) {
+	const def &d = defs[i = order[k]];
+	int len = strlen(d.name);
+	PerlString re(d.kind == Rule::define ? DEFINE_PRE : FUNC_PRE);
+
+	re += d.name;
+	re += d.kind == Rule::define ? DEFINE_POST : FUNC_POST;
+	printf("    {%s, %d, %d, Rule::%s, Rule::%s, %d, {%s}, rep%d, segs + %d, lines + %d, %d, %d, %d},\n",
+	    (const char *)literal(d.name), len, len < MAXPATTERN - 1 ? len : MAXPATTERN - 1,
+	    kinds[d.kind], groups[d.group], same[i] < 0 ? -1 : pos[same[i]],
+	    (const char *)literal(re), i, seg_at[i], line_at[i], nseg[i], nline[i], replen[i]);
+    }
+    printf("};\n\nconst int nrules = %d;\n", ndefs);
+
+    for(i = 0; i < ndefs; i++) {	// in rules.def order, as it's always been
+	const def &d = defs[i];
+	hash_in(kinds[d.kind], strlen(kinds[d.kind]) + 1);
+	hash_in(groups[d.group], strlen(groups[d.group]) + 1);
+	hash_in(d.name, strlen(d.name) + 1);
+	hash_in(d.rep, strlen(d.rep) + 1);
+	hash_in(d.comments, strlen(d.comments) + 1);
+    }
+    printf("const unsigned long long rules_version = 0x%016llxull;\n", version);
+
+    make_hash(heads, nheads);
+    printf("\nstatic const int bucket_d[%d] = {", NBUCKET);
+    for(i = 0; i < NBUCKET; i++)
+	printf("%s%d", i == 0 ? "\n    " : i % 16 ? ", " : ",\n    ", bucket_d[i]);
+    printf("\n};\n\nstatic const short slot_rule[%d] = {", NSLOT);
+    for(i = 0; i < NSLOT; i++)
+	printf("%s%d", i == 0 ? "\n    " : i % 16 ? ", " : ",\n    ",
+	    slot_rule[i] < 0 ? -1 : pos[slot_rule[i]]);
+    printf("\n};\n\n");
+    printf("int\nrule_lookup(const char *name, int len)\n{\n"
+	"    int d = bucket_d[rule_hash(name, len, 0) %% %d];\n"
+	"    int r = slot_rule[rule_hash(name, len, d) %% %d];\n\n"
+	"    if(r < 0 || rules[r].namelen != len || memcmp(rules[r].name, name, len) != 0)\n"
+	"\treturn -1;\n"
+	"    return r;\n}\n", NBUCKET, NSLOT);
+
+    return 0;
+}
@@ -37,6 +37,7 @@
 #include <malloc.h>
 #include <stdio.h>
 #include <cassert>
+#include <mutex>
 
 #ifdef __TURBOC__
 #pragma hdrstop
@@ -44,6 +45,62 @@
 
 #include "perlclass.h"
 
+// Arena Implementation
+thread_local Arena* Arena::active;
+thread_local Arena::counts Arena::mine;
+static Arena::counts retired;
+static std::mutex retired_lock; // for retired and the RegexpCache ones
+
+Arena::counts Arena::totals(void) {
+    std::lock_guard<std::mutex> g(retired_lock);
+    counts c = retired;
+    c.nallocs += mine.nallocs;
+    c.nbytes += mine.nbytes;
+    c.nblocks += mine.nblocks;
+    c.heap_allocs += mine.heap_allocs;
+    c.heap_bytes += mine.heap_bytes;
+    return c;
+}
+
+void Arena::retire(void) {
+    std::lock_guard<std::mutex> g(retired_lock);
+    retired.nallocs += mine.nallocs;
+    retired.nbytes += mine.nbytes;
+    retired.nblocks += mine.nblocks;
+    retired.heap_allocs += mine.heap_allocs;
+    retired.heap_bytes += mine.heap_bytes;
+    memset(&mine, 0, sizeof mine);
+}
+
+Arena::~Arena() {
+    block* b;
+    while ((b = first) != 0) {
+        first = b->next;
+        free(b);
+    }
+}
+
+// the current block is full, move on to the next one that has room
+void* Arena::more(size_t n) {
+    block* b = cur ? cur->next : first;
+    if (!b || b->size < n) { // splice in a new one
+        size_t sz = n > BLOCKSZ ? n : BLOCKSZ;
+        block* nb = (block*)malloc(((sizeof(block) + ALIGN - 1) & ~(ALIGN - 1)) + sz);
+        nb->size = sz;
+        nb->next = b;
+        if (cur)
+            cur->next = nb;
+        else
+            first = nb;
+        b = nb;
+        mine.nblocks++;
+    }
+    cur = b;
+    p = b->mem() + n;
+    end = b->mem() + b->size;
+    return b->mem();
+}
+
 // VarString Implementation
 VarString& VarString::operator=(const char* s) {
     int nl = strlen(s);
@@ -61,10 +118,9 @@ VarString& VarString::operator=(const VarString& n) {
 #ifdef DEBUG
             fprintf(stderr, "~operator=(VarString&) a= %p\n", a);
 #endif
-            delete[] a; // get rid of old one
-            allocated = n.allocated;
+            release(); // get rid of old one
+            init(n.allocated);
             allocinc = n.allocinc;
-            a = new char[allocated];
 #ifdef DEBUG
             fprintf(stderr, "operator=(VarString&) a= %p, source= %p\n", a, n.a);
 #endif
@@ -75,17 +131,36 @@ VarString& VarString::operator=(const VarString& n) {
     return *this;
 }
 
+VarString& VarString::operator=(VarString&& n) {
+    if (this != &n) {
+        if (n.a == n.buf || n.arena != arena) { // nothing to steal, or not ours to take
+            *this = (const VarString&)n;
+        } else {
+            release();
+            a = n.a;
+            allocated = n.allocated;
+            allocinc = n.allocinc;
+            len = n.len;
+            n.a = n.buf;
+            n.allocated = INLINESZ;
+        }
+        n.len = 0;
+        *n.a = '\0';
+    }
+    return *this;
+}
+
 void VarString::grow(int n) {
     if (n == 0)
         n = allocinc;
     allocated += n;
-    char* tmp = new char[allocated];
+    char* tmp = Arena::get(arena, allocated);
     strcpy(tmp, a);
 #ifdef DEBUG
     fprintf(stderr, "VarString::grow() a= %p, old= %p, allocinc= %d\n", tmp, a, allocinc);
     fprintf(stderr, "~VarString::grow() a= %p\n", a);
 #endif
-    delete[] a;
+    release();
     a = tmp;
 }
 
@@ -106,6 +181,15 @@ void VarString::add(const char* s) {
     len += nl;
 }
 
+void VarString::append(const char* s, int nl) {
+    if (len + nl >= allocated)
+        grow(((len + nl) - allocated) + allocinc);
+    assert(allocated > len + nl);
+    memcpy(&a[len], s, nl);
+    len += nl;
+    a[len] = '\0';
+}
+
 void VarString::add(int ip, const char* s) {
     int nl = strlen(s);
     if (len + nl >= allocated)
@@ -119,11 +203,112 @@ void VarString::add(int ip, const char* s) {
 
 void VarString::remove(int ip, int n) {
     assert(ip + n <= len);
-    memmove(&a[ip], &a[ip + n], len - ip); // shuffle down
+    memmove(&a[ip], &a[ip + n], (len - (ip + n)) + 1); // shuffle down
     len -= n;
     assert(a[len] == '\0');
 }
 
+//
+// RegexpCache stuff
+//
+
+RegexpCache::RegexpCache() {
+    int i;
+    for (i = 0; i < NSLOT; i++) {
+        slots[i].pat = 0;
+        slots[i].used = 0;
+        slots[i].re = 0;
+        slots[i].chain = 0;
+    }
+    for (i = 0; i < NHASH; i++)
+        table[i] = 0;
+    clock = 0;
+    nhits = nmisses = 0;
+}
+
+long RegexpCache::retired_hits, RegexpCache::retired_misses;
+
+RegexpCache::~RegexpCache() {
+    {
+        std::lock_guard<std::mutex> g(retired_lock);
+        retired_hits += nhits;
+        retired_misses += nmisses;
+    }
+    for (int i = 0; i < NSLOT; i++) {
+        delete slots[i].re;
+        delete[] slots[i].pat;
+    }
+}
+
+unsigned RegexpCache::hashof(const char* pat, int flags) {
+    unsigned h = flags;
+    while (*pat)
+        h = h * 31 + (unsigned char)*pat++;
+    return h;
+}
+
+void RegexpCache::unlink(slot* s) {
+    slot** pp;
+    for (pp = &table[s->hash % NHASH]; *pp != s; pp = &(*pp)->chain)
+        ;
+    *pp = s->chain;
+    delete s->re;
+    delete[] s->pat;
+    s->re = 0;
+    s->pat = 0;
+    s->used = 0;
+}
+
+const Regexp& RegexpCache::get(const char* pat, int flags) {
+    unsigned h = hashof(pat, flags);
+    slot* s;
+
+    for (s = table[h % NHASH]; s; s = s->chain) {
+        if (s->hash == h && s->flags == flags && strcmp(s->pat, pat) == 0) {
+            nhits++;
+            s->used = ++clock;
+            return *s->re;
+        }
+    }
+
+    // not there, take a free slot or the least recently used one
+    nmisses++;
+    slot* victim = &slots[0];
+    for (int i = 0; i < NSLOT && victim->used; i++) {
+        if (slots[i].used < victim->used)
+            victim = &slots[i];
+    }
+    if (victim->used)
+        unlink(victim);
+
+    victim->pat = new char[strlen(pat) + 1];
+    strcpy(victim->pat, pat);
+    victim->flags = flags;
+    victim->hash = h;
+    victim->used = ++clock;
+    victim->re = new Regexp(pat, flags);
+    victim->chain = table[h % NHASH];
+    table[h % NHASH] = victim;
+    return *victim->re;
+}
+
+RegexpCache& RegexpCache::global(void) {
+    static thread_local RegexpCache cache;
+    return cache;
+}
+
+long RegexpCache::all_hits(void) {
+    long n = global().hits();
+    std::lock_guard<std::mutex> g(retired_lock);
+    return n + retired_hits;
+}
+
+long RegexpCache::all_misses(void) {
+    long n = global().misses();
+    std::lock_guard<std::mutex> g(retired_lock);
+    return n + retired_misses;
+}
+
 //
 // PerlString stuff
 //
@@ -179,16 +364,16 @@ char PerlString::chop(void) {
     return tmp;
 }
 
-int PerlString::index(const PerlString& s, int offset) {
+int PerlString::index(const PerlString& s, int offset) const {
     for (int i = offset; i < length(); i++) {
-        if (strncmp(&pstr[i], s, s.length()) == 0)
+        if (strncmp((const char*)pstr + i, s, s.length()) == 0)
             return i;
     }
 
     return -1;
 }
 
-int PerlString::rindex(const PerlString& s, int offset) {
+int PerlString::rindex(const PerlString& s, int offset) const {
     if (offset == -1)
         offset = length() - s.length();
     else
@@ -197,7 +382,7 @@ int PerlString::rindex(const PerlString& s, int offset) {
         offset = length() - s.length();
 
     for (int i = offset; i >= 0; i--) {
-        if (strncmp(&pstr[i], s, s.length()) == 0)
+        if (strncmp((const char*)pstr + i, s, s.length()) == 0)
             return i;
     }
     return -1;
@@ -234,26 +419,26 @@ int PerlString::m(Regexp& r) {
 
 int PerlString::m(const char* pat, const char* opts) {
     int iflg = strchr(opts, 'i') != NULL;
-    Regexp r(pat, iflg ? Regexp::nocase : 0);
-    return m(r);
+    RegexpMatch rm;
+    return RegexpCache::global().get(pat, iflg ? Regexp::nocase : 0).match(*this, rm);
 }
 
-int PerlString::m(Regexp& r, PerlStringList& psl) {
-    if (!r.match(*this))
+int PerlString::m(const Regexp& r, PerlStringList& psl) {
+    RegexpMatch rm;
+    if (!r.match(*this, rm))
         return 0;
     psl.reset(); // clear it first
     Range rng;
-    for (int i = 0; i < r.groups(); i++) {
-        rng = r.getgroup(i);
+    for (int i = 0; i < rm.groups(); i++) {
+        rng = rm.getgroup(i);
         psl.push(substr(rng.start(), rng.length()));
     }
-    return r.groups();
+    return rm.groups();
 }
 
 int PerlString::m(const char* pat, PerlStringList& psl, const char* opts) {
     int iflg = strchr(opts, 'i') != NULL;
-    Regexp r(pat, iflg ? Regexp::nocase : 0);
-    return m(r, psl);
+    return m(RegexpCache::global().get(pat, iflg ? Regexp::nocase : 0), psl);
 }
 
 //
@@ -345,13 +530,14 @@ int PerlString::s(const char* exp, const char* repl, const char* opts) {
     int gflg = strchr(opts, 'g') != NULL;
     int iflg = strchr(opts, 'i') != NULL;
     int cnt = 0;
-    Regexp re(exp, iflg ? Regexp::nocase : 0);
+    const Regexp& re = RegexpCache::global().get(exp, iflg ? Regexp::nocase : 0);
+    RegexpMatch rm;
     Range rg;
 
-    if (re.match(*this)) {
+    if (re.match(*this, rm)) {
         // OK I know, this is a horrible hack, but it seems to work
         if (gflg) { // recursively call s() until applied to whole string
-            rg = re.getgroup(0);
+            rg = rm.getgroup(0);
             if (rg.end() + 1 < length()) {
                 PerlString st(substr(rg.end() + 1));
                 //		cout << "Substring: " << st << endl;
@@ -362,7 +548,7 @@ int PerlString::s(const char* exp, const char* repl, const char* opts) {
         }
 
         if (!strchr(repl, '$')) { // straight, simple substitution
-            rg = re.getgroup(0);
+            rg = rm.getgroup(0);
             substr(rg.start(), rg.length()) = repl;
             cnt++;
         } else { // need to do subexpression substitution
@@ -384,11 +570,11 @@ int PerlString::s(const char* exp, const char* repl, const char* opts) {
                         c = *src++;
                     dst += c;
                 } else {
-                    rg = re.getgroup(no);
+                    rg = rm.getgroup(no);
                     dst += substr(rg.start(), rg.length());
                 }
             }
-            rg = re.getgroup(0);
+            rg = rm.getgroup(0);
             substr(rg.start(), rg.length()) = dst;
             cnt++;
         }
@@ -410,7 +596,6 @@ PerlStringList PerlString::split(const char* pat, int limit) {
 //
 
 int PerlStringList::split(const char* str, const char* pat, int limit) {
-    Regexp re(pat);
     Range rng;
     PerlString s(str);
     int cnt = 1;
@@ -424,7 +609,8 @@ int PerlStringList::split(const char* str, const char* pat, int limit) {
     }
 
     if (strcmp(pat, "' '") == 0) { // special awk case
-        char *p, *ws = " \t\n";
+        char *p;
+        const char *ws = " \t\n";
         TempString t(str); // can't hack users data
         p = strtok(t, ws);
         while (p) {
@@ -434,11 +620,13 @@ int PerlStringList::split(const char* str, const char* pat, int limit) {
         return count();
     }
 
-    while (re.match(s) && (limit < 0 || cnt < limit)) { // find separator
-        rng = re.getgroup(0);                           // full matched string (entire separator)
+    const Regexp& re = RegexpCache::global().get(pat);
+    RegexpMatch rm;
+    while (re.match(s, rm) && (limit < 0 || cnt < limit)) { // find separator
+        rng = rm.getgroup(0);                               // full matched string (entire separator)
         push(s.substr(0, rng.start()));
-        for (int i = 1; i < re.groups(); i++) {
-            push(s.substr(re.getgroup(i))); // add subexpression matches
+        for (int i = 1; i < rm.groups(); i++) {
+            push(s.substr(rm.getgroup(i))); // add subexpression matches
         }
 
         s = s.substr(rng.end() + 1);
@@ -488,24 +676,26 @@ PerlStringList& PerlStringList::operator=(const PerlList<PerlString>& n) {
 
 int PerlStringList::m(const char* rege, const char* targ, const char* opts) {
     int iflg = strchr(opts, 'i') != NULL;
-    Regexp r(rege, iflg ? Regexp::nocase : 0);
-    if (!r.match(targ))
+    const Regexp& r = RegexpCache::global().get(rege, iflg ? Regexp::nocase : 0);
+    RegexpMatch rm;
+    if (!r.match(targ, rm))
         return 0;
     Range rng;
-    for (int i = 0; i < r.groups(); i++) {
-        rng = r.getgroup(i);
+    for (int i = 0; i < rm.groups(); i++) {
+        rng = rm.getgroup(i);
         push(PerlString(targ).substr(rng.start(), rng.length()));
     }
-    return r.groups();
+    return rm.groups();
 }
 
 PerlStringList PerlStringList::grep(const char* rege, const char* opts) {
     PerlStringList rt;
     int iflg = strchr(opts, 'i') != NULL;
 
-    Regexp rexp(rege, iflg ? Regexp::nocase : 0); // compile once
+    const Regexp& rexp = RegexpCache::global().get(rege, iflg ? Regexp::nocase : 0);
+    RegexpMatch rm;
     for (int i = 0; i < count(); i++) {
-        if (rexp.match((*this)[i])) {
+        if (rexp.match((*this)[i], rm)) {
             rt.push((*this)[i]);
         }
     }
@@ -523,6 +713,13 @@ char buf[40];
 
     s = ""; // empty string
     ifs.get(buf, sizeof buf);
+    if (ifs.fail() && !ifs.eof()) { // get() fails on an empty line, which is still a line
+        ifs.clear();
+        if (ifs.get() == '\n')
+            return ifs;
+        ifs.setstate(std::ios::failbit);
+        return ifs;
+    }
     // This is tricky because a line teminated by end of file that is not terminated
     // with a '\n' first is considered an OK line, but ifs.good() will fail.
     // This will correctly return the last line if it is terminated by eof with the
@@ -37,6 +37,10 @@
 #define _PERL_H
 
 #include <string.h>
+#include <iostream>
+#include <stddef.h>
+#include <new>
+#include <utility>
 #include "regexp.h"
 
 #if DEBUG
@@ -45,6 +49,86 @@
 
 #define INLINE inline
 
+//
+// A bump allocator for short lived strings and lists.  While an Arena
+// is in use() the VarStrings, PerlLists and TempStrings constructed
+// take their memory from it, and never give it back, until reset()
+// frees the lot at once.  What each one was constructed with is what
+// it keeps allocating from, so objects made outside the arena stay on
+// the heap however they are used inside it.  Each thread has its own
+// arena in use, and its own counts.
+//
+class Arena {
+  private:
+    enum { BLOCKSZ = 16384, ALIGN = 16 };
+    struct block {
+        block* next;
+        size_t size;
+        char* mem() {
+            return (char*)this + ((sizeof(block) + ALIGN - 1) & ~(ALIGN - 1));
+        }
+    };
+    block* first;
+    block* cur;
+    char* p;
+    char* end;
+    static thread_local Arena* active;
+
+    void* more(size_t n);
+
+  public:
+    struct counts {
+        long nallocs, nbytes, nblocks; // taken from arenas
+        long heap_allocs, heap_bytes;  // the same objects went to the heap for
+    };
+    static thread_local counts mine;
+    static counts totals(void); // this thread's and those of the ones retired
+    static void retire(void);   // a thread is finishing, keep its counts
+
+    Arena() : first(0), cur(0), p(0), end(0) {
+    }
+    ~Arena();
+
+    void* alloc(size_t n) {
+        n = (n + ALIGN - 1) & ~(size_t)(ALIGN - 1);
+        mine.nallocs++;
+        mine.nbytes += n;
+        if ((size_t)(end - p) < n)
+            return more(n);
+        void* r = p;
+        p += n;
+        return r;
+    }
+
+    void reset(void) {
+        cur = first;
+        p = first ? first->mem() : 0;
+        end = first ? first->mem() + first->size : 0;
+    }
+
+    static Arena* current(void) {
+        return active;
+    }
+    static Arena* use(Arena* a) { // returns the one that was in use
+        Arena* o = active;
+        active = a;
+        return o;
+    }
+
+    // character buffers from a, or the heap if a is 0
+    static char* get(Arena* a, int n) {
+        if (a)
+            return (char*)a->alloc(n);
+        mine.heap_allocs++;
+        mine.heap_bytes += n;
+        return new char[n];
+    }
+    static void put(Arena* a, char* s) {
+        if (!a)
+            delete[] s;
+    }
+};
+
 // This is the base class for PerlList, it handles the underlying
 // dynamic array mechanism
 
@@ -56,7 +140,10 @@ template <class T> class PerlListBase {
     int first;
     int allocated;
     int allocinc;
+    Arena* arena; // where a comes from, 0 for the heap
     void grow(int amnt = 0, int newcnt = -1);
+    T* newarray(int n);
+    void freearray(T* p, int n);
 
   protected:
     void compact(const int i);
@@ -69,7 +156,8 @@ template <class T> class PerlListBase {
     PerlListBase(int n = ALLOCINC)
 #endif
     {
-        a = new T[n];
+        arena = Arena::current();
+        a = newarray(n);
         cnt = 0;
         first = n >> 1;
         allocated = n;
@@ -80,12 +168,14 @@ template <class T> class PerlListBase {
     }
 
     PerlListBase(const PerlListBase<T>& n);
+    PerlListBase(PerlListBase<T>&& n);
     PerlListBase<T>& operator=(const PerlListBase<T>& n);
+    PerlListBase<T>& operator=(PerlListBase<T>&& n);
     virtual ~PerlListBase() {
 #ifdef DEBUG
         fprintf(stderr, "~PerlListBase() a= %p, allocinc= %d\n", a, allocinc);
 #endif
-        delete[] a;
+        freearray(a, allocated);
     }
 
     INLINE T& operator[](const int i);
@@ -96,6 +186,7 @@ template <class T> class PerlListBase {
     }
 
     void add(const T& n);
+    void add(T&& n);
     void add(const int i, const T& n);
     void erase(void) {
         cnt = 0;
@@ -122,7 +213,7 @@ template <class T> class PerlList : private PerlListBase<T> {
 
     // add perl-like synonym
     void reset(void) {
-        erase();
+        this->erase();
     }
     int scalar(void) const {
         return count();
@@ -139,25 +230,28 @@ template <class T> class PerlList : private PerlListBase<T> {
         T tmp;
         int n = count() - 1;
         if (n >= 0) {
-            tmp = (*this)[n];
-            compact(n);
+            tmp = std::move((*this)[n]);
+            this->compact(n);
         }
         return tmp;
     }
 
     void push(const T& a) {
-        add(a);
+        this->add(a);
+    }
+    void push(T&& a) {
+        this->add(std::move(a));
     }
     void push(const PerlList<T>& l);
 
     T shift(void) {
-        T tmp = (*this)[0];
-        compact(0);
+        T tmp = std::move((*this)[0]);
+        this->compact(0);
         return tmp;
     }
 
     int unshift(const T& a) {
-        add(0, a);
+        this->add(0, a);
         return count();
     }
 
@@ -175,22 +269,25 @@ template <class T> class PerlList : private PerlListBase<T> {
 class TempString {
   private:
     char* str;
+    Arena* arena;
 
   public:
     TempString(const char* s) {
-        str = new char[strlen(s) + 1];
+        arena = Arena::current();
+        str = Arena::get(arena, strlen(s) + 1);
         strcpy(str, s);
     }
 
     TempString(const char* s, int len) {
-        str = new char[len + 1];
+        arena = Arena::current();
+        str = Arena::get(arena, len + 1);
         if (len)
             strncpy(str, s, len);
         str[len] = '\0';
     }
 
     ~TempString() {
-        delete[] str;
+        Arena::put(arena, str);
     }
 
     operator char*() const {
@@ -200,16 +297,25 @@ class TempString {
 
 /*
  * This class takes care of the mechanism behind variable length strings
+ * Strings shorter than INLINESZ live in buf, and only go to the heap
+ * once they outgrow it.
  */
 
 class VarString {
   private:
-    enum { ALLOCINC = 32 };
-    char* a;
+    enum { ALLOCINC = 32, INLINESZ = 20 };
+    char* a; // buf, arena or heap
     int len;
     int allocated;
     int allocinc;
-    INLINE void grow(int n = 0);
+    Arena* arena; // where a comes from when it isn't buf, 0 for the heap
+    char buf[INLINESZ];
+    void grow(int n = 0);
+    INLINE void init(int n);
+    void release(void) {
+        if (a != buf)
+            Arena::put(arena, a);
+    }
 
   public:
 #ifdef USLCOMPILER
@@ -220,6 +326,7 @@ class VarString {
 #endif
 
     INLINE VarString(const VarString& n);
+    INLINE VarString(VarString&& n);
     INLINE VarString(const char*);
     INLINE VarString(const char* s, int n);
     INLINE VarString(char);
@@ -228,10 +335,11 @@ class VarString {
 #ifdef DEBUG
         fprintf(stderr, "~VarString() a= %p, allocinc= %d\n", a, allocinc);
 #endif
-        delete[] a;
+        release();
     }
 
     VarString& operator=(const VarString& n);
+    VarString& operator=(VarString&& n);
     VarString& operator=(const char*);
 
     INLINE const char operator[](const int i) const;
@@ -248,13 +356,63 @@ class VarString {
     void add(char);
     void add(const char*);
     void add(int, const char*);
+    void append(const char*, int);
     void remove(int, int = 1);
+    void reserve(int n) { // room for n chars without growing
+        if (n >= allocated)
+            grow(n + 1 - allocated);
+    }
 
     void erase(void) {
         len = 0;
     }
 };
 
+//
+// Keeps the compiled Regexps for the functions below that take the
+// pattern as a string, so calling them in a loop doesn't recompile
+// the same pattern every time.  Keyed on pattern and Regexp flags,
+// holds at most NSLOT programs, the least recently used one is
+// thrown away to make room.
+//
+class RegexpCache {
+  private:
+    enum { NSLOT = 64, NHASH = 128 };
+    struct slot {
+        char* pat;
+        int flags;
+        unsigned hash;
+        unsigned long used; // clock at last lookup, 0 if free
+        Regexp* re;
+        slot* chain;
+    };
+    slot slots[NSLOT];
+    slot* table[NHASH];
+    unsigned long clock;
+    long nhits, nmisses;
+    static long retired_hits, retired_misses; // of caches gone with their threads
+
+    static unsigned hashof(const char* pat, int flags);
+    void unlink(slot* s);
+
+  public:
+    RegexpCache();
+    ~RegexpCache();
+
+    const Regexp& get(const char* pat, int flags = 0);
+
+    long hits(void) const {
+        return nhits;
+    }
+    long misses(void) const {
+        return nmisses;
+    }
+
+    static RegexpCache& global(void); // the one PerlString uses, one per thread
+    static long all_hits(void);
+    static long all_misses(void);
+};
+
 class PerlStringList;
 //
 // Implements the perl specific string functionality
@@ -270,6 +428,8 @@ class PerlString {
     }
     PerlString(const PerlString& n) : pstr(n.pstr) {
     }
+    PerlString(PerlString&& n) : pstr(std::move(n.pstr)) {
+    }
     PerlString(const char* s) : pstr(s) {
     }
     PerlString(const char c) : pstr(c) {
@@ -282,6 +442,10 @@ class PerlString {
         return *this;
     }
     PerlString& operator=(const PerlString& n);
+    PerlString& operator=(PerlString&& n) {
+        pstr = std::move(n.pstr);
+        return *this;
+    }
     PerlString& operator=(const substring& sb);
 
     operator const char*() const {
@@ -297,8 +461,8 @@ class PerlString {
 
     char chop(void);
 
-    int index(const PerlString& s, int offset = 0);
-    int rindex(const PerlString& s, int offset = -1);
+    int index(const PerlString& s, int offset = 0) const;
+    int rindex(const PerlString& s, int offset = -1) const;
     substring substr(int offset, int len = -1);
     substring substr(const Range& r) {
         return substr(r.start(), r.length());
@@ -307,7 +471,7 @@ class PerlString {
     int m(const char*, const char* opts = ""); // the regexp match m/.../ equiv
     int m(Regexp&);
     int m(const char*, PerlStringList&, const char* opts = "");
-    int m(Regexp&, PerlStringList&);
+    int m(const Regexp&, PerlStringList&); // reentrant, r can be shared
 
     int tr(const char*, const char*, const char* opts = "");
     int s(const char*, const char*, const char* opts = "");
@@ -349,6 +513,13 @@ class PerlString {
         pstr.add(c);
         return *this;
     }
+    PerlString& append(const char* s, int n) { // n chars of s, which needn't be terminated
+        pstr.append(s, n);
+        return *this;
+    }
+    void reserve(int n) {
+        pstr.reserve(n);
+    }
     friend substring;
 
   private:
@@ -406,8 +577,20 @@ class PerlStringList : public PerlList<PerlString> {
     }
     // copy lists, need to duplicate all internal strings
     PerlStringList(const PerlStringList& n);
+    PerlStringList(PerlStringList&& n) : PerlList<PerlString>(std::move(n)) {
+    }
+    // and ones about to go away can just be taken over
+    PerlStringList(PerlList<PerlString>&& n) : PerlList<PerlString>(std::move(n)) {
+    }
 
     PerlStringList& operator=(const PerlList<PerlString>& n);
+    PerlStringList& operator=(const PerlStringList& n) {
+        return operator=((const PerlList<PerlString>&)n);
+    }
+    PerlStringList& operator=(PerlList<PerlString>&& n) {
+        PerlList<PerlString>::operator=(std::move(n));
+        return *this;
+    }
 
     int split(const char* str, const char* pat = "[ \t\n]+", int limit = -1);
     PerlString join(const char* pat = " ");
@@ -477,12 +660,38 @@ template <class T> INLINE const T& PerlListBase<T>::operator[](const int i) cons
     return a[first + i];
 }
 
+// the elements are made in the list's arena, whatever is in use
+template <class T> T* PerlListBase<T>::newarray(int n) {
+    Arena* o = Arena::use(arena);
+    T* r;
+    if (arena) {
+        r = (T*)arena->alloc(n * sizeof(T));
+        for (int i = 0; i < n; i++)
+            new (&r[i]) T;
+    } else {
+        Arena::mine.heap_allocs++;
+        Arena::mine.heap_bytes += n * sizeof(T);
+        r = new T[n];
+    }
+    Arena::use(o);
+    return r;
+}
+
+template <class T> void PerlListBase<T>::freearray(T* p, int n) {
+    if (arena) {
+        for (int i = 0; i < n; i++)
+            p[i].~T();
+    } else
+        delete[] p;
+}
+
 template <class T> PerlListBase<T>::PerlListBase(const PerlListBase<T>& n) {
+    arena = Arena::current();
     allocated = n.allocated;
     allocinc = n.allocinc;
     cnt = n.cnt;
     first = n.first;
-    a = new T[allocated];
+    a = newarray(allocated);
     for (int i = 0; i < cnt; i++)
         a[first + i] = n.a[first + i];
 #ifdef DEBUG
@@ -490,6 +699,47 @@ template <class T> PerlListBase<T>::PerlListBase(const PerlListBase<T>& n) {
 #endif
 }
 
+// n is left empty, it gets a new array when something is added
+template <class T> PerlListBase<T>::PerlListBase(PerlListBase<T>&& n) {
+    arena = Arena::current();
+    allocated = n.allocated;
+    allocinc = n.allocinc;
+    cnt = n.cnt;
+    first = n.first;
+    if (n.arena != arena) { // can't take it, move the elements over
+        a = newarray(allocated);
+        for (int i = 0; i < cnt; i++)
+            a[first + i] = std::move(n.a[first + i]);
+        n.freearray(n.a, n.allocated);
+    } else
+        a = n.a;
+    n.a = 0;
+    n.allocated = n.cnt = n.first = 0;
+#ifdef DEBUG
+    fprintf(stderr, "PerlListBase(PerlListBase&&) a= %p\n", a);
+#endif
+}
+
+template <class T> PerlListBase<T>& PerlListBase<T>::operator=(PerlListBase<T>&& n) {
+    if (this == &n)
+        return *this;
+    freearray(a, allocated);
+    allocated = n.allocated;
+    allocinc = n.allocinc;
+    cnt = n.cnt;
+    first = n.first;
+    if (n.arena != arena) {
+        a = newarray(allocated);
+        for (int i = 0; i < cnt; i++)
+            a[first + i] = std::move(n.a[first + i]);
+        n.freearray(n.a, n.allocated);
+    } else
+        a = n.a;
+    n.a = 0;
+    n.allocated = n.cnt = n.first = 0;
+    return *this;
+}
+
 template <class T> PerlListBase<T>& PerlListBase<T>::operator=(const PerlListBase<T>& n) {
     //  cout << "PerlListBase<T>::operator=()" << endl;
     if (this == &n)
@@ -497,12 +747,12 @@ template <class T> PerlListBase<T>& PerlListBase<T>::operator=(const PerlListBas
 #ifdef DEBUG
     fprintf(stderr, "~operator=(PerlListBase&) a= %p\n", a);
 #endif
-    delete[] a; // get rid of old one
+    freearray(a, allocated); // get rid of old one
     allocated = n.allocated;
     allocinc = n.allocinc;
     cnt = n.cnt;
     first = n.first;
-    a = new T[allocated];
+    a = newarray(allocated);
     for (int i = 0; i < cnt; i++)
         a[first + i] = n.a[first + i];
 #ifdef DEBUG
@@ -516,16 +766,17 @@ template <class T> void PerlListBase<T>::grow(int amnt, int newcnt) {
         amnt = allocinc; // default value
     if (newcnt < 0)
         newcnt = cnt; // default
+    int oldallocated = allocated;
     allocated += amnt;
-    T* tmp = new T[allocated];
+    T* tmp = newarray(allocated);
     int newfirst = (allocated >> 1) - (newcnt >> 1);
     for (int i = 0; i < cnt; i++)
-        tmp[newfirst + i] = a[first + i];
+        tmp[newfirst + i] = std::move(a[first + i]);
 #ifdef DEBUG
     fprintf(stderr, "PerlListBase::grow() a= %p, old= %p, allocinc= %d\n", tmp, a, allocinc);
     fprintf(stderr, "~PerlListBase::grow() a= %p\n", a);
 #endif
-    delete[] a;
+    freearray(a, oldallocated);
     a = tmp;
     first = newfirst;
 }
@@ -537,6 +788,13 @@ template <class T> void PerlListBase<T>::add(const T& n) {
     cnt++;
 }
 
+template <class T> void PerlListBase<T>::add(T&& n) {
+    if (cnt + first >= allocated)
+        grow();
+    a[first + cnt] = std::move(n);
+    cnt++;
+}
+
 template <class T> void PerlListBase<T>::add(const int ip, const T& n) {
     assert(ip >= 0);
     if (first == 0 || (first + cnt) >= allocated)
@@ -547,7 +805,7 @@ template <class T> void PerlListBase<T>::add(const int ip, const T& n) {
         a[first] = n;
     } else {
         for (int i = cnt; i > ip; i--) // shuffle up
-            a[first + i] = a[(first + i) - 1];
+            a[first + i] = std::move(a[(first + i) - 1]);
         a[first + ip] = n;
     }
     cnt++;
@@ -560,7 +818,7 @@ template <class T> void PerlListBase<T>::compact(const int n) { // shuffle down
         first++;
     else
         for (i = n; i < cnt - 1; i++) {
-            a[first + i] = a[(first + i) + 1];
+            a[first + i] = std::move(a[(first + i) + 1]);
         }
     cnt--;
 }
@@ -569,7 +827,7 @@ template <class T> void PerlListBase<T>::compact(const int n) { // shuffle down
 
 template <class T> void PerlList<T>::push(const PerlList<T>& l) {
     for (int i = 0; i < l.count(); i++)
-        add(l[i]);
+        this->add(l[i]);
 }
 
 template <class T> int PerlList<T>::unshift(const PerlList<T>& l) {
@@ -607,7 +865,7 @@ template <class T> PerlList<T> PerlList<T>::splice(int offset, int len, const Pe
     if (offset > count())
         offset = count();
     for (int i = 0; i < l.count(); i++) {
-        add(offset + i, l[i]); // insert into list
+        this->add(offset + i, l[i]); // insert into list
     }
     return r;
 }
@@ -617,12 +875,13 @@ template <class T> PerlList<T> PerlList<T>::splice(int offset, int len) {
 
     if (offset >= count())
         return r;
-    for (int i = offset; i < offset + len; i++) {
+    int i;
+    for (i = offset; i < offset + len; i++) {
         r.add((*this)[i]);
     }
 
     for (i = offset; i < offset + len; i++)
-        compact(offset);
+        this->compact(offset);
     return r;
 }
 
@@ -631,22 +890,36 @@ template <class T> PerlList<T> PerlList<T>::splice(int offset) {
 
     if (offset >= count())
         return r;
-    for (int i = offset; i < count(); i++) {
+    int i;
+    for (i = offset; i < count(); i++) {
         r.add((*this)[i]);
     }
 
     int n = count(); // count() will change so remember what it is
     for (i = offset; i < n; i++)
-        compact(offset);
+        this->compact(offset);
     return r;
 }
 
 // VarString Implementation
+
+// n is the space needed including the '\0'
+INLINE void VarString::init(int n) {
+    if (n <= INLINESZ) {
+        a = buf;
+        allocated = INLINESZ;
+    } else {
+        a = Arena::get(arena, n);
+        allocated = n;
+    }
+}
+
+// n is only the growth increment, the string starts out in buf
 INLINE VarString::VarString(int n) {
-    a = new char[n];
+    arena = Arena::current();
+    init(1);
     *a = '\0';
     len = 0;
-    allocated = n;
     allocinc = n;
 #ifdef DEBUG
     fprintf(stderr, "VarString(int %d) a= %p\n", allocinc, a);
@@ -655,10 +928,10 @@ INLINE VarString::VarString(int n) {
 
 INLINE VarString::VarString(const char* s) {
     int n = strlen(s) + 1;
-    a = new char[n];
+    arena = Arena::current();
+    init(n);
     strcpy(a, s);
     len = n - 1;
-    allocated = n;
     allocinc = ALLOCINC;
 #ifdef DEBUG
     fprintf(stderr, "VarString(const char *(%d)) a= %p\n", allocinc, a);
@@ -666,12 +939,12 @@ INLINE VarString::VarString(const char* s) {
 }
 
 INLINE VarString::VarString(const char* s, int n) {
-    a = new char[n + 1];
+    arena = Arena::current();
+    init(n + 1);
     if (n)
         strncpy(a, s, n);
     a[n] = '\0';
     len = n;
-    allocated = n + 1;
     allocinc = ALLOCINC;
 #ifdef DEBUG
     fprintf(stderr, "VarString(const char *, int(%d)) a= %p\n", allocinc, a);
@@ -679,12 +952,11 @@ INLINE VarString::VarString(const char* s, int n) {
 }
 
 INLINE VarString::VarString(char c) {
-    int n = 2;
-    a = new char[n];
+    arena = Arena::current();
+    init(2);
     a[0] = c;
     a[1] = '\0';
     len = 1;
-    allocated = n;
     allocinc = ALLOCINC;
 #ifdef DEBUG
     fprintf(stderr, "VarString(char (%d)) a= %p\n", allocinc, a);
@@ -712,13 +984,34 @@ INLINE char& VarString::operator[](const int i) {
 }
 
 INLINE VarString::VarString(const VarString& n) {
-    allocated = n.allocated;
+    arena = Arena::current();
+    init(n.len + 1);
     allocinc = n.allocinc;
     len = n.len;
-    a = new char[allocated];
     strcpy(a, n.a);
 #ifdef DEBUG
     fprintf(stderr, "VarString(VarString&) a= %p, source= %p\n", a, n.a);
 #endif
 }
+
+// takes n's string if it has one from the same place, n is left empty
+INLINE VarString::VarString(VarString&& n) {
+    arena = Arena::current();
+    allocinc = n.allocinc;
+    len = n.len;
+    if (n.a == n.buf || n.arena != arena) {
+        init(len + 1);
+        memcpy(a, n.a, len + 1);
+    } else {
+        a = n.a;
+        allocated = n.allocated;
+        n.a = n.buf;
+        n.allocated = INLINESZ;
+    }
+    n.len = 0;
+    *n.a = '\0';
+#ifdef DEBUG
+    fprintf(stderr, "VarString(VarString&&) a= %p\n", a);
+#endif
+}
 #endif
@@ -169,13 +169,22 @@
 #define WORST 0     /* Worst case. */
 
 /*
- * Global work variables for regcomp().
+ * Work variables for regcomp().  These used to be file statics; they live
+ * on regcomp()'s stack now so that any number of threads can compile at
+ * once.
+ */
+typedef struct regcomp_state {
+    const char* regparse; /* Input-scan pointer. */
+    int regnpar;          /* () count. */
+    char* regcode;        /* Code-emit pointer; &regdummy = don't. */
+    long regsize;         /* Code size. */
+} regcomp_state;
+
+/*
+ * Only its address is used, as the "don't emit" marker for regcode; it is
+ * never written, so sharing it between threads is harmless.
  */
-static char* regparse; /* Input-scan pointer. */
-static int regnpar;    /* () count. */
 static char regdummy;
-static char* regcode; /* Code-emit pointer; &regdummy = don't. */
-static long regsize;  /* Code size. */
 
 /*
  * Forward declarations for regcomp()'s friends.
@@ -183,16 +192,16 @@ static long regsize;  /* Code size. */
 #ifndef STATIC
 #define STATIC static
 #endif
-STATIC char* reg();
-STATIC char* regbranch();
-STATIC char* regpiece();
-STATIC char* regatom();
-STATIC char* regnode();
-STATIC char* regnext();
-STATIC void regc();
-STATIC void reginsert();
-STATIC void regtail();
-STATIC void regoptail();
+STATIC char* reg(regcomp_state* g, int paren, int* flagp);
+STATIC char* regbranch(regcomp_state* g, int* flagp);
+STATIC char* regpiece(regcomp_state* g, int* flagp);
+STATIC char* regatom(regcomp_state* g, int* flagp);
+STATIC char* regnode(regcomp_state* g, char op);
+STATIC char* regnext(char* p);
+STATIC void regc(regcomp_state* g, char b);
+STATIC void reginsert(regcomp_state* g, char op, char* opnd);
+STATIC void regtail(char* p, char* val);
+STATIC void regoptail(char* p, char* val);
 #ifdef STRCSPN
 STATIC int strcspn();
 #endif
@@ -219,35 +228,37 @@ regexp* regcomp(const char* exp)
     register char* longest;
     register int len;
     int flags;
+    regcomp_state state;
+    regcomp_state* g = &state;
 
     if (exp == NULL)
         FAIL("NULL argument");
 
     /* First pass: determine size, legality. */
-    regparse = exp;
-    regnpar = 1;
-    regsize = 0L;
-    regcode = (char*)&regdummy; /* cast shuts up a false compiler warning */
-    regc(MAGIC);
-    if (reg(0, &flags) == NULL) {
+    g->regparse = exp;
+    g->regnpar = 1;
+    g->regsize = 0L;
+    g->regcode = (char*)&regdummy; /* cast shuts up a false compiler warning */
+    regc(g, MAGIC);
+    if (reg(g, 0, &flags) == NULL) {
         return (NULL);
     }
 
     /* Small enough for pointer-storage convention? */
-    if (regsize >= 32767L) /* Probably could be 65535L. */
+    if (g->regsize >= 32767L) /* Probably could be 65535L. */
         FAIL("regexp too big");
 
     /* Allocate space. */
-    r = (regexp*)malloc(sizeof(regexp) + (unsigned)regsize);
+    r = (regexp*)malloc(sizeof(regexp) + (unsigned)g->regsize);
     if (r == NULL)
         FAIL("out of space");
 
     /* Second pass: emit code. */
-    regparse = exp;
-    regnpar = 1;
-    regcode = r->program;
-    regc(MAGIC);
-    if (reg(0, &flags) == NULL) {
+    g->regparse = exp;
+    g->regnpar = 1;
+    g->regcode = r->program;
+    regc(g, MAGIC);
+    if (reg(g, 0, &flags) == NULL) {
         return (NULL);
     }
 
@@ -301,8 +312,7 @@ regexp* regcomp(const char* exp)
  * is a trifle forced, but the need to tie the tails of the branches to what
  * follows makes it hard to avoid.
  */
-static char* reg(paren, flagp) int paren; /* Parenthesized? */
-int* flagp;
+static char* reg(regcomp_state* g, int paren /* Parenthesized? */, int* flagp)
 {
     register char* ret;
     register char* br;
@@ -314,17 +324,17 @@ int* flagp;
 
     /* Make an OPEN node, if parenthesized. */
     if (paren) {
-        if (regnpar >= NSUBEXP)
+        if (g->regnpar >= NSUBEXP)
             FAIL("too many ()");
-        parno = regnpar;
-        regnpar++;
-        ret = regnode(OPEN + parno);
+        parno = g->regnpar;
+        g->regnpar++;
+        ret = regnode(g, OPEN + parno);
     } else {
         ret = NULL;
     }
 
     /* Pick up the branches, linking them together. */
-    br = regbranch(&flags);
+    br = regbranch(g, &flags);
     if (br == NULL) {
         return (NULL);
     }
@@ -337,9 +347,9 @@ int* flagp;
         *flagp &= ~HASWIDTH;
     }
     *flagp |= flags & SPSTART;
-    while (*regparse == '|') {
-        regparse++;
-        br = regbranch(&flags);
+    while (*g->regparse == '|') {
+        g->regparse++;
+        br = regbranch(g, &flags);
         if (br == NULL) {
             return (NULL);
         }
@@ -351,7 +361,7 @@ int* flagp;
     }
 
     /* Make a closing node, and hook it on the end. */
-    ender = regnode((paren) ? CLOSE + parno : END);
+    ender = regnode(g, (paren) ? CLOSE + parno : END);
     regtail(ret, ender);
 
     /* Hook the tails of the branches to the closing node. */
@@ -360,10 +370,10 @@ int* flagp;
     }
 
     /* Check for proper termination. */
-    if (paren && *regparse++ != ')') {
+    if (paren && *g->regparse++ != ')') {
         FAIL("unmatched ()");
-    } else if (!paren && *regparse != '\0') {
-        if (*regparse == ')') {
+    } else if (!paren && *g->regparse != '\0') {
+        if (*g->regparse == ')') {
             FAIL("unmatched ()");
         } else
             FAIL("junk on end"); /* "Can't happen". */
@@ -378,7 +388,7 @@ int* flagp;
  *
  * Implements the concatenation operator.
  */
-static char* regbranch(flagp) int* flagp;
+static char* regbranch(regcomp_state* g, int* flagp)
 {
     register char* ret;
     register char* chain;
@@ -387,10 +397,10 @@ static char* regbranch(flagp) int* flagp;
 
     *flagp = WORST; /* Tentatively. */
 
-    ret = regnode(BRANCH);
+    ret = regnode(g, BRANCH);
     chain = NULL;
-    while (*regparse != '\0' && *regparse != '|' && *regparse != ')') {
-        latest = regpiece(&flags);
+    while (*g->regparse != '\0' && *g->regparse != '|' && *g->regparse != ')') {
+        latest = regpiece(g, &flags);
         if (latest == NULL) {
             return (NULL);
         }
@@ -403,7 +413,7 @@ static char* regbranch(flagp) int* flagp;
         chain = latest;
     }
     if (chain == NULL) { /* Loop ran zero times. */
-        (void)regnode(NOTHING);
+        (void)regnode(g, NOTHING);
     }
 
     return (ret);
@@ -418,19 +428,19 @@ static char* regbranch(flagp) int* flagp;
  * It might seem that this node could be dispensed with entirely, but the
  * endmarker role is not redundant.
  */
-static char* regpiece(flagp) int* flagp;
+static char* regpiece(regcomp_state* g, int* flagp)
 {
     register char* ret;
     register char op;
     register char* next;
     int flags;
 
-    ret = regatom(&flags);
+    ret = regatom(g, &flags);
     if (ret == NULL) {
         return (NULL);
     }
 
-    op = *regparse;
+    op = *g->regparse;
     if (!ISMULT(op)) {
         *flagp = flags;
         return (ret);
@@ -441,33 +451,33 @@ static char* regpiece(flagp) int* flagp;
     *flagp = (op != '+') ? (WORST | SPSTART) : (WORST | HASWIDTH);
 
     if (op == '*' && (flags & SIMPLE)) {
-        reginsert(STAR, ret);
+        reginsert(g, STAR, ret);
     } else if (op == '*') {
         /* Emit x* as (x&|), where & means "self". */
-        reginsert(BRANCH, ret);         /* Either x */
-        regoptail(ret, regnode(BACK));  /* and loop */
+        reginsert(g, BRANCH, ret);         /* Either x */
+        regoptail(ret, regnode(g, BACK));  /* and loop */
         regoptail(ret, ret);            /* back */
-        regtail(ret, regnode(BRANCH));  /* or */
-        regtail(ret, regnode(NOTHING)); /* null. */
+        regtail(ret, regnode(g, BRANCH));  /* or */
+        regtail(ret, regnode(g, NOTHING)); /* null. */
     } else if (op == '+' && (flags & SIMPLE)) {
-        reginsert(PLUS, ret);
+        reginsert(g, PLUS, ret);
     } else if (op == '+') {
         /* Emit x+ as x(&|), where & means "self". */
-        next = regnode(BRANCH); /* Either */
+        next = regnode(g, BRANCH); /* Either */
         regtail(ret, next);
-        regtail(regnode(BACK), ret);    /* loop back */
-        regtail(next, regnode(BRANCH)); /* or */
-        regtail(ret, regnode(NOTHING)); /* null. */
+        regtail(regnode(g, BACK), ret);    /* loop back */
+        regtail(next, regnode(g, BRANCH)); /* or */
+        regtail(ret, regnode(g, NOTHING)); /* null. */
     } else if (op == '?') {
         /* Emit x? as (x|) */
-        reginsert(BRANCH, ret);        /* Either x */
-        regtail(ret, regnode(BRANCH)); /* or */
-        next = regnode(NOTHING);       /* null. */
+        reginsert(g, BRANCH, ret);        /* Either x */
+        regtail(ret, regnode(g, BRANCH)); /* or */
+        next = regnode(g, NOTHING);       /* null. */
         regtail(ret, next);
         regoptail(ret, next);
     }
-    regparse++;
-    if (ISMULT(*regparse))
+    g->regparse++;
+    if (ISMULT(*g->regparse))
         FAIL("nested *?+");
 
     return (ret);
@@ -481,64 +491,64 @@ static char* regpiece(flagp) int* flagp;
  * faster to run.  Backslashed characters are exceptions, each becoming a
  * separate node; the code is simpler that way and it's not worth fixing.
  */
-static char* regatom(flagp) int* flagp;
+static char* regatom(regcomp_state* g, int* flagp)
 {
     register char* ret;
     int flags;
 
     *flagp = WORST; /* Tentatively. */
 
-    switch (*regparse++) {
+    switch (*g->regparse++) {
         case '^':
-            ret = regnode(BOL);
+            ret = regnode(g, BOL);
             break;
         case '$':
-            ret = regnode(EOL);
+            ret = regnode(g, EOL);
             break;
         case '.':
-            ret = regnode(ANY);
+            ret = regnode(g, ANY);
             *flagp |= HASWIDTH | SIMPLE;
             break;
         case '[': {
             register int class;
             register int classend;
 
-            if (*regparse == '^') { /* Complement of range. */
-                ret = regnode(ANYBUT);
-                regparse++;
+            if (*g->regparse == '^') { /* Complement of range. */
+                ret = regnode(g, ANYBUT);
+                g->regparse++;
             } else {
-                ret = regnode(ANYOF);
+                ret = regnode(g, ANYOF);
             }
-            if (*regparse == ']' || *regparse == '-') {
-                regc(*regparse++);
+            if (*g->regparse == ']' || *g->regparse == '-') {
+                regc(g, *g->regparse++);
             }
-            while (*regparse != '\0' && *regparse != ']') {
-                if (*regparse == '-') {
-                    regparse++;
-                    if (*regparse == ']' || *regparse == '\0') {
-                        regc('-');
+            while (*g->regparse != '\0' && *g->regparse != ']') {
+                if (*g->regparse == '-') {
+                    g->regparse++;
+                    if (*g->regparse == ']' || *g->regparse == '\0') {
+                        regc(g, '-');
                     } else {
-                        class = UCHARAT(regparse - 2) + 1;
-                        classend = UCHARAT(regparse);
+                        class = UCHARAT(g->regparse - 2) + 1;
+                        classend = UCHARAT(g->regparse);
                         if (class > classend + 1)
                             FAIL("invalid [] range");
                         for (; class <= classend; class ++) {
-                            regc(class);
+                            regc(g, class);
                         }
-                        regparse++;
+                        g->regparse++;
                     }
                 } else {
-                    regc(*regparse++);
+                    regc(g, *g->regparse++);
                 }
             }
-            regc('\0');
-            if (*regparse != ']')
+            regc(g, '\0');
+            if (*g->regparse != ']')
                 FAIL("unmatched []");
-            regparse++;
+            g->regparse++;
             *flagp |= HASWIDTH | SIMPLE;
         } break;
         case '(':
-            ret = reg(1, &flags);
+            ret = reg(g, 1, &flags);
             if (ret == NULL) {
                 return (NULL);
             }
@@ -555,22 +565,22 @@ static char* regatom(flagp) int* flagp;
             FAIL("?+* follows nothing");
             break;
         case '\\':
-            if (*regparse == '\0')
+            if (*g->regparse == '\0')
                 FAIL("trailing \\");
-            ret = regnode(EXACTLY);
-            regc(*regparse++);
-            regc('\0');
+            ret = regnode(g, EXACTLY);
+            regc(g, *g->regparse++);
+            regc(g, '\0');
             *flagp |= HASWIDTH | SIMPLE;
             break;
         default: {
             register int len;
             register char ender;
 
-            regparse--;
-            len = strcspn(regparse, META);
+            g->regparse--;
+            len = strcspn(g->regparse, META);
             if (len <= 0)
                 FAIL("internal disaster");
-            ender = *(regparse + len);
+            ender = *(g->regparse + len);
             if (len > 1 && ISMULT(ender)) {
                 len--; /* Back off clear of ?+* operand. */
             }
@@ -578,12 +588,12 @@ static char* regatom(flagp) int* flagp;
             if (len == 1) {
                 *flagp |= SIMPLE;
             }
-            ret = regnode(EXACTLY);
+            ret = regnode(g, EXACTLY);
             while (len > 0) {
-                regc(*regparse++);
+                regc(g, *g->regparse++);
                 len--;
             }
-            regc('\0');
+            regc(g, '\0');
         } break;
     }
 
@@ -594,14 +604,14 @@ static char* regatom(flagp) int* flagp;
  - regnode - emit a node
  */
 static char* /* Location. */
-    regnode(op) char op;
+    regnode(regcomp_state* g, char op)
 {
     register char* ret;
     register char* ptr;
 
-    ret = regcode;
+    ret = g->regcode;
     if (ret == &regdummy) {
-        regsize += 3;
+        g->regsize += 3;
         return (ret);
     }
 
@@ -609,7 +619,7 @@ static char* /* Location. */
     *ptr++ = op;
     *ptr++ = '\0'; /* Null "next" pointer. */
     *ptr++ = '\0';
-    regcode = ptr;
+    g->regcode = ptr;
 
     return (ret);
 }
@@ -617,12 +627,12 @@ static char* /* Location. */
 /*
  - regc - emit (if appropriate) a byte of code
  */
-static void regc(b) char b;
+static void regc(regcomp_state* g, char b)
 {
-    if (regcode != &regdummy) {
-        *regcode++ = b;
+    if (g->regcode != &regdummy) {
+        *g->regcode++ = b;
     } else {
-        regsize++;
+        g->regsize++;
     }
 }
 
@@ -631,21 +641,20 @@ static void regc(b) char b;
  *
  * Means relocating the operand.
  */
-static void reginsert(op, opnd) char op;
-char* opnd;
+static void reginsert(regcomp_state* g, char op, char* opnd)
 {
     register char* src;
     register char* dst;
     register char* place;
 
-    if (regcode == &regdummy) {
-        regsize += 3;
+    if (g->regcode == &regdummy) {
+        g->regsize += 3;
         return;
     }
 
-    src = regcode;
-    regcode += 3;
-    dst = regcode;
+    src = g->regcode;
+    g->regcode += 3;
+    dst = g->regcode;
     while (src > opnd) {
         *--dst = *--src;
     }
@@ -659,8 +668,7 @@ char* opnd;
 /*
  - regtail - set the next-pointer at the end of a node chain
  */
-static void regtail(p, val) char* p;
-char* val;
+static void regtail(char* p, char* val)
 {
     register char* scan;
     register char* temp;
@@ -692,8 +700,7 @@ char* val;
 /*
  - regoptail - regtail on operand of first argument; nop if operandless
  */
-static void regoptail(p, val) char* p;
-char* val;
+static void regoptail(char* p, char* val)
 {
     /* "Operandless" and "op != BRANCH" are synonymous in practice. */
     if (p == NULL || p == &regdummy || OP(p) != BRANCH) {
@@ -707,19 +714,21 @@ char* val;
  */
 
 /*
- * Global work variables for regexec().
+ * Work variables for regexec(), one set per call.
  */
-static char* reginput;   /* String-input pointer. */
-static char* regbol;     /* Beginning of input, for ^ check. */
-static char** regstartp; /* Pointer to startp array. */
-static char** regendp;   /* Ditto for endp. */
+typedef struct regexec_state {
+    const char* reginput; /* String-input pointer. */
+    const char* regbol;   /* Beginning of input, for ^ check. */
+    char** regstartp;     /* Pointer to startp array. */
+    char** regendp;       /* Ditto for endp. */
+} regexec_state;
 
 /*
  * Forwards.
  */
-STATIC int regtry();
-STATIC int regmatch();
-STATIC int regrepeat();
+STATIC int regtry(regexec_state* e, const regexp* prog, const char* string);
+STATIC int regmatch(regexec_state* e, char* prog);
+STATIC int regrepeat(regexec_state* e, char* p);
 
 #ifdef DEBUG
 int regnarrate = 0;
@@ -729,12 +738,31 @@ STATIC char* regprop();
 
 /*
  - regexec - match a regexp against a string
+ *
+ * The match is left in prog->startp and prog->endp, so a program can only
+ * be used by one thread at a time through this entry point.
  */
-int regexec(prog, string) register regexp* prog;
-register char* string;
+int regexec(regexp* prog, const char* string)
 {
-    register char* s;
-    extern char* strchr();
+    if (prog == NULL) {
+        regerror("NULL parameter");
+        return (0);
+    }
+    return (regexec_r(prog, string, prog->startp, prog->endp));
+}
+
+/*
+ - regexec_r - reentrant regexec
+ *
+ * The program is only read; the match goes into the caller's startp and
+ * endp arrays (NSUBEXP entries each), so a compiled program can be shared
+ * by any number of threads.
+ */
+int regexec_r(const regexp* prog, const char* string, char** startp, char** endp)
+{
+    register const char* s;
+    regexec_state state;
+    regexec_state* e = &state;
 
     /* Be paranoid... */
     if (prog == NULL || string == NULL) {
@@ -763,11 +791,13 @@ register char* string;
     }
 
     /* Mark beginning of line for ^ . */
-    regbol = string;
+    e->regbol = string;
+    e->regstartp = startp;
+    e->regendp = endp;
 
     /* Simplest case:  anchored match need be tried only once. */
     if (prog->reganch) {
-        return (regtry(prog, string));
+        return (regtry(e, prog, string));
     }
 
     /* Messy cases:  unanchored match. */
@@ -775,7 +805,7 @@ register char* string;
     if (prog->regstart != '\0') {
         /* We know what char it must start with. */
         while ((s = strchr(s, prog->regstart)) != NULL) {
-            if (regtry(prog, s)) {
+            if (regtry(e, prog, s)) {
                 return (1);
             }
             s++;
@@ -783,7 +813,7 @@ register char* string;
     } else {
         /* We don't -- general case. */
         do {
-            if (regtry(prog, s)) {
+            if (regtry(e, prog, s)) {
                 return (1);
             }
         } while (*s++ != '\0');
@@ -797,26 +827,23 @@ register char* string;
  - regtry - try match at specific point
  */
 static int /* 0 failure, 1 success */
-    regtry(prog, string) regexp* prog;
-char* string;
+    regtry(regexec_state* e, const regexp* prog, const char* string)
 {
     register int i;
     register char** sp;
     register char** ep;
 
-    reginput = string;
-    regstartp = prog->startp;
-    regendp = prog->endp;
+    e->reginput = string;
 
-    sp = prog->startp;
-    ep = prog->endp;
+    sp = e->regstartp;
+    ep = e->regendp;
     for (i = NSUBEXP; i > 0; i--) {
         *sp++ = NULL;
         *ep++ = NULL;
     }
-    if (regmatch(prog->program + 1)) {
-        prog->startp[0] = string;
-        prog->endp[0] = reginput;
+    if (regmatch(e, (char*)prog->program + 1)) {
+        e->regstartp[0] = (char*)string;
+        e->regendp[0] = (char*)e->reginput;
         return (1);
     } else {
         return (0);
@@ -834,11 +861,10 @@ char* string;
  * by recursion.
  */
 static int /* 0 failure, 1 success */
-    regmatch(prog) char* prog;
+    regmatch(regexec_state* e, char* prog)
 {
     register char* scan; /* Current node. */
     char* next;          /* Next node. */
-    extern char* strchr();
 
     scan = prog;
 #ifdef DEBUG
@@ -854,20 +880,20 @@ static int /* 0 failure, 1 success */
 
         switch (OP(scan)) {
             case BOL:
-                if (reginput != regbol) {
+                if (e->reginput != e->regbol) {
                     return (0);
                 }
                 break;
             case EOL:
-                if (*reginput != '\0') {
+                if (*e->reginput != '\0') {
                     return (0);
                 }
                 break;
             case ANY:
-                if (*reginput == '\0') {
+                if (*e->reginput == '\0') {
                     return (0);
                 }
-                reginput++;
+                e->reginput++;
                 break;
             case EXACTLY: {
                 register int len;
@@ -875,26 +901,26 @@ static int /* 0 failure, 1 success */
 
                 opnd = OPERAND(scan);
                 /* Inline the first character, for speed. */
-                if (*opnd != *reginput) {
+                if (*opnd != *e->reginput) {
                     return (0);
                 }
                 len = strlen(opnd);
-                if (len > 1 && strncmp(opnd, reginput, len) != 0) {
+                if (len > 1 && strncmp(opnd, e->reginput, len) != 0) {
                     return (0);
                 }
-                reginput += len;
+                e->reginput += len;
             } break;
             case ANYOF:
-                if (*reginput == '\0' || strchr(OPERAND(scan), *reginput) == NULL) {
+                if (*e->reginput == '\0' || strchr(OPERAND(scan), *e->reginput) == NULL) {
                     return (0);
                 }
-                reginput++;
+                e->reginput++;
                 break;
             case ANYBUT:
-                if (*reginput == '\0' || strchr(OPERAND(scan), *reginput) != NULL) {
+                if (*e->reginput == '\0' || strchr(OPERAND(scan), *e->reginput) != NULL) {
                     return (0);
                 }
-                reginput++;
+                e->reginput++;
                 break;
             case NOTHING:
                 break;
@@ -910,19 +936,19 @@ static int /* 0 failure, 1 success */
             case OPEN + 8:
             case OPEN + 9: {
                 register int no;
-                register char* save;
+                register const char* save;
 
                 no = OP(scan) - OPEN;
-                save = reginput;
+                save = e->reginput;
 
-                if (regmatch(next)) {
+                if (regmatch(e, next)) {
                     /*
                      * Don't set startp if some later
                      * invocation of the same parentheses
                      * already has.
                      */
-                    if (regstartp[no] == NULL) {
-                        regstartp[no] = save;
+                    if (e->regstartp[no] == NULL) {
+                        e->regstartp[no] = (char*)save;
                     }
                     return (1);
                 } else {
@@ -939,19 +965,19 @@ static int /* 0 failure, 1 success */
             case CLOSE + 8:
             case CLOSE + 9: {
                 register int no;
-                register char* save;
+                register const char* save;
 
                 no = OP(scan) - CLOSE;
-                save = reginput;
+                save = e->reginput;
 
-                if (regmatch(next)) {
+                if (regmatch(e, next)) {
                     /*
                      * Don't set endp if some later
                      * invocation of the same parentheses
                      * already has.
                      */
-                    if (regendp[no] == NULL) {
-                        regendp[no] = save;
+                    if (e->regendp[no] == NULL) {
+                        e->regendp[no] = (char*)save;
                     }
                     return (1);
                 } else {
@@ -959,17 +985,17 @@ static int /* 0 failure, 1 success */
                 }
             } break;
             case BRANCH: {
-                register char* save;
+                register const char* save;
 
                 if (OP(next) != BRANCH) { /* No choice. */
                     next = OPERAND(scan); /* Avoid recursion. */
                 } else {
                     do {
-                        save = reginput;
-                        if (regmatch(OPERAND(scan))) {
+                        save = e->reginput;
+                        if (regmatch(e, OPERAND(scan))) {
                             return (1);
                         }
-                        reginput = save;
+                        e->reginput = save;
                         scan = regnext(scan);
                     } while (scan != NULL && OP(scan) == BRANCH);
                     return (0);
@@ -980,7 +1006,7 @@ static int /* 0 failure, 1 success */
             case PLUS: {
                 register char nextch;
                 register int no;
-                register char* save;
+                register const char* save;
                 register int min;
 
                 /*
@@ -992,18 +1018,18 @@ static int /* 0 failure, 1 success */
                     nextch = *OPERAND(next);
                 }
                 min = (OP(scan) == STAR) ? 0 : 1;
-                save = reginput;
-                no = regrepeat(OPERAND(scan));
+                save = e->reginput;
+                no = regrepeat(e, OPERAND(scan));
                 while (no >= min) {
                     /* If it could work, try it. */
-                    if (nextch == '\0' || *reginput == nextch) {
-                        if (regmatch(next)) {
+                    if (nextch == '\0' || *e->reginput == nextch) {
+                        if (regmatch(e, next)) {
                             return (1);
                         }
                     }
                     /* Couldn't or didn't -- back up. */
                     no--;
-                    reginput = save + no;
+                    e->reginput = save + no;
                 }
                 return (0);
             } break;
@@ -1030,14 +1056,13 @@ static int /* 0 failure, 1 success */
 /*
  - regrepeat - repeatedly match something simple, report how many
  */
-static int regrepeat(p) char* p;
+static int regrepeat(regexec_state* e, char* p)
 {
-    char* strchr();
     register int count = 0;
-    register char* scan;
+    register const char* scan;
     register char* opnd;
 
-    scan = reginput;
+    scan = e->reginput;
     opnd = OPERAND(p);
     switch (OP(p)) {
         case ANY:
@@ -1067,11 +1092,311 @@ static int regrepeat(p) char* p;
             count = 0; /* Best compromise. */
             break;
     }
-    reginput = scan;
+    e->reginput = scan;
 
     return (count);
 }
 
+/*
+ - regexec_nfa - match a regexp against a string in linear time
+ *
+ * Same program, same answers as regexec_r(), but instead of backtracking
+ * it runs all the possible paths through the program in lock step (a
+ * "Pike VM", see Russ Cox, "Regular Expression Matching: the Virtual
+ * Machine Approach").  Threads are kept in priority order, the order in
+ * which regmatch() would have tried them, so the leftmost match and the
+ * groups it reports are the ones regexec_r() finds.  Each character of
+ * the string is looked at once per program position, so the time is
+ * O(length of string * size of program) whatever the pattern.
+ *
+ * A thread waits on something that consumes a character:
+ *	EXACTLY		one character of the operand string
+ *	ANY, ANYOF, ANYBUT	the node itself
+ *	STAR, PLUS	the simple node that is the operand of the loop
+ * and is named by the address of that thing in the program, which keeps
+ * two threads from ever being in the same place at the same time.
+ */
+typedef struct regthread {
+    char* node;     /* Node the thread is in. */
+    char* at;       /* What it matches next; also its name. */
+    const char* cap[2 * NSUBEXP]; /* startp then endp. */
+} regthread;
+
+typedef struct regthreads {
+    regthread* t;
+    int n;
+} regthreads;
+
+typedef struct regnfa_state {
+    char* program;      /* Base for naming threads. */
+    const char* regbol; /* Beginning of input, for ^ check. */
+    int* mark;          /* [name] == step it was last added in. */
+    int step;
+} regnfa_state;
+
+STATIC void regaddthread(regnfa_state* v, regthreads* l, char* scan, const char* sp, const char** cap);
+
+/*
+ - regthreadat - start a thread waiting at "at", unless there is one already
+ */
+static void regthreadat(regnfa_state* v, regthreads* l, char* scan, char* at, const char** cap)
+{
+    register regthread* t;
+
+    if (v->mark[at - v->program] == v->step)
+        return;
+    v->mark[at - v->program] = v->step;
+    t = &l->t[l->n++];
+    t->node = scan;
+    t->at = at;
+    memcpy(t->cap, cap, sizeof(t->cap));
+}
+
+/*
+ - regloop - at a STAR, or a PLUS that has matched once
+ */
+static void regloop(regnfa_state* v, regthreads* l, char* scan, const char* sp, const char** cap)
+{
+    regthreadat(v, l, scan, OPERAND(scan), cap); /* Greedy: once more first, */
+    regaddthread(v, l, regnext(scan), sp, cap);  /* then whatever follows. */
+}
+
+/*
+ - regaddthread - follow everything that takes no input from scan, in
+ * the order regmatch() would try it, leaving threads where input is needed
+ */
+static void regaddthread(regnfa_state* v, regthreads* l, char* scan, const char* sp, const char** cap)
+{
+    register int no;
+    const char* save;
+    char* next;
+
+    while (scan != NULL) {
+        switch (OP(scan)) {
+            case EXACTLY:
+            case PLUS:
+                regthreadat(v, l, scan, OPERAND(scan), cap);
+                return;
+            case ANY:
+            case ANYOF:
+            case ANYBUT:
+                regthreadat(v, l, scan, scan, cap);
+                return;
+            case STAR:
+                regloop(v, l, scan, sp, cap);
+                return;
+            case END:
+                save = cap[NSUBEXP];
+                cap[NSUBEXP] = sp;
+                regthreadat(v, l, scan, scan, cap);
+                cap[NSUBEXP] = save;
+                return;
+        }
+
+        if (v->mark[scan - v->program] == v->step)
+            return; /* Been here already this step. */
+        v->mark[scan - v->program] = v->step;
+        next = regnext(scan);
+        switch (OP(scan)) {
+            case BOL:
+                if (sp != v->regbol)
+                    return;
+                break;
+            case EOL:
+                if (*sp != '\0')
+                    return;
+                break;
+            case NOTHING:
+            case BACK:
+                break;
+            case BRANCH:
+                if (OP(next) != BRANCH) { /* No choice. */
+                    next = OPERAND(scan);
+                } else {
+                    do {
+                        regaddthread(v, l, OPERAND(scan), sp, cap);
+                        scan = regnext(scan);
+                    } while (scan != NULL && OP(scan) == BRANCH);
+                    return;
+                }
+                break;
+            default:
+                if (OP(scan) > OPEN && OP(scan) < OPEN + NSUBEXP) {
+                    no = OP(scan) - OPEN;
+                } else if (OP(scan) > CLOSE && OP(scan) < CLOSE + NSUBEXP) {
+                    no = OP(scan) - CLOSE + NSUBEXP;
+                } else {
+                    regerror("memory corruption");
+                    return;
+                }
+                save = cap[no];
+                cap[no] = sp;
+                regaddthread(v, l, next, sp, cap);
+                cap[no] = save;
+                return;
+        }
+        scan = next;
+    }
+}
+
+/*
+ - regsimple - does simple node p match character c?
+ */
+static int regsimple(char* p, int c)
+{
+    switch (OP(p)) {
+        case ANY:
+            return (1);
+        case EXACTLY:
+            return (*OPERAND(p) == c);
+        case ANYOF:
+            return (strchr(OPERAND(p), c) != NULL);
+        case ANYBUT:
+            return (strchr(OPERAND(p), c) == NULL);
+    }
+    regerror("internal foulup");
+    return (0);
+}
+
+/*
+ - regstep - move thread t over the character at sp into list l
+ */
+static void regstep(regnfa_state* v, regthreads* l, regthread* t, const char* sp)
+{
+    register char* scan = t->node;
+    register int loop = OP(scan) == STAR || OP(scan) == PLUS;
+
+    if (OP(scan) == EXACTLY) {
+        if (*t->at != *sp)
+            return;
+        if (t->at[1] != '\0') { /* More of the string to go. */
+            regthreadat(v, l, scan, t->at + 1, t->cap);
+            return;
+        }
+    } else if (!regsimple(loop ? t->at : scan, *sp)) {
+        return;
+    }
+    if (loop)
+        regloop(v, l, scan, sp + 1, t->cap);
+    else
+        regaddthread(v, l, regnext(scan), sp + 1, t->cap);
+}
+
+/*
+ - regprogsize - length of a compiled program; the END of the whole
+ * expression is always the last node
+ */
+static int regprogsize(const regexp* prog)
+{
+    register const char* s = prog->program + 1;
+    register char op;
+
+    do {
+        op = OP(s);
+        s += 3;
+        if (op == ANYOF || op == ANYBUT || op == EXACTLY)
+            s += strlen(s) + 1;
+    } while (op != END);
+    return (s - prog->program);
+}
+
+int regexec_nfa(const regexp* prog, const char* string, char** startp, char** endp)
+{
+    register const char* sp;
+    register int i;
+    regnfa_state state;
+    regnfa_state* v = &state;
+    regthreads lists[2];
+    regthreads* clist = &lists[0];
+    regthreads* nlist = &lists[1];
+    regthreads* tmp;
+    const char* cap[2 * NSUBEXP];
+    int matched = 0;
+    int size;
+
+    /* Be paranoid... */
+    if (prog == NULL || string == NULL) {
+        regerror("NULL parameter");
+        return (0);
+    }
+
+    /* Check validity of program. */
+    if (UCHARAT(prog->program) != MAGIC) {
+        regerror("corrupted program");
+        return (0);
+    }
+
+    /* If there is a "must appear" string, look for it. */
+    if (prog->regmust != NULL) {
+        sp = string;
+        while ((sp = strchr(sp, prog->regmust[0])) != NULL) {
+            if (strncmp(sp, prog->regmust, prog->regmlen) == 0) {
+                break; /* Found it. */
+            }
+            sp++;
+        }
+        if (sp == NULL) { /* Not present. */
+            return (0);
+        }
+    }
+
+    /* No name is used twice in a step, so a list never needs more room. */
+    size = regprogsize(prog);
+    v->program = (char*)prog->program;
+    v->regbol = string;
+    v->mark = (int*)malloc(size * sizeof(int));
+    clist->t = (regthread*)malloc(size * sizeof(regthread));
+    nlist->t = (regthread*)malloc(size * sizeof(regthread));
+    if (v->mark == NULL || clist->t == NULL || nlist->t == NULL) {
+        free(v->mark);
+        free(clist->t);
+        free(nlist->t);
+        regerror("out of space");
+        return (0);
+    }
+    for (i = 0; i < size; i++)
+        v->mark[i] = 0;
+    v->step = 1;
+    clist->n = 0;
+
+    for (sp = string;; sp++) {
+        /* A match starting here comes after everything already going. */
+        if (!matched && (!prog->reganch || sp == string) && (prog->regstart == '\0' || *sp == prog->regstart)) {
+            for (i = 0; i < 2 * NSUBEXP; i++)
+                cap[i] = NULL;
+            cap[0] = sp;
+            regaddthread(v, clist, (char*)prog->program + 1, sp, cap);
+        }
+        if (clist->n == 0 && (matched || prog->reganch || *sp == '\0'))
+            break;
+
+        v->step++;
+        nlist->n = 0;
+        for (i = 0; i < clist->n; i++) {
+            regthread* t = &clist->t[i];
+            if (OP(t->node) == END) {
+                /* Anything after this has lower priority. */
+                memcpy(startp, t->cap, NSUBEXP * sizeof(char*));
+                memcpy(endp, t->cap + NSUBEXP, NSUBEXP * sizeof(char*));
+                matched = 1;
+                break;
+            }
+            if (*sp != '\0')
+                regstep(v, nlist, t, sp);
+        }
+        if (*sp == '\0')
+            break;
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+    }
+
+    free(v->mark);
+    free(lists[0].t);
+    free(lists[1].t);
+    return (matched);
+}
+
 /*
  - regnext - dig the "next" pointer out of a node
  */
@@ -44,10 +44,14 @@ typedef struct regexp {
 extern "C" {
 regexp* regcomp(const char*);
 int regexec(regexp*, const char*);
+int regexec_r(const regexp*, const char*, char** startp, char** endp);
+int regexec_nfa(const regexp*, const char*, char** startp, char** endp);
 }
 #else
 extern regexp* regcomp();
 extern int regexec();
+extern int regexec_r();
+extern int regexec_nfa();
 extern void regsub();
 extern void regerror();
 #endif
@@ -29,12 +29,13 @@
  */
 #ifndef _REGEXP_H
 #define _REGEXP_H
-#include <iostream>
+#include <stdio.h>
 #include <stdlib.h>
 #include <malloc.h>
 #include <string.h>
 #include <assert.h>
 #include <ctype.h>
+#include <atomic>
 
 #include "regex.h"
 
@@ -68,23 +69,77 @@ class Range {
     }
 };
 
+/*
+ * The result of one match: the groups as offsets into the target.
+ * Keeping these apart from Regexp means one compiled Regexp can be
+ * matched from many threads at once, each with its own RegexpMatch.
+ */
+class RegexpMatch {
+  private:
+    int ngroups;
+    int st[NSUBEXP], en[NSUBEXP];
+
+  public:
+    RegexpMatch() {
+        ngroups = 0;
+    }
+
+    void set(const char* targ, char* const* startp, char* const* endp) {
+        ngroups = 0;
+        for (int i = 0; i < NSUBEXP; i++) {
+            if (startp[i] == NULL)
+                break;
+            st[i] = (int)(startp[i] - targ);
+            en[i] = (int)(endp[i] - targ) - 1;
+            ngroups++;
+        }
+    }
+
+    void clear(void) {
+        ngroups = 0;
+    }
+
+    int groups(void) const {
+        return ngroups;
+    }
+
+    Range getgroup(int n) const {
+        assert(n < NSUBEXP);
+        return Range(st[n], en[n]);
+    }
+};
+
 class Regexp {
   public:
     enum options { def = 0, nocase = 1 };
+    // regexec_r() backtracks, regexec_nfa() is linear in the target length
+    enum engines { backtrack = 0, nfa = 1 };
 
   private:
     regexp* repat;
-    const char* target; // only used as a base address to get an offset
-    int res;
+    RegexpMatch last; // what match(const char *) found, for groups()/getgroup()
     int iflg;
 #ifndef __TURBOC__
-    void strlwr(char* s) {
+    static void strlwr(char* s) {
         while (*s) {
             *s = tolower(*s);
             s++;
         }
     }
 #endif
+    Regexp(const Regexp&);            // the compiled program isn't copyable
+    Regexp& operator=(const Regexp&);
+
+    static int& engine(void) {
+        static int e = backtrack;
+        return e;
+    }
+    static int exec(const regexp* prog, const char* targ, char** startp, char** endp) {
+        if (engine() == nfa)
+            return regexec_nfa(prog, targ, startp, endp);
+        return regexec_r(prog, targ, startp, endp);
+    }
+
   public:
     Regexp(const char* rege, int ifl = 0) {
         iflg = ifl;
@@ -93,13 +148,13 @@ class Regexp {
             strcpy(r, rege);
             strlwr(r);
             if ((repat = regcomp(r)) == NULL) {
-                std::cerr << "regcomp() error" << std::endl;
+                fprintf(stderr, "regcomp() error\n");
                 exit(1);
             }
             delete[] r;
         } else {
             if ((repat = regcomp(rege)) == NULL) {
-                std::cerr << "regcomp() error" << std::endl;
+                fprintf(stderr, "regcomp() error\n");
                 exit(1);
             }
         }
@@ -109,36 +164,92 @@ class Regexp {
         free(repat);
     }
 
-    int match(const char* targ) {
+    // which matcher every Regexp uses; both give the same results
+    static void use_engine(int e) {
+        engine() = e;
+    }
+
+    // reentrant: only reads the compiled program
+    int match(const char* targ, RegexpMatch& m) const {
         int res;
+        char* startp[NSUBEXP];
+        char* endp[NSUBEXP];
         if (iflg == nocase) { // fold lowercase
             char* r = new char[strlen(targ) + 1];
             strcpy(r, targ);
             strlwr(r);
-            res = regexec(repat, r);
-            target = r; // looks bad but is really ok, really
+            res = exec(repat, r, startp, endp);
+            if (res)
+                m.set(r, startp, endp); // offsets are the same in targ
             delete[] r;
         } else {
-            res = regexec(repat, targ);
-            target = targ;
+            res = exec(repat, targ, startp, endp);
+            if (res)
+                m.set(targ, startp, endp);
         }
+        if (!res)
+            m.clear();
 
         return ((res == 0) ? 0 : 1);
     }
 
+    int match(const char* targ) {
+        return match(targ, last);
+    }
+
     int groups(void) const {
-        int res = 0;
-        for (int i = 0; i < NSUBEXP; i++) {
-            if (repat->startp[i] == NULL)
-                break;
-            res++;
-        }
-        return res;
+        return last.groups();
     }
 
     Range getgroup(int n) const {
-        assert(n < NSUBEXP);
-        return Range((int)(repat->startp[n] - (char*)target), (int)(repat->endp[n] - (char*)target) - 1);
+        return last.getgroup(n);
+    }
+};
+
+/*
+ * A Regexp that isn't compiled until it's first matched, so having
+ * hundreds of them, most never used, costs next to nothing.  Threads
+ * may race to match it first: each compiles it, one gets to keep its
+ * copy and the others throw theirs away.  The pattern isn't copied, it
+ * has to last as long as the LazyRegexp; a constant one can be made
+ * when the program is loaded.  Nothing frees the compiled Regexp, which
+ * is left for the program's exit, so a table of them needs neither
+ * constructing nor destroying.
+ */
+class LazyRegexp {
+  private:
+    const char* rege;
+    int iflg;
+    mutable std::atomic<Regexp*> re;
+    LazyRegexp(const LazyRegexp&);
+    LazyRegexp& operator=(const LazyRegexp&);
+
+  public:
+    constexpr LazyRegexp(const char* r, int ifl = 0) : rege(r), iflg(ifl), re(nullptr) {
+    }
+
+    const Regexp& get(void) const {
+        Regexp* r = re.load(std::memory_order_acquire);
+        if (!r) {
+            Regexp* mine = new Regexp(rege, iflg);
+            if (re.compare_exchange_strong(r, mine, std::memory_order_acq_rel))
+                r = mine;
+            else
+                delete mine; // r is the one that got there first
+        }
+        return *r;
+    }
+
+    const char* pattern(void) const {
+        return rege;
+    }
+
+    int compiled(void) const {
+        return re.load(std::memory_order_acquire) != 0;
+    }
+
+    int match(const char* targ, RegexpMatch& m) const {
+        return get().match(targ, m);
     }
 };
 #endif
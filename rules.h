@@ -0,0 +1,79 @@
+/*
+ * The translations toogl makes, as constant tables.  mkrules makes them
+ * from rules.def when toogl is built, so nothing has to be constructed
+ * or allocated for them when toogl starts.
+ */
+#ifndef _RULES_H
+#define _RULES_H
+
+#include "regexp.h"
+
+/*
+ * What a rule's regexp breaks a line into.  For a function call
+ *	(stuff before name)(name including whitespace up to '(')('(' to end of line)
+ * and for a #defined constant
+ *	(stuff before name)(name)(stuff after name)
+ */
+#define FUNC_PRE "^(.*[^a-zA-Z_0-9]+|)("
+#define FUNC_POST "[ \t]*)(\\(.*)$"
+#define DEFINE_PRE "^(.*[^a-zA-Z_0-9]+|)("
+#define DEFINE_POST ")([^a-zA-Z_0-9]+.*|)$"
+
+// a piece of a replacement: some text, then an arg if there's one.  Only
+// args rules have more than one, the rest being the replacement as is.
+struct RuleSegment {
+    const char* text; // in the replacement, so the "$n" follows it
+    int len;
+    int arg; // 1 based, 0 for the last, which ends the replacement
+};
+
+struct Rule {
+    enum kinds {
+        simple,  // name() becomes the replacement
+        deleted, // the call is replaced by a comment and put in the comments
+        args,    // $1 ... in the replacement become the call's args
+        define   // the identifier becomes the replacement
+    };
+    // which options the rule is used with
+    enum groups { always, window, queue, lighting, emulation, ngroups };
+
+    // what's looked at for every rule nominated
+    const char* name;
+    short namelen;
+    unsigned char bucket; // process_line() tries rules by bucket, then by place in rules[]
+    unsigned char kind;
+    unsigned char group;
+    short same;    // next rule with the same name, -1 if none
+    LazyRegexp re; // compiled the first time the rule is nominated and tried
+
+    // what's only wanted once the rule matches
+    const char* rep;
+    const RuleSegment* segs;     // rep split at its "$n"s
+    const char* const* comments; // lines of the OGLXXX comment
+    short nsegs;
+    short ncomments;
+    short replen; // length of rep less its "$n"s
+};
+
+extern Rule rules[]; // sorted by bucket, so in the order process_line() tries them
+extern const int nrules;
+extern const unsigned long long rules_version; // hash of all the tables say
+
+int rule_lookup(const char* name, int len); // first rule with that name, or -1
+
+/*
+ * The hash rule_lookup() uses, different for each d.  Names are put in
+ * buckets by rule_hash(name, 0), and each bucket has a d that takes its
+ * names to slots that no other name has.
+ */
+inline unsigned rule_hash(const char* s, int len, unsigned d) {
+    unsigned h = 2166136261u ^ (d * 0x9e3779b9u);
+    while (len-- > 0)
+        h = (h ^ (unsigned char)*s++) * 16777619u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+#endif
@@ -89,3 +89,405 @@ int Search::check(const char *s)
     }
     return 0;    
 }
+
+/*
+ * WideSearch runs a Search for each name length side by side, with the
+ * shift and-ed the other way round: bit i of a lane is set when the last
+ * i+1 characters could be the start of one of its names.
+ */
+#include <string.h>
+
+WideSearch::WideSearch()
+{
+    memset(table, 0, sizeof table);
+    memset(last, 0, sizeof last);
+}
+
+void WideSearch::add(const char *s)
+{
+    int i, len = strlen(s);
+    int lane = len < MAXPATTERN - 1 ? len : MAXPATTERN - 1;
+    
+    for(i = 0; i < lane; i++)
+	table[(unsigned char)s[i]][lane] |= 1u << i;
+    if(lane)
+	last[lane] = 1u << (lane - 1);
+}
+
+typedef unsigned (*WideCheck)(const unsigned (*table)[MAXPATTERN], const unsigned *last,
+    const char *s, int n);
+
+// bit per lane that got to the end of one of its names, seen being every
+// state each lane went through
+static inline unsigned
+lanes_found(const unsigned *seen, const unsigned *last)
+{
+    unsigned found = 0;
+    for(int lane = 0; lane < MAXPATTERN; lane++) {
+	if(seen[lane] & last[lane])
+	    found |= 1u << lane;
+    }
+    return found;
+}
+
+// two lanes to a 64 bit word, for any CPU.  Shifting carries the top of
+// the low lane into the bottom of the high one, but that bit is set
+// regardless straight after.
+static unsigned
+check_words(const unsigned (*table)[MAXPATTERN], const unsigned *last, const char *s, int n)
+{
+    enum {NWORD = MAXPATTERN / 2};
+    const unsigned long long one = 0x0000000100000001ull;
+    unsigned long long state[NWORD], seen[NWORD], t[NWORD];
+    unsigned lanes[MAXPATTERN];
+    int i, k;
+    
+    for(k = 0; k < NWORD; k++)
+	state[k] = seen[k] = 0;
+    for(i = 0; i < n; i++) {
+	memcpy(t, table[(unsigned char)s[i]], sizeof t);
+	for(k = 0; k < NWORD; k++) {
+	    state[k] = ((state[k] << 1) | one) & t[k];
+	    seen[k] |= state[k];
+	}
+    }
+    memcpy(lanes, seen, sizeof lanes);
+    return lanes_found(lanes, last);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+__attribute__((target("sse2"))) static unsigned
+check_sse2(const unsigned (*table)[MAXPATTERN], const unsigned *last, const char *s, int n)
+{
+    enum {NREG = MAXPATTERN / 4};
+    const __m128i one = _mm_set1_epi32(1);
+    __m128i state[NREG], seen[NREG];
+    unsigned lanes[MAXPATTERN];
+    int i, k;
+    
+    for(k = 0; k < NREG; k++)
+	state[k] = seen[k] = _mm_setzero_si128();
+    for(i = 0; i < n; i++) {
+	const __m128i *t = (const __m128i *)table[(unsigned char)s[i]];
+	for(k = 0; k < NREG; k++) {
+	    state[k] = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(state[k], 1), one),
+		_mm_loadu_si128(t + k));
+	    seen[k] = _mm_or_si128(seen[k], state[k]);
+	}
+    }
+    for(k = 0; k < NREG; k++)
+	_mm_storeu_si128((__m128i *)lanes + k, seen[k]);
+    return lanes_found(lanes, last);
+}
+
+__attribute__((target("avx2"))) static unsigned
+check_avx2(const unsigned (*table)[MAXPATTERN], const unsigned *last, const char *s, int n)
+{
+    enum {NREG = MAXPATTERN / 8};
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i state[NREG], seen[NREG];
+    unsigned lanes[MAXPATTERN];
+    int i, k;
+    
+    for(k = 0; k < NREG; k++)
+	state[k] = seen[k] = _mm256_setzero_si256();
+    for(i = 0; i < n; i++) {
+	const __m256i *t = (const __m256i *)table[(unsigned char)s[i]];
+	for(k = 0; k < NREG; k++) {
+	    state[k] = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(state[k], 1), one),
+		_mm256_loadu_si256(t + k));
+	    seen[k] = _mm256_or_si256(seen[k], state[k]);
+	}
+    }
+    for(k = 0; k < NREG; k++)
+	_mm256_storeu_si256((__m256i *)lanes + k, seen[k]);
+    return lanes_found(lanes, last);
+}
+#endif
+
+struct WideKernel {
+    const char *name;
+    WideCheck check;
+};
+
+// the check()s the CPU can run, slowest first
+struct WideKernels {
+    const WideKernel *k[3];
+    int n;
+    WideKernels();
+};
+
+WideKernels::WideKernels()
+{
+    static const WideKernel words = {"64 bit words", check_words};
+#if defined(__x86_64__) || defined(__i386__)
+    static const WideKernel sse2 = {"SSE2", check_sse2};
+    static const WideKernel avx2 = {"AVX2", check_avx2};
+#endif
+    
+    n = 0;
+    k[n++] = &words;
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse2"))
+	k[n++] = &sse2;
+    if(__builtin_cpu_supports("avx2"))
+	k[n++] = &avx2;
+#endif
+}
+
+static inline const WideKernels &
+wide_kernels()
+{
+    static const WideKernels ks;
+    return ks;
+}
+
+// the fastest
+static inline const WideKernel *
+wide_kernel()
+{
+    return wide_kernels().k[wide_kernels().n - 1];
+}
+
+// bit per name length that may occur in the n characters at s
+unsigned WideSearch::check(const char *s, int n) const
+{
+    return wide_kernel()->check(table, last, s, n);
+}
+
+// the same, with kernel k of kernels()
+unsigned WideSearch::check(const char *s, int n, int k) const
+{
+    return wide_kernels().k[k]->check(table, last, s, n);
+}
+
+const char *WideSearch::kernel()
+{
+    return wide_kernel()->name;
+}
+
+int WideSearch::kernels()
+{
+    return wide_kernels().n;
+}
+
+const char *WideSearch::kernel(int k)
+{
+    return wide_kernels().k[k]->name;
+}
+
+/*
+ * Aho-Corasick multiple pattern matcher.
+ * "Efficient String Matching: An Aid to Bibliographic Search"
+ * Communications of the ACM
+ * June 1975 Volume 18,  Number 6
+ * pp 333-340
+ *
+ * All the toogl names are made of identifier characters, so the alphabet
+ * is squeezed down to the characters that appear in some name; anything
+ * else sends the automaton back to the root.  The goto function is
+ * completed into a DFA when the first line is scanned, so scan() does one
+ * table lookup per character.  Names can still be added after that (see
+ * init_optional_functions()); the automaton is then rebuilt.
+ */
+
+static inline int
+identchar(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+	(c >= '0' && c <= '9') || c == '_';
+}
+
+MultiSearch::MultiSearch()
+{
+    unsigned i;
+    for(i = 0; i < sizeof(sym)/sizeof(sym[0]); sym[i++] = 0);
+    delta = 0;
+    fail = out = dict = 0;
+    nnode = maxnode = 0;
+    pat = 0;
+    patlen = 0;
+    npat = maxpat = 0;
+    compiled = 0;
+    reset();
+}
+
+MultiSearch::~MultiSearch()
+{
+    int i;
+    for(i = 0; i < npat; i++)
+	delete [] pat[i];
+    delete [] pat;
+    delete [] patlen;
+    delete [] delta;
+    delete [] fail;
+    delete [] out;
+    delete [] dict;
+}
+
+// throw away the automaton, leaving just the root
+void MultiSearch::reset()
+{
+    nnode = 0;
+    newnode();
+    compiled = 0;
+}
+
+int MultiSearch::newnode()
+{
+    int i;
+    if(nnode == maxnode) {
+	int n = maxnode ? maxnode * 2 : 256;
+	int *nd = new int[n * NSYM];
+	int *nf = new int[n], *no = new int[n], *ndi = new int[n];
+	if(nnode) {
+	    memcpy(nd, delta, nnode * NSYM * sizeof(int));
+	    memcpy(nf, fail, nnode * sizeof(int));
+	    memcpy(no, out, nnode * sizeof(int));
+	    memcpy(ndi, dict, nnode * sizeof(int));
+	}
+	delete [] delta;
+	delete [] fail;
+	delete [] out;
+	delete [] dict;
+	delta = nd;
+	fail = nf;
+	out = no;
+	dict = ndi;
+	maxnode = n;
+    }
+    for(i = 0; i < NSYM; i++)
+	delta[nnode * NSYM + i] = 0;	// root is never a child, so 0 is "no edge"
+    fail[nnode] = 0;
+    out[nnode] = -1;
+    dict[nnode] = -1;
+    return nnode++;
+}
+
+// walk/extend the trie with s.  Returns the pattern id already at the end
+// of the path, or id if there wasn't one.
+int MultiSearch::insert(const char *s, int id)
+{
+    int i, node = 0;
+    for(i = 0; s[i]; i++) {
+	int c = (unsigned char)s[i];
+	if(!sym[c]) {
+	    int n = 0;
+	    unsigned j;
+	    for(j = 0; j < sizeof(sym)/sizeof(sym[0]); j++)
+		if(sym[j] > n)
+		    n = sym[j];
+	    if(n + 1 >= NSYM) {
+		std::cerr << "MultiSearch: too many different characters in names\n";
+		exit(1);
+	    }
+	    sym[c] = n + 1;
+	}
+	int *d = &delta[node * NSYM + sym[c]];
+	if(!*d) {
+	    int nn = newnode();	// may move delta
+	    d = &delta[node * NSYM + sym[c]];
+	    *d = nn;
+	}
+	node = *d;
+    }
+    if(out[node] < 0)
+	out[node] = id;
+    return out[node];
+}
+
+// add a name, returning its id.  Adding the same name twice gives the same id.
+int MultiSearch::add(const char *s)
+{
+    int i;
+    if(compiled) {	// DFA edges can't be told from trie edges, start over
+	reset();
+	for(i = 0; i < npat; i++)
+	    insert(pat[i], i);
+    }
+    int id = insert(s, npat);
+    if(id != npat)
+	return id;
+    if(npat == maxpat) {
+	int n = maxpat ? maxpat * 2 : 256;
+	char **np = new char *[n];
+	int *nl = new int[n];
+	for(i = 0; i < npat; i++) {
+	    np[i] = pat[i];
+	    nl[i] = patlen[i];
+	}
+	delete [] pat;
+	delete [] patlen;
+	pat = np;
+	patlen = nl;
+	maxpat = n;
+    }
+    pat[npat] = strcpy(new char[strlen(s) + 1], s);
+    patlen[npat] = strlen(s);
+    return npat++;
+}
+
+// breadth first over the trie filling in fail links and turning missing
+// goto edges into DFA transitions.
+void MultiSearch::compile()
+{
+    int *queue = new int[nnode];
+    int head = 0, tail = 0;
+    int c;
+    
+    for(c = 1; c < NSYM; c++) {
+	int n = delta[c];
+	if(n) {
+	    fail[n] = 0;
+	    queue[tail++] = n;
+	}
+    }
+    while(head < tail) {
+	int node = queue[head++];
+	dict[node] = out[fail[node]] >= 0 ? fail[node] : dict[fail[node]];
+	for(c = 1; c < NSYM; c++) {
+	    int *d = &delta[node * NSYM + c];
+	    int f = delta[fail[node] * NSYM + c];
+	    if(*d) {
+		fail[*d] = f;
+		queue[tail++] = *d;
+	    } else
+		*d = f;
+	}
+    }
+    delete [] queue;
+    compiled = 1;
+}
+
+// call hit() for every identifier-bounded occurrence of a name in s.
+// Returns the number of occurrences.
+int MultiSearch::scan(const char *s, MultiSearchHit hit, void *arg)
+{
+    return scan(s, strlen(s), hit, arg);
+}
+
+int MultiSearch::scan(const char *s, int len, MultiSearchHit hit, void *arg)
+{
+    int i, node = 0, n = 0;
+    
+    if(!compiled)
+	compile();
+    for(i = 0; i < len; i++) {
+	node = delta[node * NSYM + sym[(unsigned char)s[i]]];
+	if(!node || (i + 1 < len && identchar((unsigned char)s[i + 1])))
+	    continue;
+	int t = out[node] >= 0 ? node : dict[node];
+	for(; t > 0; t = dict[t]) {
+	    int start = i - patlen[out[t]] + 1;
+	    if(start == 0 || !identchar((unsigned char)s[start - 1])) {
+		n++;
+		if(hit)
+		    hit(out[t], start, arg);
+	    }
+	}
+    }
+    return n;
+}
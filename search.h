@@ -37,3 +37,69 @@ class Search {
     unsigned int cstate;
     unsigned int lim;
 };
+
+/*
+ * Search for every name length at once.  Lane b of the state is the
+ * Search state for the names b characters long (MAXPATTERN-1 taking
+ * the first MAXPATTERN-1 characters of longer ones), and all the lanes
+ * move on together a character at a time: 32 of them, so 1024 bits,
+ * four AVX2 or eight SSE2 registers or sixteen 64 bit words.  check()
+ * gives back a bit per lane whose names may occur in the string; it
+ * may say so when they don't, never the other way round.
+ */
+class WideSearch {
+  public:
+    WideSearch();
+    void add(const char* s);
+    unsigned check(const char* s, int n) const;
+    static const char* kernel(); // the check() this CPU uses
+
+    // every check() this CPU can run, slowest first, for comparing them
+    static int kernels();
+    static const char* kernel(int k);
+    unsigned check(const char* s, int n, int k) const;
+
+  private:
+    unsigned table[256][MAXPATTERN]; // [c][lane] bit i set if c may be ith character
+    unsigned last[MAXPATTERN];      // [lane] its names' last character bit
+};
+
+/*
+ * Aho-Corasick automaton over a set of names.  One left to right pass
+ * over a line reports every occurrence of every name that isn't run
+ * into another C identifier on either side.
+ */
+typedef void (*MultiSearchHit)(int id, int offset, void* arg);
+
+class MultiSearch {
+  public:
+    MultiSearch();
+    ~MultiSearch();
+    int add(const char* s);
+    int patterns() const {
+        return npat;
+    }
+    int length(int id) const {
+        return patlen[id];
+    }
+    int scan(const char* s, MultiSearchHit hit, void* arg);
+    int scan(const char* s, int n, MultiSearchHit hit, void* arg); // s needn't be terminated
+    void compile(); // else the first scan() does it, scan() only reads the tables after
+
+  private:
+    void reset();
+    int insert(const char* s, int id);
+    int newnode();
+
+    enum { NSYM = 64 };
+    unsigned char sym[256];    // character -> symbol, 0 for "not in any name"
+    int* delta;                // [node * NSYM + symbol] -> node
+    int* fail;                 // longest proper suffix that is also a trie node
+    int* out;                  // pattern ending at node, -1 if none
+    int* dict;                 // next node on the fail chain with an out
+    int nnode, maxnode;
+    char** pat;
+    int* patlen;
+    int npat, maxpat;
+    int compiled;
+};
@@ -26,36 +26,221 @@
  */
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <iostream>
+#include <fstream>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
 #include <assert.h>
 #include <getopt.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <sys/resource.h>
 
 #include "perlclass.h"
 #include "search.h"
+#include "rules.h"
 
 static char *revision = "$Revision: 1.6 $";
 
-static int lineno = 0;
-static int errors = 0;
+static int total_errors = 0;	// over all the files
+static long total_lines = 0;
+static const char *outdir = 0;	// translating files into here, not stdin to stdout
+static const char *cachedir = 0;	// translations of files seen before
+static std::atomic<long> disk_hits, disk_misses;	// of cachedir
+static int jobs = 1;		// files translated at once
 static int debug = 0;
 static int no_queue = 0;
 static int no_window = 0;
 static int no_comments = 0;
 static int no_lighting = 0;
 static int emulate_lighting = 0;
+static int no_arena = 0;
+static int no_mmap = 0;
+static int remember_lines = 0;	// -M
+static const char *rule_report = 0;	// -r: table, csv or json
+#ifdef PROFILE
+static int profile = 0;		// -P
+#define PROFILE_OPTS "P"
+#else
+#define PROFILE_OPTS ""		// no -P without the timing built in
+#endif
+
+// pieces of the line being translated, by position, so they needn't be copied
+typedef PerlList<Range> RangeList;
+
+// the lines of a line's OGLXXX comment, those from the rules used as they
+// are in the tables, with a 0 standing for each deleted call, in order
+typedef PerlList<const char *> CommentList;
+
+/*
+ * What process_line() made of lines it has already seen, with -M, so a
+ * line that comes round again, as "endpolygon();" does, needn't be
+ * matched again.  The least recently used line makes way once it's full.
+ */
+class LineCache {
+    public:
+	enum {NSLOT = 4096, NHASH = 8192};
+	struct entry {
+	    PerlString in;	// the line
+	    unsigned hash;
+	    int changed;	// else the translation is the line as is
+	    PerlString out;
+	    CommentList comments;
+	    PerlStringList calls;
+	    unsigned long hit_buckets;	// bit per bucket counted in possible_hits
+	    unsigned short replaced[MAXPATTERN];	// counted in replacements
+	    entry *chain, *newer, *older;
+	};
+	
+	LineCache();
+	~LineCache();
+	entry *find(const char *line, int len);
+	entry *add(const char *line, int len);
+	
+	long hits, misses;
+	static long all_hits, all_misses;	// of caches gone
+    private:
+	entry *slots[NSLOT];	// made as needed
+	int nslots;
+	entry **table;
+	entry *newest, *oldest;
+	
+	static unsigned hashof(const char *line, int len);
+	void unlist(entry *e);
+	void list(entry *e);
+};
+
+// what each line goes through, timed by -P
+enum stages {read_stage, prefilter_stage, match_stage, replace_stage, write_stage, nstages};
+
+// what one rule did, and the time it took, for -r
+struct RuleCounts {
+    long nominated;	// by the name search
+    long tried;		// times its name was looked for in the line
+    long regexecs;	// its name was there, so its regexp ran
+    long matches;
+    long long match_ns, replace_ns;
+};
+
+/*
+ * Everything that changes while translating one file.  The rules and
+ * the rest of the tables are only read once set up, so any number of
+ * Translations can run at the same time, one to a thread.
+ */
+class Translation {
+    public:
+	Translation(const char *f = "input");
+	~Translation();
+	void reset(const char *f);
+	
+	const char *filename;
+	std::istream *in;
+	std::ostream *out;
+	std::ostream *err;
+	int lineno;
+	int errors;
+	int possible_hits[MAXPATTERN];
+	int replacements[MAXPATTERN];
+	
+	PerlString instr, ostr;
+	CommentList comments;
+	PerlStringList calls;	// deleted calls, the 0s in comments
+	// the input line, a slice of the mapped input or else all of instr
+	const char *line;
+	int linelen;
+	int in_ostr;	// line has been copied to ostr to be translated
+	
+	const char *map_next, *map_end;	// rest of the mapped input
+	void *map_base;
+	size_t map_size;
+	
+	// bit per rules[] entry whose name occurs in the line being processed,
+	// as a call unless the rule is for a #define
+	unsigned long *nominees;
+	int nnominees;
+	int nominate_after;	// index in rules[] of the first that may be nominated
+	const char *scanning;	// the line being looked through for names
+	int scanlen;
+	int *name_stamp;	// [names id] -> line it was last nominated for
+	int *call_stamp;	// [names id] -> line it was last seen called in
+	int stamp;
+	
+	// for -d, lines translated, those the WideSearch let through and
+	// those with names in, then rules the names in lines would nominate
+	// alone, those tried once calls must have a '(' and those that
+	// matched.  Added to the totals when t goes.
+	long searched, wide_lines, named_lines;
+	long named_rules, called_rules, matched_rules;
+	static long all_searched, all_wide_lines, all_named_lines;
+	static long all_named_rules, all_called_rules, all_matched_rules;
+	
+	RuleCounts *rule_counts;	// [rules index], 0 without -r
+	static RuleCounts *all_rule_counts;
+	
+#ifdef PROFILE
+	// for -P, the time spent in each stage and what went through them
+	long long stage_ns[nstages];
+	long profiled_lines, profiled_bytes;
+	static long long all_stage_ns[nstages];
+	static long all_profiled_lines, all_profiled_bytes;
+#endif
+	
+	Arena temps;	// everything made while translating a line
+	LineCache memo;	// kept from file to file
+};
 
 int matching(const char *, int offset = 0);
-PerlStringList split_args(PerlString &, int &ok);
-void replace_args(PerlString &in, const PerlStringList &args);
+int split_args(Translation &t, const char *in, int offset, RangeList &results);
+void replace_args(Translation &t, PerlString &out, const Rule &r, const char *in, const RangeList &s);
 
-PerlString instr, ostr;
-PerlStringList comments;
+// nanoseconds on the monotonic clock
+static inline long long
+now_ns()
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ll + ts.tv_nsec;
+}
 
-static void error(char *err)
+/*
+ * TIME_STAGE(t, stage) adds the time to the end of the enclosing block
+ * to t's total for stage, with -P.  Unless toogl is built with PROFILE
+ * it's nothing at all.
+ */
+#ifdef PROFILE
+class StageTimer {
+    public:
+	StageTimer(Translation &t, int stage) {
+	    total = profile ? &t.stage_ns[stage] : 0;
+	    start = total ? now_ns() : 0;
+	};
+	~StageTimer() {
+	    if(total)
+		*total += now_ns() - start;
+	};
+    private:
+	long long *total;
+	long long start;
+};
+#define TIME_STAGE(t, stage) StageTimer stage_timer(t, stage)
+#else
+#define TIME_STAGE(t, stage)
+#endif
+
+static void error(Translation &t, char *err)
 {
-    std::cerr << "Error: " << err << " at line " << lineno << " of input.\n";
-    std::cerr << instr << "\n";
-    errors++;
+    *t.err << "Error: " << err << " at line " << t.lineno << " of " << t.filename << ".\n";
+    t.err->write(t.line, t.linelen) << "\n";
+    t.errors++;
 }
 
 static void
@@ -63,20 +248,38 @@ options(int argc, char **argv)
 {
     int c;
     
-    while ((c = getopt(argc,  argv, "dclLqvw")) != -1) {
+    while ((c = getopt(argc,  argv, "aC:cdj:lLMno:" PROFILE_OPTS "qr:svw")) != -1) {
 	switch(c) {
 	default:
-	    std::cerr << "Usage: toogl [-clLqwv] < infile > outfile\n" ;
+	    std::cerr << "Usage: toogl [-aclLMn" PROFILE_OPTS "qswv] [-C cachedir] [-r format] < infile > outfile\n" ;
+	    std::cerr << "       toogl [-aclLMn" PROFILE_OPTS "qswv] [-C cachedir] [-r format] [-j jobs] -o outdir file-or-directory ...\n" ;
+	    std::cerr << "	-a  allocate each line's temporaries from the heap, not the line arena\n";
+	    std::cerr << "	-C  keep translations in cachedir, and reuse them for files that haven't changed\n";
 	    std::cerr << "	-c  don't put comments with OGLXXX into program\n";
+	    std::cerr << "	-j  translate that many files, or chunks of one big file, at once\n";
 	    std::cerr << "	-l  don't translate lighting calls (e.g. lmdef, lmbind, #defines) \n";
 	    std::cerr << "	-L  translate lighting calls for emulation library (mylmdef, mylmbind) (implies -l) \n";
+	    std::cerr << "	-M  remember lines' translations, for input that says the same things over and over\n";
+	    std::cerr << "	-n  match with the linear time NFA instead of the backtracking regex engine\n";
+	    std::cerr << "	-o  translate each file, or each file in a directory, into outdir\n";
+#ifdef PROFILE
+	    std::cerr << "	-P  time reading, finding names, matching, replacing and writing\n";
+#endif
 	    std::cerr << "	-q  don't translate event queue calls (e.g. qread, setvaluator) \n";
+	    std::cerr << "	-r  report what each rule did and the time it took, as a table, csv or json\n";
+	    std::cerr << "	-s  read the input as a stream even if it could be mapped\n";
 	    std::cerr << "	-v  print revision number.\n";
 	    std::cerr << "	-w  don't translate window manager calls (e.g. winopen, mapcolor) \n";
 	    exit (1);
+	case 'a':
+	    no_arena = 1;
+	    break;
 	case 'd':
 	    debug = 1;
 	    break;
+	case 'j':
+	    jobs = atoi(optarg);
+	    break;
 	case 'q':
 	    no_queue = 1;
 	    break;
@@ -86,6 +289,9 @@ options(int argc, char **argv)
 	case 'c':
 	    no_comments = 1;
 	    break;
+	case 'C':
+	    cachedir = optarg;
+	    break;
 	case 'l':
 	    no_lighting = 1;
 	    break;
@@ -93,6 +299,30 @@ options(int argc, char **argv)
 	    emulate_lighting = 1;
 	    no_lighting = 1;
 	    break;
+	case 'M':
+	    remember_lines = 1;
+	    break;
+	case 'n':
+	    Regexp::use_engine(Regexp::nfa);
+	    break;
+	case 'o':
+	    outdir = optarg;
+	    break;
+#ifdef PROFILE
+	case 'P':
+	    profile = 1;
+	    break;
+#endif
+	case 'r':
+	    rule_report = optarg;
+	    if(strcmp(optarg, "table") && strcmp(optarg, "csv") && strcmp(optarg, "json")) {
+		std::cerr << "toogl: -r wants table, csv or json\n";
+		exit(1);
+	    }
+	    break;
+	case 's':
+	    no_mmap = 1;
+	    break;
 	case 'v':
 	    std::cerr << "toogl " << revision << "\n";
 	    break;
@@ -100,1142 +330,1570 @@ options(int argc, char **argv)
     }
 }
 
-int read_line()
+// if the input is a plain file map it, so lines can be read in place
+static void
+map_input(Translation &t, int fd)
 {
-    std::cin >> instr;
-    instr = " " + instr + " ";	// add a space before and after string so regular expressions that require non-alphanumeric before and after will work.
-    lineno++;
-    return (!std::cin.eof()); 
+    struct stat st;
+    off_t at;
+    void *p;
+    
+    if(no_mmap || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+	return;
+    if((at = lseek(fd, 0, SEEK_CUR)) < 0)
+	return;
+    p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p == MAP_FAILED)
+	return;
+    madvise(p, st.st_size, MADV_SEQUENTIAL);
+    t.map_base = p;
+    t.map_size = st.st_size;
+    t.map_next = (const char *)p + at;
+    t.map_end = (const char *)p + st.st_size;
 }
 
+static void
+unmap_input(Translation &t)
+{
+    if(t.map_base)
+	munmap(t.map_base, t.map_size);
+    t.map_base = 0;
+    t.map_next = t.map_end = 0;
+}
 
-class glThing;
-static glThing
-     *first_glThing[MAXPATTERN], **last_glThing[MAXPATTERN];
+int read_line(Translation &t)
+{
+    TIME_STAGE(t, read_stage);
+    t.lineno++;
+    if(t.map_end) {
+	const char *nl = (const char *)memchr(t.map_next, '\n', t.map_end - t.map_next);
+	if(!nl)
+	    return 0;	// as with the stream, a last line without a '\n' is dropped
+	t.line = t.map_next;
+	t.linelen = nl - t.map_next;
+	t.map_next = nl + 1;
+	return 1;
+    }
+    *t.in >> t.instr;
+    t.line = t.instr;
+    t.linelen = t.instr.length();
+    return (!t.in->eof()); 
+}
 
-     
-Search search[MAXPATTERN];
 
-class glThing {
-    public:
-	glThing(const PerlString &n) :name(n) {
-	    // link into list of all glFuncs.
-	    int len = n.length();
-	    if(len > MAXPATTERN-1)
-		len = MAXPATTERN-1;
-	    prev = last_glThing[len];
-	    if(!prev) {
-		prev = last_glThing[len] = &first_glThing[len];
-	    }
-	    last_glThing[len] = &(this->nextp);
-	    nextp = 0;
-	    *prev = this;
-	    search[len].add((const char *)n);
-	};
-	~glThing() {	// can't undo search.add()
-	    *prev = nextp;
-	    if(nextp)
-		nextp->prev = prev;
-	};
-	inline glThing *next() {return nextp;};
-	virtual int m(PerlString &,  PerlStringList &) = 0;
-	virtual void replace(PerlString &in, PerlStringList &s) = 0 ;
-    private:
-	const PerlString name;
-        glThing *nextp, **prev;
+MultiSearch names;		// the names of the rules in use
+static WideSearch wide;		// the same, only for -d to see how it would do
+static int names_indexed = 0;	// by_name[] is up to date
+static int group_on[Rule::ngroups];	// the groups of rules the options leave in
 
-};
+enum {NOMINEE_BITS = 8 * sizeof(unsigned long)};
 
-//const static PerlString pre("^(.*[^a-zA-Z_0-9]+)*(");
-const static PerlString pre("^(.*[^a-zA-Z_0-9]+)(");  // XXX won't work at beginning of line
-const static PerlString post("[ \t]*)(\\(.*)$");
-
-
-class glFunc :public glThing {
-protected:   
-    Regexp re;
-    const PerlString restr;
-    const PerlString quick;
-public:
-    glFunc( const PerlString & name ) : glThing(name), re(pre+name+post), restr(pre+name+post), quick(name) {
-    };
-    
-    ~glFunc() {
-    };
-    
-    virtual int m( PerlString & f, PerlStringList & s) {
-	int ret = 0;
-	if(f.length() && f[0] && (-1 != f.index(quick))) {    // don't try to match null strings
-	    /* The re breaks it into:
-	     * (stuff before name) -- verify no alphanumeric prefixed to name
-	     * (name including whitespace up to '('))
-	     * ('(' plus stuff after '(' to end of line)))
-	     * 
-	     * further processing breaks it into:
-	     * (stuff before name)			[0]
-	     * (name including whitespace up to '('))	[1]
-	     * a '('					[2]
-	     * arg1					[3]
-	     * arg2
-	     * ...				
-	     * argn					[nargs+2]	    
-	     * closing ')'				[nargs+3]
-	     * rest of line				[nargs+4]
-	     * note:there is ALWAYS at least 1 arg string
-	     */
-	    int i = f.m(re, s);
-	    s.shift();	// drop match of whole line
-	    i--;
-//	    assert(i == -1 || i == 3);	// re either matches or doesn't
-	    if(i == 3) {
-		int ok;
-		PerlString rest(s[2]);
-		s.pop();
-		s.push(split_args(rest, ok));
-		if(ok)
-		    ret = s.scalar();
-	    } else if (i != -1) {
-		std::cerr << "Internal Error, wierd re match:(" << i << ")\n" << s.join("\n") << "\nRE:" << restr << '\n';
-	    }
-	} 
-	return ret;
-	};
-	
-    virtual void replace(PerlString &in, PerlStringList &s) = 0 ;
+// the piece of in that r covers, added to out
+static inline void
+append_range(PerlString &out, const PerlString &in, const Range &r)
+{
+    out.append((const char *)in + r.start(), r.length());
+}
+
+/*
+ * Whether r's name starts anywhere in f before offset before.  The
+ * regexps all take the last place in the line the name is used, so each
+ * time a rule matches again it's further left, before what it replaced.
+ */
+static inline int
+name_before(const Rule &r, const PerlString &f, int before)
+{
+    int n = f.length() < before + r.namelen - 1 ? f.length() : before + r.namelen - 1;
+    return memmem((const char *)f, n, r.name, r.namelen) != 0;
+}
+
+// match a function call rule against f, the name starting before offset
+// before, breaking it into s
+static int
+match_func(Translation &t, const Rule &r, const PerlString &f, RangeList &s, int before)
+{
+    int ret = 0;
+    RegexpMatch rm;
+    RuleCounts *c = t.rule_counts ? &t.rule_counts[&r - rules] : 0;
+    s.reset();
+    if(c)
+	c->tried++;
+    if(f.length() && f[0] && name_before(r, f, before)) {    // don't try to match null strings
+	/* The re breaks it into:
+	 * (stuff before name) -- verify no alphanumeric prefixed to name
+	 * (name including whitespace up to '('))
+	 * ('(' plus stuff after '(' to end of line)))
+	 * 
+	 * further processing breaks it into:
+	 * (stuff before name)			[0]
+	 * (name including whitespace up to '('))	[1]
+	 * a '('					[2]
+	 * arg1					[3]
+	 * arg2
+	 * ...				
+	 * argn					[nargs+2]	    
+	 * closing ')'				[nargs+3]
+	 * rest of line				[nargs+4]
+	 * note:there is ALWAYS at least 1 arg string
+	 * all of them Ranges of f
+	 */
+	if(c)
+	    c->regexecs++;
+	if(!r.re.match(f, rm) || rm.getgroup(2).start() >= before)
+	    return 0;
+	int i = rm.groups() - 1;	// not counting match of whole line
+	if(i == 3) {
+	    s.push(rm.getgroup(1));
+	    s.push(rm.getgroup(2));
+	    if(split_args(t, f, rm.getgroup(3).start(), s))
+		ret = s.scalar();
+	} else {
+	    *t.err << "Internal Error, wierd re match:(" << i << ")\n";
+	    for(int j = 1; j <= i; j++)
+		t.err->write((const char *)f + rm.getgroup(j).start(), rm.getgroup(j).length()) << "\n";
+	    *t.err << "RE:" << r.re.pattern() << '\n';
+	}
+    } 
+    return ret;
+}
+
+// match a #defined constant rule against f, the name starting before
+// offset before, breaking it into s
+static int
+match_define(Translation &t, const Rule &r, const PerlString &f, RangeList &s, int before)
+{
+    RegexpMatch rm;
+    RuleCounts *c = t.rule_counts ? &t.rule_counts[&r - rules] : 0;
+    s.reset();
+    if(c)
+	c->tried++;
+    if(f.length() && f[0] && name_before(r, f, before)) {    // don't try to match null strings
+	/* The re breaks it into:
+	 * (stuff before name)
+	 * (name)
+	 * (stuff after name)
+	 */
+	if(c)
+	    c->regexecs++;
+	if(r.re.match(f, rm) && rm.getgroup(2).start() < before) {
+	    for(int i = 1; i < rm.groups(); i++)	// drop match of whole line
+		s.push(rm.getgroup(i));
+	    return s.scalar();
+	}
+    }
+    return 0;
+}
+
+static inline int
+match_rule(Translation &t, const Rule &r, const PerlString &f, RangeList &s, int before)
+{
+    TIME_STAGE(t, match_stage);
+    if(r.kind == Rule::define)
+	return match_define(t, r, f, s, before);
+    return match_func(t, r, f, s, before);
+}
+
+// how long args rule r's replacement comes to with the args in s
+static int
+replacement_length(const Rule &r, const RangeList &s)
+{
+    const RuleSegment *g;
+    int n = r.replen, nargs = s.scalar() - 5;
     
-};
+    for(g = r.segs; g->arg; g++) {
+	if(g->arg <= nargs)
+	    n += s[g->arg + 2].length();
+    }
+    return n;
+}
 
+// what rule r makes of in, s being the pieces match_rule() broke it into.
+// out is made the right size to start with, so it's only copied into.
+static void
+replace_rule(Translation &t, const Rule &r, PerlString &in, const RangeList &s)
+{
+    TIME_STAGE(t, replace_stage);
+    PerlString out;
+    int i, nargs;
+    
+    switch(r.kind) {
+    case Rule::simple:	// the name and "( )" elements are dropped
+	out.reserve(s[0].length() + r.replen + s[s.scalar() - 1].length());
+	append_range(out, in, s[0]);
+	out += r.rep;
+	append_range(out, in, s[s.scalar() - 1]);
+	break;
+    case Rule::deleted: {	// the entire call is copied into the comments
+	PerlString f;
+	for(i = 0; i < r.ncomments; i++)
+	    t.comments.push(r.comments[i]);
+	nargs = s.scalar() - 5;
+	append_range(f, in, s[1]);
+	f += "(";
+	for(i = 0; i < nargs; i++) {    // move args to f 
+	    if(i)
+		f += ",";
+	    append_range(f, in, s[3 + i]);
+	}
+	f += ")";
+	t.calls.push(std::move(f));
+	t.comments.push(0);
+	out.reserve(s[0].length() + sizeof "/*DELETED*/" - 1 + s[nargs + 4].length());
+	append_range(out, in, s[0]);	// "()" removed and name replaced
+	out += "/*DELETED*/";
+	append_range(out, in, s[nargs + 4]);
+	in = std::move(out);
+	return;
+    }
+    case Rule::args:
+	nargs = s.scalar() - 5;
+	out.reserve(s[0].length() + replacement_length(r, s) + s[nargs + 4].length());
+	append_range(out, in, s[0]);
+	replace_args(t, out, r, in, s);
+	append_range(out, in, s[nargs + 4]);
+	break;
+    case Rule::define:
+	out.reserve(s[0].length() + r.replen + s[2].length());
+	append_range(out, in, s[0]);
+	out += r.rep;
+	append_range(out, in, s[2]);
+	break;
+    }
+    in = std::move(out);
+    for(i = 0; i < r.ncomments; i++)
+	t.comments.push(r.comments[i]);
+}
+ 
+static void
+print_hits(Translation &t)
+{
+    int i;
+    *t.err << "Possible hits & replacements made for " << t.lineno << " lines:\n";
+    for(i = 0; i < MAXPATTERN; i++) {
+	*t.err << i << ":\t" << t.possible_hits[i] ;
+	*t.err << "\t" << t.replacements[i] << "\n";
+    }
+}
 
+// statistics for the whole run, however many files
+static void
+print_totals()
+{
+    Arena::counts a = Arena::totals();
+    
+    std::cerr << "Regexp cache: " << RegexpCache::all_hits() << " hits, "
+	<< RegexpCache::all_misses() << " misses\n";
+    if(disk_hits + disk_misses)
+	std::cerr << "Disk cache: " << disk_hits << " hits, " << disk_misses << " misses\n";
+    if(Translation::all_searched) {
+	long n = Translation::all_searched;
+	std::cerr << "Shift-And search (" << WideSearch::kernel() << "): "
+	    << 100.0 * Translation::all_wide_lines / n << "% of lines may have names in, "
+	    << 100.0 * Translation::all_named_lines / n << "% do\n";
+    }
+    if(Translation::all_named_rules) {
+	long named = Translation::all_named_rules, called = Translation::all_called_rules;
+	long matched = Translation::all_matched_rules;
+	std::cerr << "Rules nominated: " << named << " by name, " << called
+	    << " once they must be called, " << matched << " matched; false hits "
+	    << 100.0 * (named - matched) / named << "% before, "
+	    << (called ? 100.0 * (called - matched) / called : 0.0) << "% after\n";
+    }
+    if(LineCache::all_hits + LineCache::all_misses)
+	std::cerr << "Line cache: " << LineCache::all_hits << " hits, " 
+	    << LineCache::all_misses << " misses, " 
+	    << 100.0 * LineCache::all_hits / (LineCache::all_hits + LineCache::all_misses)
+	    << "% hit\n";
+    if(total_lines) {
+	std::cerr << "Allocations per line: heap " << (double)a.heap_allocs / total_lines
+	    << " (" << a.heap_bytes / total_lines << " bytes), arena " 
+	    << (double)a.nallocs / total_lines << " (" << a.nbytes / total_lines
+	    << " bytes) in " << a.nblocks << " blocks\n";
+    }
+}
 
-// gl functions with no args -- only whitespace allowed inside ()'s
-class glSimple:public glFunc {
-public:
-    glSimple(const PerlString &s, const PerlString &r)
-	:glFunc(s), rep(r), comments(PerlString("")) { 
-    };
+#ifdef PROFILE
+static long long started_ns;	// when main() began, for -P
 
-    glSimple(const PerlString &s, const PerlString &r, const PerlString &c)
-	:glFunc(s), rep(r), comments(c){ 
-    };
+// where the time went for the whole run, for -P.  The stages are timed
+// on their own, so they can add up to more than the wall time with -j.
+static void
+print_profile()
+{
+    static const char *stage_names[nstages] = {"read_line", "prefilter", "match", "replace", "print_line"};
+    long long wall = now_ns() - started_ns, staged = 0;
+    long lines = Translation::all_profiled_lines, bytes = Translation::all_profiled_bytes;
+    struct rusage ru;
+    double secs = wall / 1e9, cpu;
+    int i;
     
+    getrusage(RUSAGE_SELF, &ru);
+    cpu = ru.ru_utime.tv_sec + ru.ru_stime.tv_sec
+	+ (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e6;
+    for(i = 0; i < nstages; i++)
+	staged += Translation::all_stage_ns[i];
+    std::cerr << "Stage\t\tms\t%\n";
+    for(i = 0; i < nstages; i++) {
+	std::cerr << stage_names[i] << (strlen(stage_names[i]) < 8 ? "\t\t" : "\t")
+	    << Translation::all_stage_ns[i] / 1e6 << "\t"
+	    << (staged ? 100.0 * Translation::all_stage_ns[i] / staged : 0.0) << "\n";
+    }
+    std::cerr << "Wall " << wall / 1e6 << " ms, CPU " << cpu * 1e3 << " ms, "
+	<< lines << " lines, " << bytes << " bytes: "
+	<< (secs > 0 ? lines / secs : 0.0) << " lines/sec, "
+	<< (secs > 0 ? bytes / secs : 0.0) << " bytes/sec\n";
+}
+#endif
+
+static int
+by_time(const void *a, const void *b)
+{
+    const RuleCounts &x = Translation::all_rule_counts[*(const int *)a];
+    const RuleCounts &y = Translation::all_rule_counts[*(const int *)b];
+    long long tx = x.match_ns + x.replace_ns, ty = y.match_ns + y.replace_ns;
     
-    ~glSimple() {};
+    if(tx != ty)
+	return tx > ty ? -1 : 1;
+    return *(const int *)a - *(const int *)b;
+}
 
-   	
-    virtual void replace(PerlString &in, PerlStringList &s) {
-	s[1] = rep;
-	int nargs = s.scalar() - 5;
-	s.splice(2, nargs+2);	    // remove "( )" elements
-	in = s.join("");
-	::comments.push(comments.split("#"));
-    };
+// what each rule that was tried did for the whole run, most time first,
+// in the format -r asked for
+static void
+print_rules()
+{
+    static const char *kinds[] = {"simple", "deleted", "args", "define"};
+    const RuleCounts *all = Translation::all_rule_counts;
+    int i, n = 0, *order = new int[nrules];
+    
+    for(i = 0; all && i < nrules; i++) {
+	if(all[i].nominated)
+	    order[n++] = i;
+    }
+    qsort(order, n, sizeof order[0], by_time);
+    
+    if(!strcmp(rule_report, "table"))
+	fprintf(stderr, "%-20s %-7s %10s %10s %10s %10s %12s %12s\n", "rule", "kind",
+	    "nominated", "tried", "regexecs", "matches", "match ms", "replace ms");
+    else if(!strcmp(rule_report, "csv"))
+	fprintf(stderr, "rule,kind,nominated,tried,regexecs,matches,match_ns,replace_ns\n");
+    else
+	fprintf(stderr, "[\n");
+    for(i = 0; i < n; i++) {
+	const Rule &r = rules[order[i]];
+	const RuleCounts &c = all[order[i]];
+	if(!strcmp(rule_report, "table"))
+	    fprintf(stderr, "%-20s %-7s %10ld %10ld %10ld %10ld %12.3f %12.3f\n", r.name,
+		kinds[r.kind], c.nominated, c.tried, c.regexecs, c.matches,
+		c.match_ns / 1e6, c.replace_ns / 1e6);
+	else if(!strcmp(rule_report, "csv"))
+	    fprintf(stderr, "%s,%s,%ld,%ld,%ld,%ld,%lld,%lld\n", r.name, kinds[r.kind],
+		c.nominated, c.tried, c.regexecs, c.matches, c.match_ns, c.replace_ns);
+	else
+	    fprintf(stderr, "  {\"rule\": \"%s\", \"kind\": \"%s\", \"nominated\": %ld, "
+		"\"tried\": %ld, \"regexecs\": %ld, \"matches\": %ld, "
+		"\"match_ns\": %lld, \"replace_ns\": %lld}%s\n", r.name, kinds[r.kind],
+		c.nominated, c.tried, c.regexecs, c.matches, c.match_ns, c.replace_ns,
+		i < n - 1 ? "," : "");
+    }
+    if(!strcmp(rule_report, "json"))
+	fprintf(stderr, "]\n");
+    delete [] order;
+}
 
+static int *by_name;	// [names id] -> first rule in use with that name
 
-private:
-    const PerlString rep;
-    PerlString comments;
-};
+// 64 bit FNV-1a hash of n bytes at p, carrying on from h
+static unsigned long long
+hash64(const char *p, size_t n, unsigned long long h = 14695981039346656037ull)
+{
+    while(n-- > 0)
+	h = (h ^ (unsigned char)*p++) * 1099511628211ull;
+    return h;
+}
 
-// gl functions, possibly with args, to be deleted
-// These are special: entire function is copied into comments.
-class glDelete: public glFunc {
-public:
-    glDelete(const PerlString &s, const PerlString &c) 
-	: glFunc(s), comments(c) {
-    };
-    ~glDelete() {};
-
-
-    virtual void replace(PerlString &in, PerlStringList &s) {
-	::comments.push(comments.split("#"));
-	int nargs = s.scalar() - 5;
-	PerlString f(s[1]);
-	PerlStringList args(6);
-	args = s.splice(3, nargs);
-	f += "(" + args.join(",") + ")";    // move args to f 
-	::comments.push(f);
-	s.splice(2, 2);	// remove "()"
-	s[1] = "/*DELETED*/";	// replace name
-	in = s.join("");
-    };
-
-private:
-    PerlString comments;
-};
+// give names the rules the options leave in, each name once, and point
+// by_name at the first of them.  Done before any translating.
+void
+index_names()
+{
+    int i, r;
+    
+    group_on[Rule::always] = 1;
+    group_on[Rule::window] = !no_window;
+    group_on[Rule::queue] = !no_queue;
+    group_on[Rule::lighting] = !no_lighting;
+    group_on[Rule::emulation] = emulate_lighting;
+    
+    delete [] by_name;
+    by_name = new int[nrules];
+    for(i = 0; i < nrules; i++) {
+	if(rule_lookup(rules[i].name, rules[i].namelen) != i)
+	    continue;	// not the first with its name
+	for(r = i; r >= 0 && !group_on[rules[r].group]; r = rules[r].same)
+	    ;
+	if(r >= 0) {
+	    by_name[names.add(rules[r].name)] = r;
+	    wide.add(rules[r].name);
+	}
+    }
+    names.compile();
+    names_indexed = 1;
+}
 
-// gl Functions with args
-class glArgs: public glFunc {
-public:
-    glArgs(const PerlString &s, const PerlString &r, const PerlString &c) 
-	: glFunc(s), rep(r), comments(c) {
-    };
-    glArgs(const PerlString &s, const PerlString &r) 
-	: glFunc(s), rep(r), comments("") {
-    };
-    ~glArgs() {};
-
-   
-    virtual void replace(PerlString &in, PerlStringList &s) {
-	PerlStringList argz(6);
-	int nargs = s.scalar() - 5;
-	s[1] = rep;
-	argz.push((s.splice(2, nargs+2)));
-	argz.shift();
-	argz.pop();	    // drop '(' and ')'
-	replace_args(s[1], argz);
-	in = s.join("");
-	::comments.push(comments.split("#"));
-    };
-
-
-private:
-    const PerlString rep;
-    PerlString comments;
-};
+LineCache::LineCache()
+{
+    nslots = 0;
+    table = 0;
+    newest = oldest = 0;
+    hits = misses = 0;
+}
 
-const static PerlString defpre("^(.*[^a-zA-Z_0-9]+)(");  // XXX won't work at beginning of line
-const static PerlString defpost(")([^a-zA-Z_0-9]+.*)$"); // XXX won't work at end of line
-
-class glDefine :public glThing {
-private:   
-    Regexp re;
-    const PerlString restr;
-    const PerlString quick;
-    const PerlString rep;
-    PerlString comments;
-public:
-    glDefine( const PerlString & name, const PerlString &repl, const PerlString &com ) : glThing(name), re(defpre+name+defpost), restr(defpre+name+defpost), quick(name), rep(repl), comments(com) {
-    };
-    glDefine( const PerlString & name, const PerlString &repl ) : glThing(name), re(defpre+name+defpost), restr(defpre+name+defpost), quick(name), rep(repl), comments("") {
-    };
-    
-    ~glDefine() {
-    };
-    
-    virtual int m( PerlString & f, PerlStringList & s) {
-	if(f.length() && f[0] && (-1 != f.index(quick))) {    // don't try to match null strings
-	    /* The re breaks it into:
-	     * (stuff before name)
-	     * (name)
-	     * (stuff after name)
-	     */
-	    int i = f.m(re, s);
-	    if(i) {
-		s.shift();	// drop match of whole line
-		return s.scalar();
-	    } else
-		return 0;
-	} else
-	    return 0;
-    };
-	
-    virtual void replace(PerlString &in, PerlStringList &s) {
-	s[1] = rep;
-	in = s.join("");
-	::comments.push(comments.split("#"));
-    };
+long LineCache::all_hits, LineCache::all_misses;
+static std::mutex memo_lock;	// for LineCache::all_hits and all_misses
+
+LineCache::~LineCache()
+{
+    {
+	std::lock_guard<std::mutex> g(memo_lock);
+	all_hits += hits;
+	all_misses += misses;
+    }
+    for(int i = 0; i < nslots; i++)
+	delete slots[i];
+    delete [] table;
+}
+
+unsigned
+LineCache::hashof(const char *line, int len)
+{
+    unsigned h = 2166136261u;
     
-};
+    while(len-- > 0)
+	h = (h ^ (unsigned char)*line++) * 16777619u;
+    return h;
+}
 
+// take e off the list by age
+void
+LineCache::unlist(entry *e)
+{
+    if(e->newer)
+	e->newer->older = e->older;
+    else
+	newest = e->older;
+    if(e->older)
+	e->older->newer = e->newer;
+    else
+	oldest = e->newer;
+}
 
-glSimple simples[] = {
-    glSimple("bgnqstrip", "glBegin(GL_QUAD_STRIP)"),
-    glSimple("endqstrip", "glEnd()"),
-    glSimple("bgntmesh", "glBegin(GL_TRIANGLE_STRIP)"),
-    glSimple("endtmesh", "glEnd()"),
-    glSimple("bgnline", "glBegin(GL_LINE_STRIP)", "for multiple, independent line segments: use GL_LINES"),
-    glSimple("endline", "glEnd()"),
-    glSimple("bgnclosedline", "glBegin(GL_LINE_LOOP)"),
-    glSimple("endclosedline", "glEnd()"),
-    glSimple("bgnpoint", "glBegin(GL_POINTS)"),
-    glSimple("endpoint", "glEnd()"),
-    glSimple("bgnpolygon", "glBegin(GL_POLYGON)", "special cases for polygons:#\tindependant quads: use GL_QUADS#\tindependent triangles: use GL_TRIANGLES"),
-    glSimple("endpolygon", "glEnd()"),
-    glSimple("pushmatrix", "glPushMatrix()"),
-    glSimple("popmatrix", "glPopMatrix()"),
-    glSimple("clear", "glClearIndex(index);glClearColor(r, g, b, a); glClear(GL_COLOR_BUFFER_BIT)", "clear: use only one of glCLearIndex or glClearColor,#and change index or r, g, b, a to correct values"),
-    glSimple("zclear", "glClearDepth(1.); glClear(GL_DEPTH_BUFFER_BIT)"),
-    glSimple("getshade", "(glGetIntegerv(GL_CURRENT_INDEX, &gctmp),  gctmp)", "getcolor:#GLint gctmp;"),  
-    glSimple("getcolor", "(glGetIntegerv(GL_CURRENT_INDEX, &gstmp), gstmp)", "getshade:#GLint gctmp;"),  
-    glSimple("bgncurve", "gluBeginCurve( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("bgnsurface", "gluBeginSurface( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("bgntrim", "gluBeginTrim( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("closeobj", "glEndList()"),
-    glSimple("endcurve", "gluEndCurve( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("endfeedback", "glRenderMode(GL_RENDER)"),  
-    glSimple("endselect", "glRenderMode(GL_RENDER)"), 
-    glSimple("endsurface", "gluEndSurface( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("endtrim", "gluEndTrim( obj )", "replace obj with your GLUnurbsObj*"),  
-    glSimple("finish", "glFinish()"),  
-    glSimple("genobj", "glGenLists(1)", "glGenLists: change range param to get more than one"),  
-    glSimple("getdcm", "glIsEnabled(GL_FOG)", "depthcue supported by GL_FOG"),  
-    glSimple("initnames", "glInitNames()"),  
-    glSimple("pclos", "glEnd()"),  
-    glSimple("popattributes", "glPopAttrib()"),
-    glSimple("popname", "glPopName()"),
-    glSimple("popviewport", "glPopAttrib()", "popviewport: see glPopAttrib man page"),
-    glSimple("pushattributes", "glPushAttrib(GL_ALL_ATTRIB_BITS)"),
-    glSimple("pushviewport", "glPushAttrib(GL_VIEWPORT_BIT)"),
-};
+// put e on the list as the newest
+void
+LineCache::list(entry *e)
+{
+    e->newer = 0;
+    e->older = newest;
+    if(newest)
+	newest->newer = e;
+    else
+	oldest = e;
+    newest = e;
+}
 
-glDelete deletes[] = {
-    glDelete("addtopup", "addtopup not supported"), 
-    glDelete("subpixel", "always subpixel"), 
-    glDelete("gconfig",  "gconfig not supported:#\tcollect glxChooseVisual attributes into one list for visual selection"), 
-    glDelete("concave", "use gluBeginPolygon(tobj) to draw concave polys"),  
-    glDelete("endpupmode", "endpupmode obsolete"),  
-    glDelete("getothermonitor", "getothermonitor obsolete"),  
-    glDelete("gRGBcursor", "gRGBcursor obsolete"),  
-    glDelete("ismex", "ismex obsolete -- (always TRUE)"),  
-    glDelete("pupmode", "pupmode obsolete"),
-    glDelete("spclos", "spclos obsolete"),  
-    glDelete("swaptmesh", "swaptmesh not supported, maybe glBegin(GL_TRIANGLE_FAN)"),  
-    glDelete("RGBrange", "RGBrange not supported, see glFog()"),  // XXX
-    glDelete("lRGBrange", "lRGBrange not supported, see glFog()"),  // XXX
-    glDelete("shaderange", "shaderange not supported, see glFog()"),  // XXX
-    glDelete("lshaderange", "lshaderange not supported, see glFog()"),  // XXX
-    glDelete("callfunc", "callfunc not supported"),
-    glDelete("chunksize", "chunksize not supported"),
-    glDelete("clearhitcode", "clearhitcode not supported"),
-    glDelete("compactify", "compactify not supported"),
-    glDelete("curveit", "curveit not supported, see glEvalMesh()"),
-    glDelete("defbasis", "defbasis not supported, see glEvalMesh()"),
-    glDelete("deflfont", "deflfont not supported, see glCallLists()"),
-    glDelete("defpup", "defpup not supported"),
-    glDelete("deltag", "deltag not supported"),
-    glDelete("depthcue", "depthcue not supported, See glFog()"),// XXX do better
-    glDelete("dopup", "dopup not supported"),
-    glDelete("editobj", "editobj not supported# -- use display list hierarchy"),
-    glDelete("foreground", "foreground not supported -- see fork man page"),
-    glDelete("freepup", "freepup not supported"),
-    glDelete("bbox2", "bbox2 not supported"),
-    glDelete("bbox2i", "bbox2i not supported"),
-    glDelete("bbox2s", "bbox2s not supported"),
-    glDelete("gentag", "gentag not supported -- use display list hierarchy"),
-    glDelete("getdescender", "getdescender not supported"),
-    glDelete("getfont", "getfont not supported"),
-    glDelete("getheight", "getheight not supported"),
-    glDelete("gethitcode", "gethitcode not supported"),
-    glDelete("getlsbackup", "getlsbackup not supported"),
-    glDelete("getlstyle", "getlstyle not supported"),
-    glDelete("getresetls", "getresetls not supported"),
-    glDelete("getscrbox", "getscrbox not supported"),
-    glDelete("glcompat", "glcompat not supported"),
-    glDelete("gsync", "gsync not supported"),
-    glDelete("gversion", "gversion not supported -- how about \"OpenGL\"?"),
-    glDelete("istag", "istag not supported -- use display list hierarchy"),
-    glDelete("lsbackup", "lsbackup not supported"),
-    glDelete("maketag", "maketag not supported -- use display list hierarchy"),
-    glDelete("newpup", "newpup not supported"),
-    glDelete("newtag", "newtag not supported -- use display list hierarchy"),
-    glDelete("objinsert", "objinsert not supported -- use display list hierarchy"),
-    glDelete("objreplace", "objreplace not supported -- use display list hierarchy"),
-    glDelete("pagecolor", "pagecolor not supported"),
-    glDelete("resetls", "resetls not supported"),
-    glDelete("scrbox", "scrbox not supported"),
-    glDelete("setpup", "setpup not supported -- See Window Manager"),
-    glDelete("strwidth", "strwidth not supported -- See Fonts"),
-    glDelete("lstrwidth", "lstrwidth not supported -- See Fonts"),
-    glDelete("swapinterval", "swapinterval not supported -- See MBX"),
-    glDelete("zdraw", "zdraw not supported -- See stencil for similar functions"),
-    glDelete("zsource", "zsource not supported"),
-    glDelete("getgpos", "getgpos -- graphics position not supported"),
-    glDelete("patch", "patch not supported, see gluNurbsSurface man page"),
-    glDelete("rpatch", "rpatch not supported, see gluNurbsSurface man page"),
-    glDelete("patchbasis", "patchbassis not supported, see gluNurbsSurface man page"),
-    glDelete("patchcurves", "patchcurves not supported, see gluNurbsSurface man page"),
-    glDelete("patchprecision", "patchprecision not supported, see gluNurbsSurface man page"),
-    glDelete("rcrv", "rcrv not supported -- see gluNurbsCurve man page"),
-    glDelete("rcrvn", "rcrvn not supported -- see gluNurbsCurve man page"),
-    glDelete("xfpt", "xfpt not supported -- see gluProject man page"),
-    glDelete("xfpti", "xfpti not supported -- see gluProject man page"),
-    glDelete("xfpts", "xfpts not supported -- see gluProject man page"),
-    glDelete("xfpt2", "xfpt2 not supported -- see gluProject man page"),
-    glDelete("xfpt2i", "xfpt2i not supported -- see gluProject man page"),
-    glDelete("xfpt2s", "xfpt2s not supported -- see gluProject man page"),
-    glDelete("xfpt4", "xfpt4 not supported -- see gluProject man page"),
-    glDelete("xfpt4i", "xfpt4i not supported -- see gluProject man page"),
-    glDelete("xfpt4s", "xfpt4s not supported -- see gluProject man page"),
-    glDelete("scrsubdivide", "scrsubdivide not needed."),
-    glDelete("Tag", "Object tags not supported"),
-    glDelete("Offset", "Object tags not supported"),
-    glDelete("Cursor", "Cursor -- use Window Manager"),
-    glDelete("Device", "Device -- use Window Manager"),
-};
+LineCache::entry *
+LineCache::find(const char *line, int len)
+{
+    unsigned h = hashof(line, len);
+    entry *e;
+    
+    if(table) {
+	for(e = table[h % NHASH]; e; e = e->chain) {
+	    if(e->hash == h && e->in.length() == len && memcmp(e->in, line, len) == 0) {
+		hits++;
+		unlist(e);
+		list(e);
+		return e;
+	    }
+	}
+    }
+    misses++;
+    return 0;
+}
 
+// an entry for line, to be filled in, in place of the oldest if need be
+LineCache::entry *
+LineCache::add(const char *line, int len)
+{
+    entry *e, **pp;
+    
+    if(!table) {
+	table = new entry *[NHASH];
+	for(int i = 0; i < NHASH; i++)
+	    table[i] = 0;
+    }
+    if(nslots < NSLOT) {
+	Arena *was = Arena::use(0);	// they outlast the line
+	e = slots[nslots++] = new entry;
+	Arena::use(was);
+    } else {
+	e = oldest;
+	unlist(e);
+	for(pp = &table[e->hash % NHASH]; *pp != e; pp = &(*pp)->chain)
+	    ;
+	*pp = e->chain;
+    }
+    e->hash = hashof(line, len);
+    e->in = "";
+    e->in.append(line, len);
+    e->chain = table[e->hash % NHASH];
+    table[e->hash % NHASH] = e;
+    list(e);
+    return e;
+}
 
-glArgs args[] = {
-    glArgs("c3f", "glColor3fv($1)"),
-    glArgs("c3s", "glColor3sv($1)", "color values need to be scaled"),  // XXX
-    glArgs("c3i", "glColor3iv($1)", "color values need to be scaled"),  // XXX
-    glArgs("c4f", "glColor4fv($1)"),
-    glArgs("c4s", "glColor4sv($1)", "color values need to be scaled"),  // XXX
-    glArgs("c4i", "glColor4iv($1)", "color values need to be scaled"),  // XXX
-    glArgs("v2f", "glVertex2fv($1)"), 
-    glArgs("v2s", "glVertex2sv($1)"), 
-    glArgs("v2i", "glVertex2iv($1)"), 
-    glArgs("v2d", "glVertex2dv($1)"), 
-    glArgs("v3f", "glVertex3fv($1)"), 
-    glArgs("v3s", "glVertex3sv($1)"), 
-    glArgs("v3i", "glVertex3iv($1)"), 
-    glArgs("v3d", "glVertex3dv($1)"), 
-    glArgs("v4f", "glVertex4fv($1)"), 
-    glArgs("v4s", "glVertex4sv($1)"), 
-    glArgs("v4i", "glVertex4iv($1)"), 
-    glArgs("v4d", "glVertex4dv($1)"), 
-    glArgs("n3f", "glNormal3fv($1)"), 
-    glArgs("t2f", "glTexCoord2fv($1)"), 
-    glArgs("t3f", "glTexCoord3fv($1)"), 
-    glArgs("t2s", "glTexCoord2sv($1)"), 
-    glArgs("t2i", "glTexCoord2iv($1)"), 
-    glArgs("t2d", "glTexCoord2dv($1)"), 
-    glArgs("translate", "glTranslatef($1, $2, $3)"), 
-    glArgs("loadmatrix", "glLoadMatrixf($1)"), 
-    glArgs("multmatrix", "glMultMatrixf($1)"), 
-    glArgs("RGBcolor", "glColor3ub($1, $2, $3)"), 
-    glArgs("normal", "glNormal3fv($1)"),
-    glArgs("blendfunction", "glBlendFunc($1, $2); if(($1) == GL_ONE && ($2) == GL_ZERO) glDisable(GL_BLEND) else glEnable(GL_BLEND)"),
-    glArgs("callobj", "glCallList($1)", "check list numbering"), 
-    glArgs("charstr", "glCallLists(strlen($1), GL_UNSIGNED_BYTE, $1)", "charstr: check list numbering"), // XXX what list definitions need to be done before this works?
-    glArgs("cmov", "glRasterPos3f($1, $2, $3)"),
-    glArgs("cmov2", "glRasterPos2f($1, $2)"),
-    glArgs("cmov2i", "glRasterPos2i($1, $2)"),
-    glArgs("cmov2s", "glRasterPos2s($1, $2)"),
-    glArgs("cmovi", "glRasterPos3i($1, $2, $3)"),
-    glArgs("cmovs", "glRasterPos3s($1, $2, $3)"),
-    glArgs("color", "glIndexi($1)"),
-    glArgs("colorf", "glIndexf($1)"),
-    glArgs("setshade", "glIndexi($1)"),
-    glArgs("font", "glListBase(int n)", "see glListBase info"),
-    glArgs("afunction", "glAlphaFunc($2, ($1)/255.); if(($2)==GL_ALWAYS) glDisable(GL_ALPHA_TEST) else glEnable(GL_ALPHA_TEST)"),
-    glArgs("acbuf", "glAccum($1, $2)"),	// XXX translate params?
-    glArgs("getdepth", "{GLint get_depth_tmp[2];glGetIntegerv(GL_DEPTH_RANGE, get_depth_tmp);*($1)=get_depth_tmp[0];*($2)=get_depth_tmp[1];}", "You can probably do better than this."),  
-    glArgs("smoothline", "if($1) glEnable(GL_LINE_SMOOTH); else glDisable(GL_LINE_SMOOTH)"),    // args to smoothline?  
-    glArgs("linesmooth", "if($1) glEnable(GL_LINE_SMOOTH); else glDisable(GL_LINE_SMOOTH)"),    // args to linesmooth?  
-    glArgs("polysmooth", "if($1) glEnable(GL_POLYGON_SMOOTH); else glDisable(GL_POLYGON_SMOOTH)"),
-    glArgs("arc", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2,  0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("arci", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("arcs", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("arcf", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("arcfi", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("arcfs", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslatef($1, $2, 0.); gluPartialDisk( qobj, 0., $3, 32, 1, ($4)*.1, (($5)-($4))*.1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluPartialDisk man page."),
-    glArgs("circ", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("circi", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("circs", "{ GLUquadricObj *qobj = gluNewQuadric(); gluQuadricDrawStyle(qobj, GLU_SILHOUETTE); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("circf", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("circfi", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("circfs", "{ GLUquadricObj *qobj = gluNewQuadric(); glPushMatrix(); glTranslate($1, $2, 0.); gluDisk( qobj, 0., $3, 32, 1); glPopMatrix(); gluDeleteQuadric(qobj); }", "See gluDisk man page."),
-    glArgs("callobj", "glCallList($1)", "check list numbering"),
-    glArgs("clipplane", "glClipPlane( GL_CLIP_PLANE0+($1), *equation); if($2) glEnable(GL_CLIP_PLANE+($1)); else glDisable(GL_CLIP_PLANE0+($1))", "see man page for glClipPlane equation"),
-    glArgs("cpack", "glColor4ubv(&($1))", "cpack: if argument is not a variable#might need to be:#\tglColor4b(($1)&0xff, ($1)>>8&0xff, ($1)>>16&0xff, ($1)>>24&0xff)"),
-    glArgs("crv", "glEvalCoord1f( u )", "replace u with domain coordinate"),
-    glArgs("crvn", "glEvalMesh1f(GL_LINE, 0, n-1 )", "replace n with domain coordinate index"),
-    glArgs("curvebasis", "glMap1();glMap2();glMapGrid()", "curvebasis: see man pages"),
-    glArgs("curveprecision", "glMap1();glMap2();glMapGrid()", "curveprecision:see man pages"),
-    glArgs("czclear", "glClearDepth($2);glClearColor(((float)(($1)&0xff))/255., (float)(($1)>>8&0xff)/255., (float)(($1)>>16&0xff)/255., (float)(($1)>>24&0xff)/255. );glClear(GL_DEPTH_BUFFER_BIT|GL_COLOR_BUFFER_BIT)", "change glClearDepth parameter to be in [0, 1]"),// pattern behavior?
-    glArgs("deflinestyle", "glNewList($1, GL_COMPILE);glLineStipple(factor, $2); glEndList()", "LineStipple:#\tget factor from lsrepeat()#\tYou don't really need to make a display list.#\tCheck list numbering."),
-    glArgs("setlinestyle", "if($1) {glCallList($1); glEnable(GL_LINE_STIPPLE);} else glDisable(GL_LINE_STIPPLE)", "setlinestyle: Check list numbering."),
-    glArgs("defpattern", "glNewList($1, GL_COMPILE); glPolygonStipple(MASK($3)); glEndList()", "glPolygonStipple:#\tSee man page to change $3 into mask.#\tYou don't really need to make a display list.#\tCheck list numbering."),
-    glArgs("defrasterfont", "glXUseXFont( font, first, count, listBase)", "glXUseFont: see man page"), 
-    glArgs("delobj", "glDeleteLists( $1, 1)", "glDeleteLists: check object numbers"), 
-    glArgs("dither", "if($1) glEnable(GL_DITHER); else glDisable(GL_DITHER)"), 
-    glArgs("drawmode", "glxChooseVisual(*display, screen, *attriblist)", "glxChooseVisual: add $1 to attriblist"), 
-    glArgs("acsize", "glxChooseVisual(*display, screen, *attriblist)", "glxChooseVisual: add GLX_ACCUM_RED_SIZE, $1, etc. to attriblist"), 
-    glArgs("endpick", "glRenderMode(GL_RENDER); glMatrixMode(GL_PROJECTION); glLoadIdentity(); gluPerspective( fovy, aspect, znear, zfar ); glMatrixMode(GL_MODELVIEW);", "endpick:#\treplace gluPerspective args#\tor use glPopMatrix() to restore."), 
-    glArgs("feedback", "glFeedbackBuffer($2, GL_3D_COLOR, $1); glRenderMode(GL_FEEDBACK);"), 
-    glArgs("fogvertex", "glFogfv($1, $2); if($1) glEnable(GL_FOG); else glDisable(GL_FOG)", "Fog: have to translate params."), 
-    glArgs("frontbuffer", "glDrawBuffer(($1) ? GL_FRONT : GL_BACK)", "frontbuffer: other possibilities include GL_FRONT_AND_BACK"),
-    glArgs("backbuffer", "glDrawBuffer(($1) ? GL_BACK : GL_FRONT)", "backbuffer: other possibilities include GL_FRONT_AND_BACK"),
-    glArgs("frontface", "glCullFace(($1) ? GL_FRONT : GL_BACK); ($1) ? glEnable(GL_CULL_FACE):glDisable(GL_CULL_FACE)"),
-    glArgs("backface", "glCullFace(!($1) ? GL_FRONT : GL_BACK); ($1) ? glEnable(GL_CULL_FACE):glDisable(GL_CULL_FACE)"),
-    glArgs("draw", "glVertex3f($1, $2, $3)", "Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("draw2", "glVertex2f($1, $2)","Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("draw2i", "glVertex2i($1, $2)","Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("draw2s", "glVertex2s($1, $2)","Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("drawi", "glVertex3i($1, $2, $3)","Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("draws", "glVertex3s($1, $2, $3)","Add glEnd() after these vertices,  before next glBegin()"), 
-    glArgs("move", "glBegin(GL_LINE_STRIP); glVertex3f($1, $2, $3)", "glBegin: Use GL_LINES if only one line segment is desired."), 
-    glArgs("move2", "glBegin(GL_LINE_STRIP); glVertex2f($1, $2)", "glBegin: Use GL_LINES if only one line segment is desired."),
-    glArgs("move2i", "glBegin(GL_LINE_STRIP); glVertex2i($1, $2)", "glBegin: Use GL_LINES if only one line segment is desired."),
-    glArgs("move2s", "glBegin(GL_LINE_STRIP); glVertex2s($1, $2)", "glBegin: Use GL_LINES if only one line segment is desired."),
-    glArgs("movei", "glBegin(GL_LINE_STRIP); glVertex3i($1, $2, $3)", "glBegin: Use GL_LINES if only one line segment is desired."),
-    glArgs("moves", "glBegin(GL_LINE_STRIP); glVertex3s($1, $2, $3)", "glBegin: Use GL_LINES if only one line segment is desired."),
-    glArgs("getdisplaymode", "(glGetIntegerv(GL_INDEX_MODE, &dmtmp), dmtmp)", "get display mode:#\tHow to tell if doublebuffered?#\tYou can do better than this.#GLint dmtmp;"),
-    glArgs("getdrawmode", "glxGetCurrentContext()", "see man page"),
-    glArgs("getgconfig", "(glGetIntegerv($1, &gctmp), gctmp)", "getgconfig:#GLint gctmp;"), 
-    glArgs("getgdesc", "(glGetIntegerv($1, &gdtmp), gdtmp)", "getgdesc other posiblilties:#\tglxGetConfig();#\tglxGetCurrentContext();#\tglxGetCurrentDrawable();#GLint gdtmp;"), 
-    glArgs("getmatrix", "glGetFloatv(GL_MODELVIEW_MATRIX, $1)", "getmatrix: you might mean#glGetFloatv(GL_PROJECTION_MATRIX, $1)"),
-    glArgs("getmmode", "(glGetIntegerv(GL_MATRIX_MODE, &gmtmp), gmtmp)", "getmmode: translate returned values#GLint mmtmp;"),
-    glArgs("getnurbsproperty", "gluGetNurbsProperty(GL_MATRIX_MODE, &tmp)", "see man page for gluGetNurbsProperty#move results from tmp."),
-    glArgs("getopenobj", "(glGetIntegerv(GL_LIST_INDEX, &tmp),  tmp)", "getopenobj: #int tmp;"),
-    glArgs("getpattern", "glGetPolygonStipple(mask)", "glGetPolygonStipple:#\tmask is a 32x32 array (See man page).#\tGLuByte *mask;"),
-    glArgs("getplanes", "(glGetIntegerv(GL_INDEX_BITS, &tmp),  tmp)", "getplanes:#int tmp;"),
-    glArgs("getscrmask", "{ GLint tmp[4]; glGetIntegerv(GL_SCISSOR_BOX, &tmp);*($1)=tmp[0];*($2)=tmp[0]+tmp[2]-1;*($3)=tmp[1];*($4)=tmp[1]+tmp[3]-1;}", "get GL_SCISSOR_BOX:#You can probably do better than this."),
-    glArgs("getsm", "(glGetIntegerv(GL_SHADE_MODEL, &tmp), tmp)", "getsm:#GLint tmp;"),
-    glArgs("getviewport", "{GLint tmp[4];glGetIntegerv(GL_VIEWPORT, &tmp);*($1)=tmp[0];*($2)=tmp[0]+tmp[2]-1;*($3)=tmp[1];*($4)=tmp[1]+tmp[3]-1;}", "get GL_VIEWPORT:#You can probably do better than this."),
-    glArgs("getwritemask", "(glGetIntegerv( (glGetIntegerv(GL_INDEX_MODE, &tmp), tmp) ? GL_INDEX_WRITEMASK : GL_COLOR_MASK, &tmp), tmp)", "getwritemask:#GLint tmp;"),
-    glArgs("getzbuffer", "glIsEnabled(GL_DEPTH_TEST)"),
-    glArgs("gflush", "glFlush()"),
-    glArgs("gRGBcolor", "{int tmp[4]; glGetIntegerv(GL_CURRENT_COLOR, tmp);*($1)=tmp[0];*($2)=tmp[1];*($3)=tmp[2];}", "get GL_CURRENT_COLOR: scale color values"), 
-    glArgs("gRGBmask", "{GLboolean tmp[4]; glGetBooleanv(GL_COLOR_WRITEMASK, tmp);*($1)=tmp[0];*($2)=tmp[1];*($3)=tmp[2];}"), 
-    glArgs("gselect", "glSelectBuffer($2, $1); glRenderMode(GL_SELECT)"),
-    glArgs("isobj", "glIsList($1)", "glIsList: check object numbering"), 
-    glArgs("lcharstr", "glCallLists(lstrlen($2), $1, $2)", "lcharstr: replace lstrlen with strlen(string) like function"), 
-    glArgs("linewidthf", "glLineWidth($1)"), 
-    glArgs("linewidth", "glLineWidth((GLfloat)($1))"),
-    glArgs("getlwidth", "(glGetIntegerv(GL_LINE_WIDTH, &tmp), tmp)", "line width:#Could also be:#float tmp;#glGetFloatv(GL_LINE_WIDTH, &tmp);"),
-    glArgs("lmcolor", "glColorMaterial(GL_FRONT_AND_BACK, $1);glEnable(GL_COLOR_MATERIAL)", "lmcolor: if LMC_NULL,  use:#glDisable(GL_COLOR_MATERIAL);"),
-    glArgs("loadmatrix", "glLoadMatrix($1)"),
-    glArgs("loadname", "glLoadName($1)"),
-    glArgs("logicop", "glLogicOp($1); if($1 == GL_COPY) glDisable(GL_LOGIC_OP); else glEnable(GL_LOGIC_OP)"),
-    glArgs("lookat", "gluLookat($1, $2, $3, $4, $5, $6, UPX($7), UPY($7), UPZ($7))", "lookat: replace UPx with vector"),
-    glArgs("lrectread", "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)", "lrectread: see man page for glReadPixels"),
-    glArgs("rectread", "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_COLOR_INDEX, GL_SHORT, $5)", "rectread: see man page for glReadPixels"),
-    glArgs("lrectwrite", "glRasterPos2i($1, $2);glDrawPixels(($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)", "lrectwrite: see man page for glDrawPixels"),
-    glArgs("rectwrite", "glRasterPos2i($1, $2);glDrawPixels(($3)-($1)+1, ($4)-($2)+1, GL_COLOR_INDEX, GL_SHORT, $5)", "rectwrite: see man page for glDrawPixels"),
-    glArgs("lsetdepth", "glDepthRange($1, $2)", "glDepthRange params must be scaled to [0, 1]"),
-    glArgs("setdepth", "glDepthRange($1, $2)", "glDepthRange params must be scaled to [0, 1]"),
-    glArgs("lsrepeat", "glLineStipple($1, pattern)", "lsrepeat: combine with pattern from deflinestyle"),
-    glArgs("getlsrepeat", "glGetIntegerv(GL_LINE_STIPPLE_REPEAT, &tmp)", "getlsrepeat: move tmp into your variable."),
-    glArgs("makeobj", "glNewList($1, GL_COMPILE)", "Check list numbering."),
-    glArgs("mapw", "gluProject(XXX)", "XXX I think this is backwards"),
-    glArgs("mapw2", "gluProject(XXX)", "XXX I think this is backwards"),
-    glArgs("mmode", "glMatrixMode($1)"),
-    glArgs("nmode", "if($1) glEnable(GL_NORMALIZE); else glDisable(GL_NORMALIZE)"),
-    glArgs("noport", "glxCreateGLXPixmap(*display, *visual, pixmap)", "noport: see man page"),
-    glArgs("nurbscurve", "gluNurbsCurve(*nobj, $1, $2, $3, $4, $5, $6)", "gluNurbsCurve: replace nobj with your object#See man page"),
-    glArgs("nurbssurface", "gluNurbsSurface(*nobj, $1, $2, $3, $4, $5, $6, $7, $8, $9, $a)", "gluNurbsCurve: replace nobj with your object#See man page"),
-    glArgs("objdelete", "glDeleteLists(LIST($1, $2), RANGE($1, $2))", "objdelete: tags not supported#See glDeleteLists man page."),
-    glArgs("ortho", "{GLint mm; glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();glOrtho($1, $2, $3, $4, $5, $6);glMatrixMode(mm);}"),
-    glArgs("ortho2", "{GLint mm; glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();gluOrtho2D($1, $2, $3, $4);glMatrixMode(mm);}"),
-    glArgs("overlay",  "glxChooseVisual(*dpy, screen, *attriblist)", "overlay: use GLX_BUFFER_SIZE $1, GLX_LEVEL 1 in attriblist"), 
-    glArgs("underlay",  "glxChooseVisual(*dpy, screen, *attriblist)", "underlay: use GLX_BUFFER_SIZE $1, GLX_LEVEL -1 in attriblist"), 
-    glArgs("passthrough", "glPassThrough($1)"),
-    glArgs("pdr", "glVertex3f($1, $2, $3)"),
-    glArgs("pdri", "glVertex3i($1, $2, $3)"),
-    glArgs("pdrs", "glVertex3s($1, $2, $3)"),
-    glArgs("pdr2", "glVertex2f($1, $2)"),
-    glArgs("pdr2i", "glVertex2i($1, $2)"),
-    glArgs("pdr2s", "glVertex2s($1, $2)"),
-    glArgs("pmv", "glBegin(GL_POLYGON);glVertex3f($1, $2, $3)"),
-    glArgs("pmvi", "glBegin(GL_POLYGON);glVertex3i($1, $2, $3)"),
-    glArgs("pmvs", "glBegin(GL_POLYGON);glVertex3s($1, $2, $3)"),
-    glArgs("pmv2", "glBegin(GL_POLYGON);glVertex2f($1, $2)"),
-    glArgs("pmv2i", "glBegin(GL_POLYGON);glVertex2i($1, $2)"),
-    glArgs("pmv2s", "glBegin(GL_POLYGON);glVertex2s($1, $2)"),
-    glArgs("perspective", "{GLint mm;glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();gluPerspective(.1*($1), $2, $3, $4);glMatrixMode(mm);}"),
-    glArgs("pick", "glSelectBuffer($2, $1);glRenderMode(GL_SELECT);glMatrixMode(GL_PROJECTION);gluPickMatrix(x, y, w, h, viewport);glMatrixMode(GL_MODELVIEW)", "pick:#\tSelect buffer is type GLuint.#\tSet gluPickMatrix params.#See man pages.#\tMight want to push Projection matrix if you have endpick pop it."),
-    glArgs("picksize", "gluPickMatrix(x, y, $1, $2, viewport)", "picksize: merge this with other gluPickMatrix call due to pick()"),
-    glArgs("pixmode", "glPixelTransfer($1, $2)", "pixmode: see glPixelTransfer man page#Translate parameters."),
-    glArgs("pixmodef", "glPixelTransfer($1, $2)", "pixmodef: see glPixelTransfer man page#Translate parameters."),
-    glArgs("pnt", "glBegin(GL_POINTS);glVertex3f($1, $2, $3);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pnti", "glBegin(GL_POINTS);glVertex3i($1, $2, $3);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pnts", "glBegin(GL_POINTS);glVertex3s($1, $2, $3);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pnt2", "glBegin(GL_POINTS);glVertex2f($1, $2);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pnt2i", "glBegin(GL_POINTS);glVertex2i($1, $2);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pnt2s", "glBegin(GL_POINTS);glVertex2s($1, $2);glEnd()", "points: put as many vertices as possible between Begin and End"), 
-    glArgs("pntsize", "glPointSize((GLfloat)($1))"),
-    glArgs("pntsizef", "glPointSize((GLfloat)($1))"),
-    glArgs("pntsmooth", "{if($1) glEnable(GL_POINT_SMOOTH) else glDisable(GL_POINT_SMOOTH);}"),
-    glArgs("polf", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}"),
-    glArgs("polfi", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}"),
-    glArgs("polfs", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}"),
-    glArgs("polf2", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}"),
-    glArgs("polf2i", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}"),
-    glArgs("polf2s", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}"),
-    glArgs("poly", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}"),
-    glArgs("polyi", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}"),
-    glArgs("polys", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}"),
-    glArgs("poly2", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}"),
-    glArgs("poly2i", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}"),
-    glArgs("poly2s", "{int i; glBegin(GL_LINE_LOOP); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}"),
-    glArgs("polymode", "glPolygonMode(GL_FRONT_AND_BACK, $1)"),
-    glArgs("polymooth", "{if($1) glEnable(GL_POLYGON_SMOOTH) else glDisable(GL_POLYGON_SMOOTH);}"),
-    glArgs("pushname", "glPushName($1)"),
-    glArgs("pwlcurve", "gluPwlCurve(*nobj, $1, $2, $3, $4)", "gluPwlCurve: replace nobj with your object#See man page"),
-    glArgs("rdr", "glVertex3f($1, $2, $3)", "Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("rdr2", "glVertex2f($1, $2)","Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("rdr2i", "glVertex2i($1, $2)","Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("rdr2s", "glVertex2s($1, $2)","Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("rdri", "glVertex3i($1, $2, $3)","Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("rdrs", "glVertex3s($1, $2, $3)","Add glEnd() after these vertices,  before next glBegin().#Relative drawing not supported -- change"), 
-    glArgs("readdisplay", "glReadPixels($1, $2, ($3)-($1)+1, ($4)-($2)+1, GL_RGBA, GL_BYTE, $5)", "readdisplay: see man page for glReadPixels"),
-    glArgs("readRGB", "{ int tmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POS, tmp);glReadPixels(tmp[0], tmp[1], $1, 1,  GL_RGBA, GL_BYTE, array);}", "readRGB: see man page for glReadPixels"),
-    glArgs("readpixels", "{ GLint tmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POS, tmp);glReadPixels(tmp[0], tmp[1], $1, 1,  GL_INDEX, GL_SHORT, $2);}", "readpixels: see man page for glReadPixels"),
-    glArgs("readsource", "glReadBuffer($1)"),
-    glArgs("rect", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRectf($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "rect: remove extra PolygonMode changes"),
-    glArgs("recti", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRecti($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "rect: remove extra PolygonMode changes"),
-    glArgs("rects", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRects($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "rect: remove extra PolygonMode changes"),
-    glArgs("rectf", "glRectf($1, $2, $3, $4)"),
-    glArgs("rectfi", "glRecti($1, $2, $3, $4)"),
-    glArgs("rectfs", "glRects($1, $2, $3, $4)"),
-    glArgs("sbox", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRect($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "sbox: remove extra PolygonMode changes.#not screen-aligned -- See glRect"),
-    glArgs("sboxi", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRecti($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "sboxi: remove extra PolygonMode changes.#not screen-aligned -- See glRect"),
-    glArgs("sboxs", "glPolygonMode(GL_FRONT_AND_BACK, GL_LINE); glRects($1, $2, $3, $4); glPolygonMode(GL_FRONT_AND_BACK, GL_FILL)", "sboxs: remove extra PolygonMode changes.#not screen-aligned -- See glRect"),
-    glArgs("sboxf", "glRect($1, $2, $3, $4)", "sboxf not screen-aligned -- See glRect"),
-    glArgs("sboxfi", "glRecti($1, $2, $3, $4)", "sboxfi not screen-aligned -- See glRect"),
-    glArgs("sboxfs", "glRects($1, $2, $3, $4)", "sboxfs not screen-aligned -- See glRect"),
-    glArgs("rectcopy", "glRasterPos2i($5, $6);glCopyPixels($1, $2, $3-$1+1, $4-$2+1, GL_COLOR)"),
-    glArgs("rectzoom", "glPixelZoom($1, $2)"),
-    glArgs("RGBwritemask", "glColorMask($1, $2, $3, GL_TRUE)", "glColorMask: only Boolean values allowed"),
-    glArgs("rmv", "glBegin(GL_LINES); glVertex3f($1, $2, $3)", "Relative drawing not supported -- change"), 
-    glArgs("rmv2", "glBegin(GL_LINES); glVertex2f($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rmv2i", "glBegin(GL_LINES); glVertex2i($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rmv2s", "glBegin(GL_LINES); glVertex2s($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rmvi", "glBegin(GL_LINES); glVertex3i($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rmvs", "glBegin(GL_LINES); glVertex3s($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rot", "glRotatef($1, ($2)=='x'||($2)=='X', ($2)=='y'||($2)=='Y', ($2)=='z'||($2)=='Z')", "You can do better than this."),
-    glArgs("rotate", "glRotatef(.1*($1), ($2)=='x'||($2)=='X', ($2)=='y'||($2)=='Y', ($2)=='z'||($2)=='Z')", "You can do better than this."),
-    glArgs("rpdr", "glVertex3f($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpdri", "glVertex3i($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpdrs", "glVertex3s($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpdr2", "glVertex2f($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rpdr2i", "glVertex2i($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rpdr2s", "glVertex2s($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rpmv", "glBegin(GL_POLYGON);glVertex3f($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpmvi", "glBegin(GL_POLYGON);glVertex3i($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpmvs", "glBegin(GL_POLYGON);glVertex3s($1, $2, $3)", "Relative drawing not supported -- change"),
-    glArgs("rpmv2", "glBegin(GL_POLYGON);glVertex2f($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rpmv2i", "glBegin(GL_POLYGON);glVertex2i($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("rpmv2s", "glBegin(GL_POLYGON);glVertex2s($1, $2)", "Relative drawing not supported -- change"),
-    glArgs("scale", "glScalef($1, $2, $3)"),
-    glArgs("sclear", "glClearStencil($1);glClear(GL_STENCIL_BUFFER_BIT)"),
-    glArgs("scrmask", "glScissor($1, $2, $3, $4); glEnable(GL_SCISSOR_TEST)"),
-    glArgs("setnurbsproperty", "gluNurbsProperty(*nobj, $1, $2)", "Replace nobj with your object -- see man page"),
-    glArgs("setpattern", "if($1) {glCallList($1); glEnable(GL_POLYGON_STIPPLE);} else glDisable(GL_POLYGON_STIPPLE)", "pattern: check list numbering.#See substitutions made for defpattern.#see glPolygonStipple man page."),     
-    glArgs("shademodel", "glShadeModel($1)"),
-    glArgs("splf", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3f(($2)[i]); glEnd();}"),
-    glArgs("splfi", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3i(($2)[i]); glEnd();}"),
-    glArgs("splfs", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex3s(($2)[i]); glEnd();}"),
-    glArgs("splf2", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2f(($2)[i]); glEnd();}"),
-    glArgs("splf2i", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2i(($2)[i]); glEnd();}"),
-    glArgs("splf2s", "{int i; glBegin(GL_POLYGON); for(i = 0; i < $1; i++) glVertex2s(($2)[i]); glEnd();}"),
-    glArgs("stencil", "if($1) { glEnable(GL_STENCIL_TEST);glStencilFunc($3, $2, $4); glStencilOp($5, $6, $7);} else glDisable(GL_STENCIL_TEST);"),
-    glArgs("stensize", "glStencilMask(0xff>>(8-($1)))"),
-    glArgs("swritemask", "glStencilMask($1)"),
-    glArgs("viewport", "glViewport($1, $3, ($2)-($1)+1, ($4)-($3)+1); glScissor($1, $3, ($2)-($1)+1, ($4)-($3)+1)"),
-    glArgs("window", "{GLint mm;glGetIntegerv(GL_MATRIX_MODE, &mm);glMatrixMode(GL_PROJECTION);glLoadIdentity();glFrustum($1, $2, $3, $4, $5, $6);glMatrixMode(mm);}"),
-    glArgs("wmpack", "glColorMask(($1)&0xff, (($1)>>8)&0xff, (($1)>>16)&0xff, (($1)>>24)&0xff)"),
-    glArgs("writemask", "glIndexMask($1)"),
-    glArgs("writepixels", "glDrawPixels($1, 1, GL_COLOR_INDEX, GL_SHORT, $2)", "writepixels: see man page for glDrawPixels"),
-    glArgs("writeRGB", "glDrawPixels($1, 1, GL_RGBA, GL_BYTE, PACK($2, $3, $4))", "writeRGB: see man page for glDrawPixels#\tYouhave to pack the arrays into RGBA"),
-    glArgs("zbuffer", "if($1) glEnable(GL_DEPTH_TEST); else glDisable(GL_DEPTH_TEST)"),
-    glArgs("zfunction", "glDepthFunc($1)"),
-    glArgs("zwritemask", "glDepthMask((GLBoolean)($1))",  "glDepthMask is boolean only"),
-    glArgs("getbackface", "(glIsEnabled(GL_CULL_FACE) && (glGetIntegerv(GL_CULL_FACE_MODE, &tmp), (tmp == GL_BACK)))", "You can probably do better than this.#long tmp;"),  
-    glArgs("getbuffer", "(glGetIntegerv(GL_DRAW_BUFFERS, &tmp),  tmp)", "getbuffer: translate results.#long tmp;"),  
-    glArgs("getcmmode", "(glGetBooleanv(GL_INDEX_MODE, &tmp), tmp)", "getcmmode: multimap mode not supported.#long tmp;"),  
-    glArgs("getcpos", "{ GLint cpostmp[4]; glGetIntegerv(GL_CURRENT_RASTER_POSITION, cpostmp); *($1) = cpostmp[0]; *($2) = cpostmp[1];}", "getcpos: You can probably do better than this."),  
-    glArgs("texgen", "glTexGenfv($1, $2, $3)", "texgen: translate parameters."),
-    glArgs("tevdef", "glNewList($1); glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, MODES($3)); glEndList()", "glTexEnvfv:#\tSee man page.#\tTranslate parameters.#\tCheck list numbering."),
-    glArgs("texdef2d", "glNewList($1); glTexImage2D(GL_TEXTURE_2D, 0, $2, $3, $4, border, GL_RGBA, GL_UNSIGNED_BYTE, $5); glEndList()", "glTexImage2D:#\tSee man page.#\tIf MipMaps desired, use gluBuild2DMIPmaps().#\tTranslate parameters.#\tSee glTexParameterf().#\tCheck list numbering."),
-    glArgs("texbind", "if($2) {glCallList($2); glEnable(GL_TEXTURE_2D);} else glDisable(GL_TEXTURE_2D)", "texbind: check list numbering"),
-    glArgs("tevbind", "if($2) {glCallList($2); glEnable(GL_TEXTURE_2D);} else glDisable(GL_TEXTURE_2D)", "tevbind: check list numbering"),
-    glArgs("polarview", "glTranslatef(0., 0., -($1)); glRotatef( -($4)*10., 0., 0., 1.); glRotatef( -($3)*10., 1., 0., 0.); glRotatef( -($2)*10., 0., 0., 1);"),
-};
+Translation::Translation(const char *f)
+{
+    nominees = new unsigned long[(nrules + NOMINEE_BITS - 1) / NOMINEE_BITS];
+    nnominees = 0;
+    nominate_after = 0;
+    name_stamp = new int[names.patterns()];
+    call_stamp = new int[names.patterns()];
+    for(int i = 0; i < names.patterns(); i++)
+	name_stamp[i] = call_stamp[i] = 0;
+    stamp = 0;
+    searched = wide_lines = named_lines = 0;
+    named_rules = called_rules = matched_rules = 0;
+#ifdef PROFILE
+    for(int i = 0; i < nstages; i++)
+	stage_ns[i] = 0;
+    profiled_lines = profiled_bytes = 0;
+#endif
+    rule_counts = 0;
+    if(rule_report) {
+	rule_counts = new RuleCounts[nrules];
+	memset(rule_counts, 0, nrules * sizeof rule_counts[0]);
+    }
+    map_base = 0;
+    map_next = map_end = 0;
+    reset(f);
+}
+
+long Translation::all_searched, Translation::all_wide_lines, Translation::all_named_lines;
+long Translation::all_named_rules, Translation::all_called_rules, Translation::all_matched_rules;
+RuleCounts *Translation::all_rule_counts;
+#ifdef PROFILE
+long long Translation::all_stage_ns[nstages];
+long Translation::all_profiled_lines, Translation::all_profiled_bytes;
+#endif
+static std::mutex search_lock;	// for Translation::all_searched and the rest
+
+Translation::~Translation()
+{
+    {
+	std::lock_guard<std::mutex> g(search_lock);
+	all_searched += searched;
+	all_wide_lines += wide_lines;
+	all_named_lines += named_lines;
+	all_named_rules += named_rules;
+	all_called_rules += called_rules;
+	all_matched_rules += matched_rules;
+#ifdef PROFILE
+	for(int i = 0; i < nstages; i++)
+	    all_stage_ns[i] += stage_ns[i];
+	all_profiled_lines += profiled_lines;
+	all_profiled_bytes += profiled_bytes;
+#endif
+	if(rule_counts) {
+	    if(!all_rule_counts) {
+		all_rule_counts = new RuleCounts[nrules];
+		memset(all_rule_counts, 0, nrules * sizeof all_rule_counts[0]);
+	    }
+	    for(int i = 0; i < nrules; i++) {
+		RuleCounts &a = all_rule_counts[i], &c = rule_counts[i];
+		a.nominated += c.nominated;
+		a.tried += c.tried;
+		a.regexecs += c.regexecs;
+		a.matches += c.matches;
+		a.match_ns += c.match_ns;
+		a.replace_ns += c.replace_ns;
+	    }
+	}
+    }
+    delete [] rule_counts;
+    delete [] nominees;
+    delete [] name_stamp;
+    delete [] call_stamp;
+}
+
+// ready to start on another file
+void
+Translation::reset(const char *f)
+{
+    filename = f;
+    in = &std::cin;
+    out = &std::cout;
+    err = &std::cerr;
+    lineno = 0;
+    errors = 0;
+    for(int i = 0; i < MAXPATTERN; i++)
+	possible_hits[i] = replacements[i] = 0;
+    comments.reset();
+    calls.reset();
+    line = "";
+    linelen = 0;
+    in_ostr = 0;
+}
+
+// true if s[i] on, up to s[n], is a '(', maybe after blanks
+static inline int
+call_follows(const char *s, int n, int i)
+{
+    while(i < n && (s[i] == ' ' || s[i] == '\t'))
+	i++;
+    return i < n && s[i] == '(';
+}
 
+/*
+ * MultiSearch found a name at offset in the line.  Rules for functions
+ * are only nominated if it's called there, as their regexps have it
+ * followed by a '('; a #define's regexp matches any use of its name.
+ */
+static void
+nominate(int id, int offset, void *arg)
+{
+    Translation &t = *(Translation *)arg;
+    int i, first, call;
+    
+    first = t.name_stamp[id] != t.stamp;
+    call = call_follows(t.scanning, t.scanlen, offset + names.length(id));
+    if(!first && (!call || t.call_stamp[id] == t.stamp))
+	return;
+    t.name_stamp[id] = t.stamp;
+    if(call)
+	t.call_stamp[id] = t.stamp;
+    for(i = by_name[id]; i >= 0; i = rules[i].same) {
+	if(i < t.nominate_after || !group_on[rules[i].group])
+	    continue;
+	if(first && !t.nominate_after)
+	    t.named_rules++;
+	if(!call && rules[i].kind != Rule::define)
+	    continue;
+	unsigned long &w = t.nominees[i / NOMINEE_BITS];
+	if(!(w & 1ul << i % NOMINEE_BITS)) {
+	    w |= 1ul << i % NOMINEE_BITS;
+	    t.nnominees++;
+	}
+    }
+}
 
-glDefine defines[] = {
-    glDefine("SRC_AUTO", "GL_BACK", "SRC_AUTO not really supported -- see glReadBuffer man page"), 
-    glDefine("SRC_BACK", "GL_BACK"), 
-    glDefine("SRC_FRONT", "GL_FRONT"), 
-    glDefine("SRC_ZBUFFER", "XXX", "SRC_ZBUFFER: use GL_DEPTH_COMPONENT in glReadPixels call"), 
-    glDefine("SRC_PUP", "GL_AUX0", "XXX which aux buffer is pup planes?"), 
-    glDefine("SRC_OVER", "GL_AUX1", "XXX which aux buffer is overlay planes?"), 
-    glDefine("SRC_UNDER", "GL_AUX2", "XXX which aux buffer is underlay planes?"), 
-    glDefine("SRC_FRAMEGRABBER", "XXX", "SRC_FRAMEGRABBER not supported"), 
-    glDefine("BF_ZERO", "GL_ZERO"), 
-    glDefine("BF_ONE", "GL_ONE"), 
-    glDefine("BF_DC", "GL_DST_COLOR"), 
-    glDefine("BF_SC", "GL_SRC_COLOR"), 
-    glDefine("BF_MDC", "GL_ONE_MINUS_DST_COLOR"), 
-    glDefine("BF_MSC", "GL_ONE_MINUS_SRC_COLOR"), 
-    glDefine("BF_SA", "GL_SRC_ALPHA"), 
-    glDefine("BF_MSA", "GL_ONE_MINUS_SRC_ALPHA"), 
-    glDefine("BF_DA", "GL_DST_ALPHA"), 
-    glDefine("BF_MDA", "GL_ONE_MINUS_DST_ALPHA"), 
-    glDefine("BF_MIN_SA_MDA", "GL_SRC_ALPHA_SATURATE"), 
-    glDefine("AF_NEVER", "GL_NEVER"), 
-    glDefine("AF_LESS", "GL_LESS"), 
-    glDefine("AF_EQUAL", "GL_EQUAL"), 
-    glDefine("AF_LEQUAL", "GL_LEQUAL"), 
-    glDefine("AF_GREATER", "GL_GREATER"), 
-    glDefine("AF_NOTEQUAL", "GL_NOTEQUAL"), 
-    glDefine("AF_GEQUAL", "GL_GEQUAL"), 
-    glDefine("AF_ALWAYS", "GL_ALWAYS"), 
-    glDefine("ZF_NEVER", "GL_NEVER"), 
-    glDefine("ZF_LESS", "GL_LESS"), 
-    glDefine("ZF_EQUAL", "GL_EQUAL"), 
-    glDefine("ZF_LEQUAL", "GL_LEQUAL"), 
-    glDefine("ZF_GREATER", "GL_GREATER"), 
-    glDefine("ZF_NOTEQUAL", "GL_NOTEQUAL"), 
-    glDefine("ZF_GEQUAL", "GL_GEQUAL"), 
-    glDefine("ZF_ALWAYS", "GL_ALWAYS"), 
-    glDefine("SMP_OFF", "0"), 
-    glDefine("SMP_ON", "1"), 
-    glDefine("SMP_SMOOTHER", "1"), 
-    glDefine("SML_OFF", "0"), 
-    glDefine("SML_ON", "1"), 
-    glDefine("SML_SMOOTHER", "1"), 
-    glDefine("SML_END_CORRECT", "1"), 
-    glDefine("PYSM_OFF", "0"), 
-    glDefine("PYSM_ON", "1"), 
-    glDefine("PYSM_SHRINK", "1", "PYSM_SHRINK not really supported -- see glEnable man page"), 
-    glDefine("DT_OFF", "0"), 
-    glDefine("DT_ON", "1"), 
-    glDefine("FLAT", "GL_FLAT"), 
-    glDefine("GOURAUD", "GL_SMOOTH"), 
-    glDefine("LO_ZERO", "GL_CLEAR"),
-    glDefine("LO_AND", "GL_AND"),
-    glDefine("LO_ANDR", "GL_AND_REVERSE"),
-    glDefine("LO_SRC", "GL_COPY"),
-    glDefine("LO_ANDI", "GL_AND_INVERTED"),
-    glDefine("LO_DST", "GL_NOOP"),
-    glDefine("LO_XOR", "GL_XOR"),
-    glDefine("LO_OR", "GL_OR"),
-    glDefine("LO_NOR", "GL_NOR"),
-    glDefine("LO_XNOR", "GL_EQUIV"),
-    glDefine("LO_NDST", "GL_INVERT"),
-    glDefine("LO_ORR", "GL_OR_REVERSE"),
-    glDefine("LO_NSRC", "GL_COPY_INVERTED"),
-    glDefine("LO_ORI", "GL_OR_INVERTED"),
-    glDefine("LO_NAND", "GL_NAND"),
-    glDefine("LO_ONE", "GL_SET"),
-    glDefine("ST_KEEP", "GL_KEEP"),
-    glDefine("ST_ZERO", "GL_ZERO"),
-    glDefine("ST_REPLACE", "GL_REPLACE"),
-    glDefine("ST_INCR", "GL_INCR"),
-    glDefine("ST_DECR", "GL_DECR"),
-    glDefine("ST_INVERT", "GL_INVERT"),
-    glDefine("SF_NEVER", "GL_NEVER"),
-    glDefine("SF_LESS", "GL_LESS"),
-    glDefine("SF_EQUAL", "GL_EQUAL"),
-    glDefine("SF_LEQUAL", "GL_LEQUAL"),
-    glDefine("SF_GREATER", "GL_GREATER"),
-    glDefine("SF_NOTEQUAL", "GL_NOTEQUAL"),
-    glDefine("SF_GEQUAL", "GL_GEQUAL"),
-    glDefine("SF_ALWAYS", "GL_ALWAYS"),
-    glDefine("PYM_FILL", "GL_FILL"),
-    glDefine("PYM_POINT", "GL_POINT"),
-    glDefine("PYM_LINE", "GL_LINE"),
-    glDefine("PYM_HOLLOW", "GL_LINE", "polymode PYM_HOLLOW not supported"),
-    glDefine("PYM_LINE_FAST", "GL_LINE"),
-    glDefine("FG_OFF", "0"),
-    glDefine("FG_ON", "1"),
-    glDefine("FG_DEFINE", "XXX fg_define", "see glFogf man page"),
-    glDefine("FG_VTX_EXP", "GL_FOG_EXP", "see glFogf man page"),
-    glDefine("FG_VTX_LIN", "GL_LINEAR", "see glFogf man page"),
-    glDefine("FG_PIX_EXP", "GL_EXP", "see glFogf man page"),
-    glDefine("FG_PIX_LIN", "GL_LINEAR", "see glFogf man page"),
-    glDefine("FG_VTX_EXP2", "GL_EXP2", "see glFogf man page"),
-    glDefine("FG_PIX_EXP2", "GL_EXP2", "see glFogf man page"),
-    glDefine("PM_SHIFT", "XXX_SHIFT", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_EXPAND", "XXX_EXPAND", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_C0", "XXX_C0", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_C1", "XXX_C1", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_ADD24", "XXX_ADD24", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_SIZE", "XXX_SIZE", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_OFFSET", "XXX_OFFSET", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_STRIDE", "XXX_STRIDE", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_TTOB", "XXX_TTOB", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_RTOL", "XXX_RTOL", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_ZDATA", "XXX_ZDATA", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_WARP", "XXX_WARP", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_RDX", "XXX_RDX", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_RDY", "XXX_RDY", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_CDX", "XXX_CDX", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_CDY", "XXX_CDY", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_XSTART", "XXX_XSTART", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_YSTART", "XXX_YSTART", "pixmode: see glPixelTransfer man page"),
-    glDefine("PM_VO1", "XXX_VO1", "pixmode: see glPixelTransfer man page"),
-    glDefine("NAUTO", "0"),
-    glDefine("NNORMALIZE", "1"),
-    glDefine("AC_CLEAR", "XXX_CLEAR",  "see glAccum man page for how to clear:#glClearAccum(r, g, b, a);#glClear(GL_ACCUM_BUFFER_BIT);"),
-    glDefine("AC_ACCUMULATE", "GL_ACCUM"),
-    glDefine("AC_CLEAR_ACCUMULATE", "GL_LOAD"),
-    glDefine("AC_RETURN", "GL_RETURN"),
-    glDefine("AC_MULT", "GL_MULT"),
-    glDefine("AC_ADD", "GL_ADD"),
-    glDefine("CP_OFF", "0"),
-    glDefine("CP_ON", "1"),
-    glDefine("CP_DEFINE", "2"),
-    glDefine("GD_XPMAX", "XXX_XPMAX", "see window manager"),
-    glDefine("GD_YPMAX", "XXX_YPMAX", "see window manager"),
-    glDefine("GD_XMMAX", "XXX_XMMAX", "see window manager"),
-    glDefine("GD_YMMAX", "XXX_YMMAX", "see window manager"),
-    glDefine("GD_ZMIN", "XXX_ZMIN", "ZMIN not needed -- always 0."),
-    glDefine("GD_ZMAX", "XXX_ZMAX", "ZMAX not needed -- always 1."),
-    glDefine("GD_BITS_NORM_SNG_RED", "GL_RED_BITS"),
-    glDefine("GD_BITS_NORM_SNG_GREEN", "GL_GREEN_BITS"),
-    glDefine("GD_BITS_NORM_SNG_BLUE", "GL_BLUE_BITS"),
-    glDefine("GD_BITS_NORM_DBL_RED", "GL_RED_BITS"),
-    glDefine("GD_BITS_NORM_DBL_GREEN", "GL_GREEN_BITS"),
-    glDefine("GD_BITS_NORM_DBL_BLUE", "GL_BLUE_BITS"),
-    glDefine("GD_BITS_NORM_SNG_CMODE", "GL_INDEX_BITS"),
-    glDefine("GD_BITS_NORM_DBL_CMODE", "GL_INDEX_BITS"),
-    glDefine("GD_BITS_NORM_SNG_MMAP", "GL_INDEX_BITS", "multi-map not supported"),
-    glDefine("GD_BITS_NORM_DBL_MMAP", "GL_INDEX_BITS", "multi-map not supported"),
-    glDefine("GD_BITS_NORM_ZBUFFER", "GL_DEPTH_BITS"),
-    glDefine("GD_BITS_OVER_SNG_CMODE", "XXX_BITS_OVER_SNG_CMODE", "XXX what to do?"),
-    glDefine("GD_BITS_UNDR_SNG_CMODE", "XXX_BITS_UNDR_SNG_CMODE", "XXX what to do?"),
-    glDefine("GD_BITS_PUP_SNG_CMODE", "XXX_BITS_PUP_SNG_CMODE", "XXX what to do?"),
-    glDefine("GD_BITS_NORM_SNG_ALPHA", "GL_ALPHA_BITS"),
-    glDefine("GD_BITS_NORM_DBL_ALPHA", "GL_ALPHA_BITS"),
-    glDefine("GD_BITS_CURSOR", "XXX_BITS_CURSOR", "cursor bits not supported"),
-    glDefine("GD_OVERUNDER_SHARED", "XXX_OVERUNDER_SHARED", "overunder_shared: not supported"),
-    glDefine("GD_BLEND", "GL_BLEND", "blending is ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_CIFRACT", "XXX_CIFRACT", "CIFRACT irrelevant"),
-    glDefine("GD_CROSSHAIR_CINDEX", "XXX_CROSSHAIR_CINDEX", "cursors not supported -- see window manager"),
-    glDefine("GD_DITHER", "GL_DITHER", "dither ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_LINESMOOTH_CMODE", "GL_LINE_SMOOTH", "smooth lines ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_LINESMOOTH_RGB", "GL_LINE_SMOOTH", "smooth lines ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_LOGICOP", "GL_LOGICOP", "logic ops ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_NSCRNS", "XXX_NSCRNS", "nscrns not supported -- see window manager"),
-    glDefine("GD_NURBS_ORDER", "GL_MAX_EVAL_ORDER"),
-    glDefine("GD_NBLINKS", "XXX_NBLINKS", "blink not supported -- see window manager"),
-    glDefine("GD_NVERTEX_POLY", "XXX_NVERTEX_POLY", "There is NO limit to the number of vertices in a polygon."),
-    glDefine("GD_PATSIZE_64", "XXX_PATSIZE_64", "all patterns are the same size"),
-    glDefine("GD_PNTSMOOTH_CMODE", "GL_POINT_SMOOTH", "Smooth points ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_PNTSMOOTH_RGB", "GL_POINT_SMOOTH", "Smooth points ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_PUP_TO_OVERUNDER", "XXX_PUP_TO_OVERUNDER", "pup_to_overunder: not supported"),
-    glDefine("GD_READSOURCE", "GL_READ_BUFFER", "read buffer ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_READSOURCE_ZBUFFER", "GL_READ_BUFFER", "read buffer ALWAYS supported.#This function returns whether it is enabled."),
-    glDefine("GD_STEREO", "GL_STEREO"),
-    glDefine("GD_SUBPIXEL_LINE", "XXX_SUBPIXEL_LINE", "subpixel ALWAYS supported"),
-    glDefine("GD_SUBPIXEL_PNT", "GL_SUBPIXEL_PNT", "subpixel ALWAYS supported"),
-    glDefine("GD_SUBPIXEL_POLY", "GL_SUBPIXEL_POLY", "subpixel ALWAYS supported"),
-    glDefine("GD_TRIMCURVE_ORDER", "GL_MAX_EVAL_ORDER", "XXX see glu man pages"),
-    glDefine("GD_WSYS", "XXX_WSYS",  "see window manager"),
-    glDefine("GD_ZDRAW_GEOM", "XXX_ZDRAW_GEOM", "zdraw not supported"),
-    glDefine("GD_ZDRAW_PIXELS", "XXX_ZDRAW_PIXELS", "zdraw not supported"),
-    glDefine("GD_SCRNTYPE", "XXX_SCRNTYPE", "see window manager"),
-    glDefine("GD_TEXTPORT", "XXX_TEXTPORT", "see window manager"),
-    glDefine("GD_NMMAPS", "XXX_NMMAPS", "multimap not supported -- see window manager"),
-    glDefine("GD_FRAMEGRABBER", "XXX_FRAMEGRABBER", "framegrabber not supported"),
-    glDefine("GD_TIMERHZ", "XXX_TIMERHZ", "timers not supported -- use event functions."),
-    glDefine("GD_DBBOX", "XXX_DBBOX", "devices not supported -- use event functions."),
-    glDefine("GD_AFUNCTION", "GL_ALPHA_TEST", "alpha test ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_ALPHA_OVERUNDER", "XXX_ALPHA_OVERUNDER", "alpha_overunder: not supported"),
-    glDefine("GD_BITS_ACBUF", "GL_ACCUM_RED_BITS", "see glAccum man page."),
-    glDefine("GD_BITS_ACBUF_HW", "GL_ACCUM_RED_BITS", "see glAccum man page."),
-    glDefine("GD_BITS_STENCIL", "GL_STENCIL_BITS"),
-    glDefine("GD_CLIPPLANES", "GL_MAX_CLIP_PLANES"),
-    glDefine("GD_FOGVERTEX", "GL_FOG", "Fog ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_LIGHTING_TWOSIDE", "XXX_LIGHTING_TWOSIDE", "Twosided lighting ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_POLYMODE", "GL_POLYGON_MODE", "polygon mode ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_POLYSMOOTH", "GL_POLYGON_SMOOTH", "Smooth polygons ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_SCRBOX", "XXX_SCRBOX", "scrbox not supported"),
-    glDefine("GD_TEXTURE", "GL_TEXTURE_2D", "Texture ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_FOGPIXEL", "GL_FOG", "Fog ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_TEXTURE_PERSP", "GL_TEXTURE_2D", "Texture ALWAYS supported.#This function returns whether is is enabled."),
-    glDefine("GD_MUXPIPES", "XXX_MUXPIPES", "muxpipes: not supported -- See Window Manager?"),
-    glDefine("MSINGLE", "GL_MODELVIEW","MSINGLE not supported"),
-    glDefine("MPROJECTION", "GL_PROJECTION"),
-    glDefine("MVIEWING", "GL_MODELVIEW"),
-    glDefine("MTEXTURE", "GL_TEXTURE"),
-    glDefine("STR_B", "GL_UNSIGNED_BYTE"),
-    glDefine("STR_2B", "GL_2_BYTES"),
-    glDefine("STR_3B", "GL_3_BYTES"),
-    glDefine("STR_4B", "GL_4_BYTES"),
-    glDefine("STR_16", "GL_UNSIGNED_SHORT"),
-    glDefine("STR_32", "GL_UNSIGNED_INT"),
-    glDefine("LMC_COLOR", "XXX lmc_COLOR",  "LMC_COLOR: use glDisable(GL_COLOR_MATERIAL);"),
-    glDefine("LMC_EMISSION", "GL_EMISSION"),
-    glDefine("LMC_AMBIENT", "GL_AMBIENT"),
-    glDefine("LMC_DIFFUSE", "GL_DIFFUSE"),
-    glDefine("LMC_SPECULAR", "GL_SPECULAR"),
-    glDefine("LMC_AD", "GL_AMBIENT_AND_DIFFUSE"),
-    glDefine("LMC_NULL", "XXX_LMC_NULL",  "LMC_NULL: use glDisable(GL_COLOR_MATERIAL);"),
-    glDefine("TX_MINFILTER", "GL_TEXTURE_MIN_FILTER"),
-    glDefine("TX_MAGFILTER", "GL_TEXTURE_MAG_FILTER"),
-    glDefine("TX_WRAP", "XXX_TX_WRAP", "TX_WRAP not supported: see glTexParameterfv man page."),
-    glDefine("TX_WRAP_S", "GL_TEXTURE_WRAP_S"),
-    glDefine("TX_WRAP_T", "GL_TEXTURE_WRAP_T"),
-    glDefine("TX_TILE", "XXX_TX_TILE", "TX_TILE not supported: see glTexParamterfv man page."),
-    glDefine("TX_BORDER", "XXX_TX_BORDER", "Border needs to be added to glTexImage2D parameters"),
-    glDefine("TX_NULL", ""),
-    glDefine("TV_NULL", ""),
-    glDefine("TX_POINT", "GL_NEAREST"),
-    glDefine("TX_BILINEAR", "GL_LINEAR"),
-    glDefine("TX_MIPMAP", "GL_NEAREST_MIPMAP_LINEAR"),
-    glDefine("TX_MIPMAP_POINT", "GL_NEAREST_MIPMAP_NEAREST"),
-    glDefine("TX_MIPMAP_LINEAR", "GL_NEAREST_MIPMAP_LINEAR"),
-    glDefine("TX_MIPMAP_BILINEAR", "GL_LINEAR_MIPMAP_NEAREST"),
-    glDefine("TX_MIPMAP_TRILINEAR", "GL_LINEAR_MIPMAP_LINEAR"),
-    glDefine("TV_MODULATE", "GL_MODULATE"),
-    glDefine("TV_BLEND", "GL_BLEND", "XXX is there a problem with GL_BLEND?"),
-    glDefine("TV_DECAL", "GL_DECAL"),
-    glDefine("TV_COLOR", "GL_TEXTURE_ENV_COLOR",  "env_color: see glTexEnv man page"),
-    glDefine("TX_S", "GL_S"),
-    glDefine("TX_T", "GL_T"),
-    glDefine("TX_REPEAT", "GL_REPEAT"),
-    glDefine("TX_CLAMP", "GL_CLAMP"),
-    glDefine("TX_SELECT", "XXX_SELECT", "TX_SELECT not supported"),
-    glDefine("TG_OFF", "XXX_TG_OFF", "tg_off use: #glDisable(GL_TEXTURE_GEN_S);#glDisable(GL_TEXTURE_GEN_T);"),
-    glDefine("TG_ON", "XXX_TG_ON", "tg_on use: #glEnable(GL_TEXTURE_GEN_S);#glEnable(GL_TEXTURE_GEN_T);"),
-    glDefine("TG_CONTOUR", "GL_TG_CONTOUR"),
-    glDefine("TG_LINEAR", "GL_EYE_LINEAR"),
-    glDefine("TG_SPHEREMAP", "GL_SPHERE_MAP"),
-    glDefine("TV_ENV0", "GL_TEXTURE_ENV"),
-    glDefine("TX_TEXTURE_0", "GL_TEXTURE_2D"),
-    glDefine("GC_BITS_CMODE", "GL_INDEX_BITS"),
-    glDefine("GC_BITS_RED", "GL_RED_BITS"),
-    glDefine("GC_BITS_GREEN", "GL_GREEN_BITS"),
-    glDefine("GC_BITS_BLUE", "GL_BLUE_BITS"),
-    glDefine("GC_BITS_ALPHA", "GL_ALPHA_BITS"),
-    glDefine("GC_BITS_ZBUFFER", "GL_DEPTH_BITS"),
-    glDefine("GC_ZMIN", "XXX_ZMIN", "getgconfig: ZMIN always 0"),
-    glDefine("GC_ZMAX", "XXX_Z_MAX", "getgconfig: ZMAX always 1"),
-    glDefine("GC_BITS_STENCIL", "GL_STENCIL_BITS"),
-    glDefine("GC_BITS_ACBUF", "GL_ACCUM_RED_BITS", "BITS_ACBUF: add together all red, grn, blu, alp bits."),
-    glDefine("GC_MS_SAMPLES", "XXX_MS_SAMPLES", "multisample not supported in base OpenGL"),
-    glDefine("GC_BITS_MS_ZBUFFER", "XXX_MS_ZBUFFER", "multisample not supported in base OpenGL"),
-    glDefine("GC_MS_ZMIN", "XXX_MS_ZMIN", "zmin always 0.#multisample not supported in base OpenGL"),
-    glDefine("GC_MS_ZMAX", "XXX_MS_ZMAX", "zmax always 1.#multisample not supported in base OpenGL"),
-    glDefine("GC_BITS_MS_STENCIL", "GL_STENCIL_BITS", "multisample not supported in base OpenGL"),
-    glDefine("GC_STEREO", "GL_STEREO"),
-    glDefine("GC_DOUBLE", "GL_DOUBLEBUFFER"),
-    glDefine("Byte", "GLbyte"),
-    glDefine("Boolean", "GLboolean"),
-    glDefine("String", "GLbyte *"),
-    glDefine("Lstring", "GLint *"),
-    glDefine("Angle", "GLfloat"),
-    glDefine("Screencoord", "GLuint"),
-    glDefine("Scoord", "GLshort"),
-    glDefine("Icoord", "GLint"),
-    glDefine("Coord", "GLfloat"),
-    glDefine("Matrix", "GLfloat *",  "XXX fix this."),
-    glDefine("Colorindex", "GLshort"),
-    glDefine("RGBvalue", "GLuint"),
-    glDefine("Pattern16", "GLuint *", "XXX see glPolygonStipple man page"),
-    glDefine("Pattern32", "GLuint *", "XXX see glPolygonStipple man page"),
-    glDefine("Pattern64", "GLuint *", "XXX see glPolygonStipple man page"),
-    glDefine("Linestyle", "GLuint *", "XXX see glLineStipple man page"),
-    glDefine("Object", "GLuint"),
+// the first rule nominated at or after rules[i], or -1 if none are
+static inline int
+next_nominee(const Translation &t, int i)
+{
+    int w = i / NOMINEE_BITS, nw = (nrules + NOMINEE_BITS - 1) / NOMINEE_BITS;
+    unsigned long bits;
     
+    if(i >= nrules)
+	return -1;
+    bits = t.nominees[w] & (~0ul << i % NOMINEE_BITS);
+    while(!bits) {
+	if(++w == nw)
+	    return -1;
+	bits = t.nominees[w];
+    }
+    return w * NOMINEE_BITS + __builtin_ctzl(bits);
+}
 
-};
- 
-static int possible_hits[MAXPATTERN];
-static int replacements[MAXPATTERN];
+// one pass over the line finds every rule that could match it,
+// leaving out those process_line() has already gone past.
+static void
+nominate_rules(Translation &t, const char *s, int n, int after)
+{
+    TIME_STAGE(t, prefilter_stage);
+    assert(names_indexed);
+    t.stamp++;
+    memset(t.nominees, 0, (nrules + NOMINEE_BITS - 1) / NOMINEE_BITS * sizeof t.nominees[0]);
+    t.nnominees = 0;
+    t.nominate_after = after;
+    t.scanning = s;
+    t.scanlen = n;
+    names.scan(s, n, nominate, &t);
+}
 
+// match_rule() on t's line, counted and timed for -r
+static int
+timed_match(Translation &t, const Rule &r, RangeList &s, int before)
+{
+    RuleCounts &c = t.rule_counts[&r - rules];
+    long long start = now_ns();
+    int n = match_rule(t, r, t.ostr, s, before);
+    
+    c.match_ns += now_ns() - start;
+    if(n)
+	c.matches++;
+    return n;
+}
+
+// replace_rule() on t's line, timed for -r
+static void
+timed_replace(Translation &t, const Rule &r, const RangeList &s)
+{
+    long long start = now_ns();
+    
+    replace_rule(t, r, t.ostr, s);
+    t.rule_counts[&r - rules].replace_ns += now_ns() - start;
+}
+ 
 static void
-print_hits()
+translate_line(Translation &t)
 {
     int i;
-    std::cerr << "Possible hits & replacements made for " << lineno << " lines:\n";
-    for(i = 0; i < MAXPATTERN; i++) {
-	std::cerr << i << ":\t" << possible_hits[i] ;
-	std::cerr << "\t" << replacements[i] << "\n";
+    RangeList s;
+    const Rule *p;
+    int bucket[MAXPATTERN];
+    
+    nominate_rules(t, t.line, t.linelen, 0);
+    for(i = 0; i < MAXPATTERN; i++)
+	bucket[i] = 0;
+    for(i = next_nominee(t, 0); i >= 0; i = next_nominee(t, i + 1)) {
+	if(!bucket[rules[i].bucket]++)
+	    t.possible_hits[rules[i].bucket]++;
+    }
+    if(debug) {
+	t.searched++;
+	if(wide.check(t.line, t.linelen))
+	    t.wide_lines++;
+	if(t.nnominees)
+	    t.named_lines++;
+    }
+    
+    t.in_ostr = t.nnominees != 0;	// nothing to do, print_line() can use line as is
+    if(!t.in_ostr)
+	return;
+    t.ostr = "";
+    t.ostr.append(t.line, t.linelen);
+    
+    for(i = next_nominee(t, 0); i >= 0; i = next_nominee(t, i + 1)) {
+	int changed = 0, before = t.ostr.length();
+	p = &rules[i];
+	t.called_rules++;
+	if(t.rule_counts)
+	    t.rule_counts[i].nominated++;
+	// a rule only goes on to its uses left of what it last replaced,
+	// so it never looks at that again
+	while(t.rule_counts ? timed_match(t, *p, s, before) : match_rule(t, *p, t.ostr, s, before)) {
+	    before = s[1].start();
+	    if(t.rule_counts)
+		timed_replace(t, *p, s);
+	    else
+		replace_rule(t, *p, t.ostr, s);
+	    s.reset();
+	    t.replacements[p->bucket]++;
+	    changed = 1;
+	}
+	t.matched_rules += changed;
+	if(changed) {	// the replacement may have brought in new names
+	    nominate_rules(t, t.ostr, t.ostr.length(), i + 1);
+	}
     }
 }
- 
+
+/*
+ * translate t's line, or with -M, remember how it went last time.  Most
+ * lines of most programs don't come round again, and hashing and keeping
+ * them costs more than translating them afresh.
+ */
 void
-process_line()
+process_line(Translation &t)
 {
-    int i;
-    PerlStringList s;
-    glThing *p;
+    LineCache::entry *e;
+    int i, errors, hits[MAXPATTERN], reps[MAXPATTERN];
     
-    ostr = instr;
+    if(!remember_lines) {
+	translate_line(t);
+	return;
+    }
+    if((e = t.memo.find(t.line, t.linelen)) != 0) {
+	t.in_ostr = e->changed;
+	if(e->changed)
+	    t.ostr = e->out;
+	if(!e->comments.isempty()) {
+	    t.comments = e->comments;
+	    t.calls = e->calls;
+	}
+	for(i = 0; i < MAXPATTERN; i++) {
+	    if(e->hit_buckets & (1ul << i))
+		t.possible_hits[i]++;
+	    t.replacements[i] += e->replaced[i];
+	}
+	return;
+    }
     
+    errors = t.errors;
     for(i = 0; i < MAXPATTERN; i++) {
-	if(first_glThing[i] && search[i].check(ostr)) { // if we have a possible match here...
-	    possible_hits[i]++;
-	    for(p = first_glThing[i];p;p = p->next()) {
-		int junk;   // junk not used -- avoids a compiler bug
-		while(junk = p->m(ostr, s)) {
-		    p->replace(ostr, s);
-		    s.reset();
-		    replacements[i]++;
-		}
-	    }
-	}
+	hits[i] = t.possible_hits[i];
+	reps[i] = t.replacements[i];
+    }
+    translate_line(t);
+    if(t.errors != errors)	// they'd need reporting again
+	return;
+    
+    e = t.memo.add(t.line, t.linelen);
+    e->changed = t.in_ostr;
+    if(t.in_ostr)
+	e->out = t.ostr;
+    e->comments = t.comments;
+    e->calls = t.calls;
+    e->hit_buckets = 0;
+    for(i = 0; i < MAXPATTERN; i++) {
+	if(t.possible_hits[i] != hits[i])
+	    e->hit_buckets |= 1ul << i;
+	e->replaced[i] = t.replacements[i] - reps[i];
     }
 }
 
 void
-print_line()
+print_line(Translation &t)
 {
-    if(!comments.isempty()) {
+    TIME_STAGE(t, write_stage);
+#ifdef PROFILE
+    t.profiled_lines++;
+    t.profiled_bytes += t.linelen + 1;
+#endif
+    if(!t.comments.isempty()) {
 	if(!no_comments) {
-	    if(comments.scalar() == 1) {
-		std::cout << "\t/* OGLXXX " << comments[0] << " */\n";
+	    int i, call = 0;
+	    const char *c;
+	    
+	    if(t.comments.scalar() == 1) {
+		c = t.comments[0] ? t.comments[0] : (const char *)t.calls[0];
+		*t.out << "\t/* OGLXXX " << c << " */\n";
 	    } else {
-		std::cout << "\t/* OGLXXX\n\t * " << comments.join("\n\t * ") << "\n\t */\n";
+		*t.out << "\t/* OGLXXX\n";
+		for(i = 0; i < t.comments.scalar(); i++) {
+		    c = t.comments[i] ? t.comments[i] : (const char *)t.calls[call++];
+		    *t.out << "\t * " << c << '\n';
+		}
+		*t.out << "\t */\n";
 	    }
 	}
-	comments.reset();
+	t.comments.reset();
+	t.calls.reset();
     }
-    ostr = ostr.substr(1, ostr.length() - 2);	// remove first and last " " added by read_line
-    std::cout << ostr << '\n';
+    if(t.in_ostr)
+	*t.out << t.ostr << '\n';
+    else
+	t.out->write(t.line, t.linelen) << '\n';
     
     if(debug)
-	std::cout.flush();
+	t.out->flush();
 }
 
-void
-init_optional_functions()
-{
-    if(!no_window) {
-	new     glDelete("wintitle", "wintitle not supported -- See Window Manager");
-	new     glDelete("winset", "winset not supported -- See Window Manager");
-	new     glDelete("winpush", "winpush not supported -- See Window Manager");
-	new     glDelete("winposition", "winposition not supported -- See Window Manager");
-	new     glDelete("winpop", "winpop not supported -- See Window Manager");
-	new     glDelete("winopen", "winopen not supported -- See Window Manager");
-	new     glDelete("winmove", "winmove not supported -- See Window Manager");
-	new     glDelete("winget", "winget not supported -- See Window Manager");
-	new     glDelete("windepth", "windepth not supported -- See Window Manager");
-	new     glDelete("winconstraints", "winconstraints not supported -- See Window Manager");
-	new     glDelete("winclose", "winclose not supported -- See Window Manager");
-	new     glDelete("videocmd", "videocmd not supported");
-	new     glDelete("tpon", "tpon not supported");
-	new     glDelete("tpoff", "tpoff not supported");
-	new     glDelete("textport", "textport not supported");
-	new     glDelete("textinit", "textinit not supported");
-	new     glDelete("textcolor", "textcolor not supported -- See Fonts");
-	new     glDelete("swinopen", "swinopen not supported -- See Window Manager");
-	new     glDelete("stepunit", "stepunit not supported -- See Window Manager");
-	new     glDelete("setvideo", "setvideo not supported");
-	new     glDelete("setmonitor", "setmonitor not supported");
-	new     glDelete("setmap", "setmap not supported -- See Window Manager");
-	new     glDelete("setdblights", "setdblights not supported -- See Window Manager");
-	new     glDelete("setbell", "setbell not supported -- See Window Manager");
-	new     glDelete("scrnselect", "scrnselect not supported -- See Window Manager");
-	new     glDelete("scrnattach", "scrnattach not supported -- See Window Manager");
-	new     glDelete("screenspace", "screenspace not supported");
-	new     glDelete("ringbell", "ringbell not supported -- See Window Manager");
-	new     glDelete("reshapeviewport", "reshapeviewport not supported -- See Window Manager");
-	new     glDelete("prefposition", "prefposition not supported -- See Window Manager");
-	new     glDelete("prefsize", "prefsize not supported -- See Window Manager");
-	new     glDelete("onemap", "onemap not supported -- See Window Manager");
-	new     glDelete("noborder", "noborder not supported -- See Window Manager");
-	new     glDelete("multimap", "multimap not supported -- See Window Manager?");
-	new     glDelete("mswapbuffers", "mswapbuffers not supported -- See Window Manager");
-	new     glDelete("mapcolor", "mapcolor not supported -- See Window Manager");
-	new     glDelete("imakebackground", "imakebackground not supported -- See Window Manager");
-	new     glDelete("icontitle", "icontitle not supported -- See Window Manager");
-	new     glDelete("iconsize", "iconsize not supported -- See Window Manager");
-	new     glDelete("greset", "greset not supported -- See Window Manager");
-	new     glDelete("ginit", "ginit not supported -- See Window Manager");
-	new     glDelete("gexit", "gexit not supported -- See Window Manager#\tThere's bound to be something you have to do!");
-	new     glDelete("getwscrn", "getwscrn not supported -- See Window Manager");
-	new     glDelete("getvideo", "getvideo not supported");
-	new     glDelete("getsize", "getsize not supported -- See Window Manager");
-	new     glDelete("getorigin", "getorigin not supported -- See Window Manager");
-	new     glDelete("getmcolor", "getmcolor not supported -- See Window Manager");
-	new     glDelete("getmonitor", "getmonitor not supported");
-	new     glDelete("getmap", "getmap not supported");
-	new     glDelete("getbutton", "getbutton not supported -- See Window Manager");
-	new     glDelete("gammaramp", "gammaramp not supported");
-	new     glDelete("fullscrn", "fullscrn not supported");
-	new     glDelete("fudge", "fudge not supported");
-	new     glDelete("endfullscrn", "endfullscrn not supported");
-	new     glDelete("dglopen", "dglopen not supported");
-	new     glDelete("dglclose", "dglclose not supported");
-	new     glDelete("dbtext", "dbtext not supported, see Window Manager");
-	new     glDelete("defcursor", "defcursor not supported, see Window Manager");
-	new     glDelete("cyclemap", "cyclemap not supported, see Window Manager?");
-	new     glDelete("curstype", "curstype not supported");
-	new     glDelete("curson", "curson not supported");
-	new     glDelete("cursoff", "cursoff not supported");
-	new     glDelete("curorigin", "curorigin not supported");
-	new     glDelete("blink", "blink not supported, see Window Manager");
-	new     glDelete("blanktime", "blanktime not supported, see Window Manager");
-	new     glDelete("blankscreen", "blankscreen not supported, see Window Manager");
-	new     glDelete("winattach", "winattach obsolete -- see Window Manager");
-	new     glDelete("setcursor", "setcursor not supported -- see Window Manager");
-	new     glDelete("RGBcursor", "RGBcursor obsolete -- see Window Manager");
-	new     glDelete("getcursor", "getcursor not supported -- see Window Manager?");
-	new     glSimple("swapbuffers", "glXSwapBuffers(*display, window)", "swapbuffers: replace display and window");
-	new     glSimple("singlebuffer", "glxChooseVisual(*dpy, screen, *attriblist)", "singlebuffer: don't use GLX_DOUBLEBUFFER in attriblist");
-	new     glSimple("doublebuffer", "glxChooseVisual(*dpy, screen, *attriblist)", "doublebuffer: use GLX_DOUBLEBUFFER in attriblist");
-	new     glSimple("cmode", "glxChooseVisual(*dpy, screen, *attriblist)", "cmode: use GLX_BUFFER_SIZE, 1024 in attriblist");
-	new     glSimple("RGBmode",  "glxChooseVisual(*dpy, screen, *attriblist)", "RGBmode: use GLX_RGBA in attriblist");
-	new	glDelete("gbegin", "gbegin not supported -- See Window Manager");
-	new	glDelete("getport", "getport obsolete -- see Window Manager");
-	new	glDelete("keepaspect", "keepaspect not supported -- See Window Manager");
-	new	glDelete("maxsize", "maxsize not supported -- See Window Manager");
-	new	glDelete("minsize", "minsize not supported -- See Window Manager");
-	new     glDelete("clkon", "clkon not supported");
-	new     glDelete("clkoff", "clkoff not supported");
-	new     glDelete("lampoff", "lampoff not supported -- See Window Manager");
-	new     glDelete("lampon", "lampon not supported -- See Window Manager");
-	new     glDelete("attachcursor", "attachcursor not supported -- See Window Manager");
+
+// translate the rest of t's input, a line at a time
+static void
+translate_lines(Translation &t)
+{
+    if(!no_arena)
+	Arena::use(&t.temps);
+    while(read_line(t)) {
+	process_line(t);
+	print_line(t);
+	t.temps.reset();
     }
-    if(!no_queue) {
-	new     glDelete("blkqread", "blkqread not supported, see Events"); // XXX X equivalent?
-	new     glDelete("getvaluator", "getvaluator not supported -- See Events");
-	new     glDelete("isqueued", "isqueued not supported -- See Events");
-	new     glDelete("noise", "noise not supported -- See Events");
-	new     glDelete("qdevice", "qdevice not supported -- See Events");
-	new     glDelete("qenter", "qenter not supported -- See Events");
-	new     glDelete("qgetfd", "qgetfd not supported -- See Events");
-	new     glDelete("qread", "qread not supported -- See Events");
-	new     glDelete("qreset", "qreset not supported -- See Events");
-	new     glDelete("qtest", "qtest not supported -- See Events");
-	new     glDelete("setvaluator", "setvaluator not supported -- See Events");
-	new     glDelete("tie", "tie not supported -- See Events");
-	new     glDelete("unqdevice", "unqdevice not supported -- See Events");
-	new     glDelete("unqdevice", "unqdevice not supported -- See Events");
-	new	glDelete("getdev", "getdev not supported -- See Events");
-	new	glDelete("qcontrol", "qcontrol not supported -- See Events");
+    Arena::use(0);
+}
+
+// an ostream that saves up what's written to it
+class SaveBuf : public std::streambuf {
+    public:
+	std::string saved;
+    protected:
+	int overflow(int c) {
+	    if(c != EOF) {
+		saved += (char)c;
+	    }
+	    return c;
+	};
+	std::streamsize xsputn(const char *s, std::streamsize n) {
+	    saved.append(s, n);
+	    return n;
+	};
+};
+
+/*
+ * A big mapped input is cut into runs of whole lines that are
+ * translated on jobs threads at once.  Nothing carries over from one
+ * line to the next but lineno, so each chunk can be done apart from
+ * the others given the line it starts at, and the output put back
+ * together in order is just what translating it all in turn would give.
+ */
+enum {CHUNKSZ = 65536};	// bytes of input, rounded up to a whole line
+
+class Chunk {
+    public:
+	Chunk() : start(0), end(0), lineno(0), errors(0), done(0) {};
+	const char *start, *end;
+	int lineno;	// of the line before start
+	SaveBuf out, err;
+	int errors;
+	int possible_hits[MAXPATTERN];
+	int replacements[MAXPATTERN];
+	int done;
+};
+
+// translate chunk k with t, saving what it writes
+static void
+translate_chunk(Translation &t, Chunk &k)
+{
+    std::ostream out(&k.out), err(&k.err);
+    int i;
+    
+    t.reset(t.filename);
+    t.out = &out;
+    t.err = &err;
+    t.map_next = k.start;
+    t.map_end = k.end;
+    t.lineno = k.lineno;
+    translate_lines(t);
+    t.map_next = t.map_end = 0;
+    
+    k.errors = t.errors;
+    for(i = 0; i < MAXPATTERN; i++) {
+	k.possible_hits[i] = t.possible_hits[i];
+	k.replacements[i] = t.replacements[i];
+    }
+}
+
+// write out a translated chunk, as though t had done it
+static void
+emit_chunk(Translation &t, Chunk &k)
+{
+    int i;
+    
+    t.out->write(k.out.saved.data(), k.out.saved.size());
+    t.err->write(k.err.saved.data(), k.err.saved.size());
+    if(debug)
+	t.out->flush();
+    k.out.saved.clear();
+    k.err.saved.clear();
+    t.errors += k.errors;
+    for(i = 0; i < MAXPATTERN; i++) {
+	t.possible_hits[i] += k.possible_hits[i];
+	t.replacements[i] += k.replacements[i];
     }
-    if(!no_lighting) {
-	new glDefine("MAXLIGHTS", "(glGetIntegerv(GL_MAX_LIGHTS, &tmp), tmp)", "maxlights:#GLint tmp;");
-	new glDefine("MATERIAL", "GL_FRONT", "Use GL_FRONT in call to glMaterialf.");
-	new glDefine("BACKMATERIAL", "GL_BACK", "Use GL_BACK in call to glMaterialf.");
-	new glDefine("LIGHT7", "GL_LIGHT7");
-	new glDefine("LIGHT6", "GL_LIGHT6");
-	new glDefine("LIGHT5", "GL_LIGHT5");
-	new glDefine("LIGHT4", "GL_LIGHT4");
-	new glDefine("LIGHT3", "GL_LIGHT3");
-	new glDefine("LIGHT2", "GL_LIGHT2");
-	new glDefine("LIGHT1", "GL_LIGHT1");
-	new glDefine("LIGHT0", "GL_LIGHT0");
-	new glDefine("LMNULL", "");
-	new glDefine("TWOSIDE", "GL_LIGHT_MODEL_TWO_SIDE", "light model parameters need to be moved into a glLightModelf call.");
-	new glDefine("ATTENUATION2", "GL_QUADRATIC_ATTENUATION");
-	new glDefine("ATTENUATION", "GL_CONSTANT_ATTENUATION", "attenuation: see glLightf man page:#Add GL_LINEAR_ATTENUATION.");
-	new glDefine("LOCALVIEWER", "GL_LIGHT_MODEL_LOCAL_VIEWER", "light model parameters need to be moved into a glLightModelf call.");
-	new glDefine("SPOTLIGHT", "XXX_SPOTLIGHT", "see glLightf man page#Add GL_SPOT_EXPONENT and GL_SPOT_CUTOFF parameters.");
-	new glDefine("POSITION", "GL_POSITION");
-	new glDefine("LCOLOR", "GL_DIFFUSE", "light color: need to add GL_AMBIENT and GL_SPECULAR components.#ALPHA needs to be included in parameters.");
-	new glDefine("COLORINDEXES", "GL_COLOR_INDEXES");
-	new glDefine("ALPHA", "XXX_ALPHA", "alpha is to be included with other parameters");
-	new glDefine("SHININESS", "GL_SHININESS");
-	new glDefine("SPECULAR", "GL_SPECULAR", "include ALPHA parameter with specular");
-	new glDefine("DIFFUSE", "GL_DIFFUSE", "include ALPHA parameter with diffuse");
-	new glDefine("AMBIENT", "GL_AMBIENT", "Ambient:#\tIf this is a light model lmdef, then use glLightModelf and GL_LIGHT_MODEL_AMBIENT.#Include ALPHA parameter with ambient");
-	new glDefine("EMISSION", "GL_EMISSION", "include ALPHA parameter with emission");
-	new glDefine("SPOTDIRECTION", "GL_SPOT_DIRECTION");
-	new glArgs("lmbind", "if($2) {glCallList($2); glEnable($1);} else glDisable($1)",  "lmbind: check object numbering."), 
-	new glArgs("lmdef", "glNewList($2, GL_COMPILE); glMaterialf(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, *$4); glEndList();", "lmdef other possibilities include:#\tglLightf(light, pname, *params);#\tglLightModelf(pname, param);#Check list numbering.#Translate params as needed.");
-     }
-    if(emulate_lighting) {
-	new glArgs("lmbind", "mylmbind($1, $2)"), 
-	new glArgs("lmdef", "mylmdef($1, $2, $3, $4)");
-     }
 }
 
+static Chunk *chunks;
+static int nchunks;
+static std::atomic<int> next_chunk;
+static std::mutex chunk_lock;
+static std::condition_variable chunk_done;
 
+static void
+chunk_worker(const char *filename)
+{
+    Translation t(filename);
+    int c;
+    
+    while((c = next_chunk++) < nchunks) {
+	Chunk &k = chunks[c];
+	translate_chunk(t, k);
+	std::lock_guard<std::mutex> g(chunk_lock);
+	k.done = 1;
+	chunk_done.notify_one();
+    }
+    Arena::retire();
+}
+
+// translate t's mapped input a chunk to a thread, writing them back in order
+static void
+translate_chunks(Translation &t)
+{
+    const char *p, *end, *nl;
+    int c, i, lines = t.lineno;
+    
+    nchunks = (t.map_end - t.map_next + CHUNKSZ - 1) / CHUNKSZ;
+    chunks = new Chunk[nchunks];
+    for(c = 0, p = t.map_next; p < t.map_end; c++, p = end) {
+	end = p + CHUNKSZ < t.map_end ? p + CHUNKSZ : t.map_end;
+	if((nl = (const char *)memchr(end - 1, '\n', t.map_end - (end - 1))) != 0)
+	    end = nl + 1;
+	else
+	    end = t.map_end;
+	chunks[c].start = p;
+	chunks[c].end = end;
+	chunks[c].lineno = lines;
+	for(; (p = (const char *)memchr(p, '\n', end - p)) != 0; p++)
+	    lines++;
+    }
+    nchunks = c;
+    next_chunk = 0;
+    
+    std::thread *threads = new std::thread[jobs];
+    for(i = 0; i < jobs; i++)
+	threads[i] = std::thread(chunk_worker, t.filename);
+    
+    for(c = 0; c < nchunks; c++) {
+	Chunk &k = chunks[c];
+	{
+	    std::unique_lock<std::mutex> g(chunk_lock);
+	    chunk_done.wait(g, [&k]{ return k.done; });
+	}
+	emit_chunk(t, k);
+	std::string().swap(k.out.saved);	// done with
+	std::string().swap(k.err.saved);
+    }
+    
+    for(i = 0; i < jobs; i++)
+	threads[i].join();
+    delete [] threads;
+    delete [] chunks;
+    chunks = 0;
+    t.lineno = lines + 1;	// as if the last read_line() had found nothing
+    t.map_next = t.map_end;
+}
+
+/*
+ * Input that can't be mapped, a pipe say, is read, translated and
+ * written on different threads so the reading and writing overlap the
+ * regex work: a reader thread reads batches of lines into the slots of
+ * a ring, jobs translator threads each take the next batch, and the
+ * writer writes them out in order and hands the slot back to the reader.
+ * Each slot's turn says whose it is, so none of them need lock, and the
+ * reader can only get RINGSZ batches ahead of the writer however much
+ * input there is.
+ */
+enum {BATCHLINES = 256, RINGSZ = 32};
+
+class Slot {
+    public:
+	std::atomic<long> turn;	// 3*batch to read, 3*batch+1 to translate, 3*batch+2 to write
+	std::string lines;	// the batch, each ending in '\n'
+	Chunk k;
+};
+
+static Slot *ring;
+static std::atomic<long> next_batch;
+static std::atomic<long> nbatches;	// once the input has all been read, else -1
+static int piped_lines;
+
+// wait for slot's turn, or return 0 if the input ended before batch
+static int
+wait_turn(Slot &slot, long turn, long batch)
+{
+    long n;
+    
+    for(int spins = 0; slot.turn.load(std::memory_order_acquire) != turn; spins++) {
+	if((n = nbatches.load(std::memory_order_acquire)) >= 0 && batch >= n)
+	    return 0;
+	if(spins < 64)
+	    std::this_thread::yield();
+	else
+	    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    return 1;
+}
+
+// read t's input into the ring a batch at a time, its time going to
+// t's read stage for -P
+static void
+pipe_reader(Translation *t)
+{
+    std::istream *in = t->in;
+    PerlString line;
+    int n, lines = 0;
+    
+    for(long b = 0; ; b++) {
+	Slot &slot = ring[b % RINGSZ];
+	wait_turn(slot, 3*b, b);
+	slot.lines.clear();
+	{
+	    TIME_STAGE(*t, read_stage);
+	    for(n = 0; n < BATCHLINES; n++) {
+		*in >> line;	// as read_line() would
+		if(in->eof())
+		    break;
+		slot.lines.append(line, line.length());
+		slot.lines += '\n';
+	    }
+	}
+	slot.k.start = slot.lines.data();
+	slot.k.end = slot.lines.data() + slot.lines.size();
+	slot.k.lineno = lines;
+	lines += n;
+	if(n)
+	    slot.turn.store(3*b + 1, std::memory_order_release);
+	if(n < BATCHLINES) {
+	    piped_lines = lines;
+	    nbatches.store(n ? b + 1 : b, std::memory_order_release);
+	    return;
+	}
+    }
+}
+
+static void
+pipe_translator(const char *filename)
+{
+    Translation t(filename);
+    long b;
+    
+    for(;;) {
+	b = next_batch++;
+	Slot &slot = ring[b % RINGSZ];
+	if(!wait_turn(slot, 3*b + 1, b))
+	    break;
+	translate_chunk(t, slot.k);
+	slot.turn.store(3*b + 2, std::memory_order_release);
+    }
+    Arena::retire();
+}
+
+// translate *t.in on a reader, jobs translators and this thread writing
+static void
+translate_pipelined(Translation &t)
+{
+    int i;
+    long b;
+    
+    ring = new Slot[RINGSZ];
+    for(i = 0; i < RINGSZ; i++)
+	ring[i].turn = 3*i;
+    next_batch = 0;
+    nbatches = -1;
+    
+    std::thread reader(pipe_reader, &t);
+    std::thread *threads = new std::thread[jobs];
+    for(i = 0; i < jobs; i++)
+	threads[i] = std::thread(pipe_translator, t.filename);
+    
+    for(b = 0; wait_turn(ring[b % RINGSZ], 3*b + 2, b); b++) {
+	Slot &slot = ring[b % RINGSZ];
+	emit_chunk(t, slot.k);
+	slot.turn.store(3*(b + RINGSZ), std::memory_order_release);
+    }
+    
+    reader.join();
+    for(i = 0; i < jobs; i++)
+	threads[i].join();
+    delete [] threads;
+    delete [] ring;
+    ring = 0;
+    t.lineno += piped_lines + 1;	// as if the last read_line() had found nothing
+}
+
+// translate the rest of t's input, on jobs threads if split
+static void
+translate_input(Translation &t, int split)
+{
+    if(split && jobs > 1 && t.map_end - t.map_next > CHUNKSZ)
+	translate_chunks(t);
+    else if(split && jobs > 1 && !t.map_end)
+	translate_pipelined(t);
+    else
+	translate_lines(t);
+}
+
+/*
+ * With -C, a mapped input's translation, messages and counts are kept in
+ * a file in cachedir named for a hash of the input, its name (which the
+ * messages give), the options that change the output and the rules.
+ * Next time the same input comes along they're given back as they were
+ * without translating anything.  The file starts with
+ *	toogl cache
+ *	<input size> <lineno> <errors> <message bytes> <output bytes>
+ *	<possible_hits[]> <replacements[]>
+ * followed by the messages and the output.
+ */
+static PerlString
+cache_path(Translation &t)
+{
+    char opts[8], hex[20];
+    unsigned long long h;
+    
+    snprintf(opts, sizeof opts, "%d%d%d%d%d", no_comments, no_lighting, 
+	emulate_lighting, no_queue, no_window);
+    h = hash64(t.map_next, t.map_end - t.map_next);
+    h = hash64(t.filename, strlen(t.filename) + 1, h);
+    h = hash64(opts, strlen(opts), h);
+    h = hash64(revision, strlen(revision), h);
+    h = hash64((const char *)&rules_version, sizeof rules_version, h);
+    snprintf(hex, sizeof hex, "%016llx", h);
+    
+    PerlString path(cachedir);
+    path += "/";
+    path += hex;
+    return path;
+}
+
+// give back what's kept in path for t's input, or return 0 if nothing is
+static int
+cache_load(Translation &t, const char *path)
+{
+    std::ifstream f(path, std::ios::binary);
+    std::string magic;
+    long size, msglen, outlen;
+    int i, lineno, errors, hits[MAXPATTERN], reps[MAXPATTERN];
+    
+    if(!f)
+	return 0;
+    std::getline(f, magic);
+    f >> size >> lineno >> errors >> msglen >> outlen;
+    for(i = 0; i < MAXPATTERN; i++)
+	f >> hits[i];
+    for(i = 0; i < MAXPATTERN; i++)
+	f >> reps[i];
+    if(!f || f.get() != '\n' || magic != "toogl cache" || size != t.map_end - t.map_next)
+	return 0;
+    
+    // the messages and output must be just what's left of the file, or
+    // it's been cut short or damaged
+    std::streamoff body_at = f.tellg();
+    f.seekg(0, std::ios::end);
+    std::streamoff left = f.tellg() - body_at;
+    f.seekg(body_at);
+    if(!f || lineno < 0 || errors < 0 || msglen < 0 || outlen < 0 || msglen > left
+	|| outlen != left - msglen)
+	return 0;
+    
+    std::string body(msglen + outlen, '\0');
+    if(!f.read(&body[0], body.size()))
+	return 0;
+    t.err->write(body.data(), msglen);
+    t.out->write(body.data() + msglen, outlen);
+    t.lineno = lineno;
+    t.errors += errors;
+    for(i = 0; i < MAXPATTERN; i++) {
+	t.possible_hits[i] += hits[i];
+	t.replacements[i] += reps[i];
+    }
+    return 1;
+}
+
+// keep t's translation in path, putting it in place whole
+static void
+cache_store(Translation &t, const char *path, long size, const std::string &msgs, 
+    const std::string &out)
+{
+    static std::atomic<int> ntemps;
+    PerlString temp(path);
+    char suffix[40];
+    int i;
+    
+    snprintf(suffix, sizeof suffix, ".%d.%d", (int)getpid(), ntemps++);
+    temp += suffix;
+    std::ofstream f(temp, std::ios::binary);
+    f << "toogl cache\n" << size << " " << t.lineno << " " << t.errors 
+	<< " " << msgs.size() << " " << out.size() << "\n";
+    for(i = 0; i < MAXPATTERN; i++)
+	f << t.possible_hits[i] << " ";
+    for(i = 0; i < MAXPATTERN; i++)
+	f << t.replacements[i] << (i < MAXPATTERN - 1 ? " " : "\n");
+    f << msgs << out;
+    f.close();
+    if(!f || rename(temp, path) < 0)
+	unlink(temp);
+}
+
+/*
+ * translate fd, or is if fd can't be mapped, onto os.  If split, a big
+ * enough mapped input is done in chunks on jobs threads, and one that
+ * can't be mapped is pipelined.
+ */
+static void
+translate(Translation &t, int fd, std::istream &is, std::ostream &os, int split = 0)
+{
+    t.in = &is;
+    t.out = &os;
+    map_input(t, fd);
+    
+    if(cachedir && t.map_end) {
+	PerlString path = cache_path(t);
+	if(cache_load(t, path)) {
+	    disk_hits++;
+	} else {
+	    SaveBuf out, msgs;
+	    std::ostream o(&out), m(&msgs);
+	    std::ostream *err = t.err;
+	    long size = t.map_end - t.map_next;
+	    
+	    disk_misses++;
+	    t.out = &o;
+	    t.err = &m;
+	    translate_input(t, split);
+	    os.write(out.saved.data(), out.saved.size());
+	    err->write(msgs.saved.data(), msgs.saved.size());
+	    t.out = &os;
+	    t.err = err;
+	    cache_store(t, path, size, msgs.saved, out.saved);
+	}
+    } else
+	translate_input(t, split);
+    
+    unmap_input(t);
+}
+
+// path's last component
+static const char *
+base_name(const char *path)
+{
+    const char *base = strrchr(path, '/');
+    
+    return base ? base + 1 : path;
+}
+
+/*
+ * translate path into a file of the same name in outdir.  The output is
+ * written to a temporary file renamed into place once it's done, so an
+ * output that's there already is only replaced by a whole translation,
+ * and one that's the input itself is refused.
+ */
+static void
+translate_file(Translation &t, const char *path, int split = 0)
+{
+    static std::atomic<int> ntemps;
+    PerlString opath(outdir), temp;
+    struct stat ist, ost;
+    char suffix[40];
+    
+    opath += "/";
+    opath += base_name(path);
+    int fd = open(path, O_RDONLY);
+    std::ifstream is(path);
+    if(fd < 0 || !is || fstat(fd, &ist) < 0) {
+	*t.err << "toogl: can't read " << path << "\n";
+	t.errors++;
+	if(fd >= 0)
+	    close(fd);
+	return;
+    }
+    if(stat(opath, &ost) == 0 && ost.st_dev == ist.st_dev && ost.st_ino == ist.st_ino) {
+	*t.err << "toogl: won't translate " << path << " into itself\n";
+	t.errors++;
+	close(fd);
+	return;
+    }
+    snprintf(suffix, sizeof suffix, ".toogl.%d.%d", (int)getpid(), ntemps++);
+    temp = opath;
+    temp += suffix;
+    std::ofstream os(temp);
+    if(!os) {
+	*t.err << "toogl: can't write " << opath << "\n";
+	t.errors++;
+	close(fd);
+	return;
+    }
+    
+    translate(t, fd, is, os, split);
+    close(fd);
+    os.close();
+    if(!os || rename(temp, opath) < 0) {
+	*t.err << "toogl: can't write " << opath << "\n";
+	t.errors++;
+	unlink(temp);
+    }
+    *t.err << path << ": " << t.lineno - 1 << " lines, " << t.errors << " errors\n";
+    if(debug) 
+	print_hits(t);
+}
+
+static PerlStringList files;	// to translate into outdir
+static std::mutex report_lock;	// for the totals and stderr
+
+// a file is done with, add it to the totals
+static void
+count_file(Translation &t)
+{
+    total_errors += t.errors;
+    if(t.lineno)
+	total_lines += t.lineno - 1;	// the last read_line() found nothing
+}
+
+// the files in a directory, in name order
+static void
+add_dir(const char *dir)
+{
+    PerlStringList found;
+    DIR *d;
+    struct dirent *e;
+    struct stat st;
+    
+    if(!(d = opendir(dir))) {
+	std::cerr << "toogl: can't read " << dir << "\n";
+	total_errors++;
+	return;
+    }
+    while((e = readdir(d)) != 0) {
+	if(e->d_name[0] == '.')
+	    continue;
+	PerlString path(dir);
+	path += "/";
+	path += e->d_name;
+	if(stat(path, &st) == 0 && S_ISREG(st.st_mode))
+	    found.push(path);
+    }
+    closedir(d);
+    
+    files.push(found.sort());
+}
+
+static int
+by_base_name(const void *a, const void *b)
+{
+    return strcmp(base_name(files[*(const int *)a]), base_name(files[*(const int *)b]));
+}
+
+// whether two of files[] would be translated into the same file in outdir
+static int
+same_outputs()
+{
+    int i, n = files.scalar(), same = 0;
+    int *order = new int[n];
+    
+    for(i = 0; i < n; i++)
+	order[i] = i;
+    qsort(order, n, sizeof order[0], by_base_name);
+    for(i = 1; i < n; i++) {
+	if(by_base_name(&order[i - 1], &order[i]) == 0) {
+	    std::cerr << "toogl: " << files[order[i - 1]] << " and " << files[order[i]]
+		<< " would both be translated into " << outdir << "/" 
+		<< base_name(files[order[i]]) << "\n";
+	    same = 1;
+	}
+    }
+    delete [] order;
+    return same;
+}
+
+/*
+ * Each worker has a deque of files, a run of files[], to do.  It takes
+ * them off the back, and once it runs out steals off the front of the
+ * others', so a worker stuck on a big file doesn't hold up the ones
+ * queued behind it.
+ */
+class FileDeque {
+    public:
+	FileDeque() : lo(0), hi(0) {};
+	void set(int l, int h) {lo = l; hi = h;};
+	int take() {
+	    std::lock_guard<std::mutex> g(lock);
+	    return lo < hi ? --hi : -1;
+	};
+	int steal() {
+	    std::lock_guard<std::mutex> g(lock);
+	    return lo < hi ? lo++ : -1;
+	};
+    private:
+	std::mutex lock;
+	int lo, hi;	// files[lo] to files[hi-1] still to do
+};
+
+static FileDeque *deques;
+
+static void
+worker(int w)
+{
+    Translation t;
+    SaveBuf buf;
+    std::ostream msgs(&buf);	// stderr for one file, kept in one piece
+    int f, i;
+    
+    for(;;) {
+	f = deques[w].take();
+	for(i = 1; f < 0 && i < jobs; i++)
+	    f = deques[(w + i) % jobs].steal();
+	if(f < 0)
+	    break;
+	t.reset(files[f]);
+	buf.saved.clear();
+	t.err = &msgs;
+	translate_file(t, files[f]);
+	
+	std::lock_guard<std::mutex> g(report_lock);
+	std::cerr << buf.saved;
+	count_file(t);
+    }
+    Arena::retire();
+}
+
+static void
+translate_files()
+{
+    int i, n = files.scalar();
+    
+    if(jobs <= 1 || n == 1) {	// a lone file is split up instead
+	Translation t;
+	for(i = 0; i < n; i++) {
+	    t.reset(files[i]);
+	    translate_file(t, files[i], 1);
+	    count_file(t);
+	}
+	return;
+    }
+    
+    deques = new FileDeque[jobs];
+    for(i = 0; i < jobs; i++)
+	deques[i].set(i * n / jobs, (i + 1) * n / jobs);
+    std::thread *threads = new std::thread[jobs];
+    for(i = 0; i < jobs; i++)
+	threads[i] = std::thread(worker, i);
+    for(i = 0; i < jobs; i++)
+	threads[i].join();
+    delete [] threads;
+    delete [] deques;
+}
+
+#if !TEST_MATCH
 int 
 main(int argc, char **argv)
 {
+    struct stat st;
+    
+#ifdef PROFILE
+    started_ns = now_ns();
+#endif
     options(argc, argv);
-    init_optional_functions();
-        
-    while(read_line()) {
-	process_line();
-	print_line();
+    index_names();
+    if(cachedir && mkdir(cachedir, 0777) < 0 && 
+	(stat(cachedir, &st) < 0 || !S_ISDIR(st.st_mode))) {
+	std::cerr << "toogl: can't use " << cachedir << " to keep translations in\n";
+	exit(1);
+    }
+    
+    if(optind == argc) {	// filter stdin to stdout
+	Translation t;
+	translate(t, 0, std::cin, std::cout, 1);
+	if(debug) 
+	    print_hits(t);
+	count_file(t);
+    } else if(!outdir) {
+	std::cerr << "toogl: need -o outdir to translate files\n";
+	exit(1);
+    } else {
+	for(int i = optind; i < argc; i++) {
+	    if(stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode))
+		add_dir(argv[i]);
+	    else
+		files.push(argv[i]);
+	}
+	if(same_outputs())
+	    exit(1);
+	translate_files();
     }
     
     if(debug) 
-	print_hits();
+	print_totals();
+    if(rule_report)
+	print_rules();
+#ifdef PROFILE
+    if(profile)
+	print_profile();
+#endif
 	
-    return errors; 
+    return total_errors; 
 }
+#endif
 
 
 /*
@@ -1277,88 +1935,82 @@ int matching(const char *in, int offset)
 	return s - &in[offset];
 }
 
-PerlStringList split_args( PerlString &in,  int &ok)
+// add the Ranges of in for "(", each arg, ")" and the rest of the line
+// to results, the '(' being at in[offset].  Returns 0 if they don't match up.
+int split_args(Translation &t, const char *in, int offset, RangeList &results)
 {
-    PerlStringList results(10);
-    ok = 1;
-    
-    int r = matching(in);
+    int r = matching(in, offset);
     if(r == 0) {		// no args possible
-	error( "un-matched parenthesis or quote");
-	ok = 0;
-	results.reset();
-	return results;
+	error(t, "un-matched parenthesis or quote");
+	return 0;
     }
 	
-    results.push("(");
-    
-    PerlString s = in.substr(1, r-1);	// get arg list without ()'s
-    PerlString rest = in.substr(r+1); // rest of input after ')'
+    results.push(Range(offset, offset));
     
-    int i = 0;
-    int j = 0;
+    int end = offset + r;	// the ')'
+    int i = offset + 1;		// arg list without ()'s
+    int j = i;
     int c;
     
-    while(i < s.length()) {
-	c = s[i];
+    while(i < end) {
+	c = in[i];
 	if(c == '(' || c == '"') {
-	    r = matching(s, i);
-	    if(!r) {
-		error("un-matched paren or quote");
-		ok = 0;
-		results.reset();
-		break;
+	    r = matching(in, i);
+	    if(!r || i + r >= end) {
+		error(t, "un-matched paren or quote");
+		return 0;
 	    }
 	    i += r + 1;
 	} else if(c == ',') {
-	    results.push(s.substr(j, i-j));
+	    results.push(Range(j, i-1));
 	    i++;
 	    j = i;
 	} else
 	    i++;
     }
     
-    results.push(s.substr(j, i-j));
-    results.push(")");
-    results.push(rest);
+    results.push(Range(j, i-1));
+    results.push(Range(end, end));
+    results.push(Range(end+1, end + strlen(&in[end+1])));	// rest of input after ')'
     
-    return results;
+    return 1;
 }
 
 #if TEST_MATCH
 
+// split_args() each line of stdin, for building with -DTEST_MATCH
+int
 main() {
     PerlString istr;
+    RangeList a;
+    Translation t;
     do {
-	cin >> istr;
-	PerlStringList a = split_args (istr);
-	
-	cout << a.join("\n") << '\n';
-    } while(!cin.eof());
+	std::cin >> istr;
+	a.reset();
+	if(split_args(t, istr, 0, a)) {
+	    for(int i = 0; i < a.scalar(); i++)
+		std::cout << istr.substr(a[i]) << '\n';
+	}
+    } while(!std::cin.eof());
 }
 #endif
 
-// replace "$n" in input string with args[n] (1 based)
-// $1 - $9, $a - $f, or $A - $F work
-// no check is made for $<anything else> or $ at end of string!
-
-void replace_args(PerlString &in, const PerlStringList &args)
+// add args rule r's replacement to out with each "$n" replaced by the
+// arg of in that s[n+2] covers, s being as match_func() left it
+void replace_args(Translation &t, PerlString &out, const Rule &r, const char *in, const RangeList &s)
 {
-    int j, n;    
+    const RuleSegment *g;
+    int nargs = s.scalar() - 5;
     
-    while((j = in.index("$")) >= 0) {
-	n = in[j+1];
-	if(n >= '1' && n <= '9') 
-	    n -= '1';
-	else if (n >= 'a' && n <= 'f') 
-	    n = n - 'a' + 9;
-	else if (n >= 'A' && n <= 'F') 
-	    n = n - 'A' + 9;
-	if(n >= args.scalar()) {
-	    error("Not enough arguments for function or other wierdness");
-	    return;
+    for(g = r.segs; ; g++) {
+	out.append(g->text, g->len);
+	if(!g->arg)
+	    break;
+	if(g->arg > nargs) {
+	    error(t, "Not enough arguments for function or other wierdness");
+	    out += g->text + g->len;
+	    break;
 	}
-	      
-	in.substr(j, 2) = args[n];
+	out.append(in + s[g->arg + 2].start(), s[g->arg + 2].length());
     }
 }